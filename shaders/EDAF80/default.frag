@@ -3,6 +3,18 @@
 uniform sampler2D diffuse_texture;
 uniform int has_diffuse_texture;
 
+// Constants of the material being rendered; see MaterialBuffer.
+layout (std140) uniform Material
+{
+	vec3 diffuse_colour;
+	float shininess_value;
+	vec3 specular_colour;
+	float index_of_refraction_value;
+	vec3 ambient_colour;
+	float opacity_value;
+	vec3 emissive_colour;
+};
+
 in VS_OUT {
 	vec2 texcoord;
 } fs_in;
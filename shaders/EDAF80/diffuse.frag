@@ -2,6 +2,18 @@
 
 uniform vec3 light_position;
 
+// Constants of the material being rendered; see MaterialBuffer.
+layout (std140) uniform Material
+{
+	vec3 diffuse_colour;
+	float shininess_value;
+	vec3 specular_colour;
+	float index_of_refraction_value;
+	vec3 ambient_colour;
+	float opacity_value;
+	vec3 emissive_colour;
+};
+
 in VS_OUT {
 	vec3 vertex;
 	vec3 normal;
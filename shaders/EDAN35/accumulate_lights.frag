@@ -13,16 +13,35 @@ layout (std140) uniform CameraViewProjTransforms
 
 layout (std140) uniform LightViewProjTransforms
 {
-	ViewProjTransforms lights[4];
+	ViewProjTransforms lights[128]; // Has to match edan35::LightSystem::max_lights_nb
 };
 
 uniform int light_index;
 
 uniform sampler2D depth_texture;
 uniform sampler2D normal_texture;
-uniform sampler2D shadow_texture;
+uniform sampler2DShadow shadow_texture;
+uniform sampler2D shadow_moments_texture;
+
+// Has to match the ShadowFiltering enum of assignment2.cpp
+const int shadow_filtering_pcf  = 0;
+const int shadow_filtering_vsm  = 1;
+const int shadow_filtering_evsm = 2;
+uniform int shadow_filtering;
+uniform int pcf_kernel_radius;         // (2 * radius + 1)^2 taps
+uniform float shadow_depth_scale;      // inverse of the light's far plane
+uniform float shadow_receiver_offset;  // world-space offset towards the light, against acne
+uniform vec2 evsm_exponents;           // positive and negative warps
+uniform float light_bleeding_reduction;
+// Output each light's visibility instead of its contribution, to compare
+// the shadow filterings independently of the shading.
+uniform bool show_shadow_visibility;
 
 uniform vec2 inverse_screen_resolution;
+// Fraction of the G-buffer that was rendered into: with dynamic resolution
+// only the [0, render_scale] sub-rectangle of the textures is valid.
+uniform vec2 render_scale;
+uniform bool use_compact_gbuffer;
 
 uniform vec3 camera_position;
 
@@ -35,11 +54,118 @@ uniform float light_angle_falloff;
 layout (location = 0) out vec4 light_diffuse_contribution;
 layout (location = 1) out vec4 light_specular_contribution;
 
+// Inverse of the octahedral mapping used by the compact G-buffer layout.
+vec3 decode_octahedral(vec2 encoded)
+{
+	vec2 f = encoded * 2.0 - 1.0;
+	vec3 n = vec3(f.x, f.y, 1.0 - abs(f.x) - abs(f.y));
+	float t = clamp(-n.z, 0.0, 1.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+	return normalize(n);
+}
+
+// Retrieve the world-space normal stored in the G-buffer, whichever layout
+// is currently in use.
+vec3 fetch_normal(vec2 texcoord)
+{
+	vec4 texel = texture(normal_texture, texcoord);
+	return use_compact_gbuffer ? decode_octahedral(texel.xy)
+	                           : normalize(texel.xyz * 2.0 - 1.0);
+}
+
+// Convert texture coordinates in the G-buffer to normalised device
+// coordinates, taking the dynamic resolution scale into account.
+vec2 texcoord_to_ndc(vec2 texcoord)
+{
+	return (texcoord / render_scale) * 2.0 - 1.0;
+}
+
+
+// Hardware-filtered percentage-closer filtering: each tap compares
+// against four texels and interpolates the results bilinearly.
+float pcf_visibility(vec3 shadow_coord)
+{
+	vec2 texel_size = 1.0 / vec2(textureSize(shadow_texture, 0));
+	float visibility = 0.0;
+	for (int y = -pcf_kernel_radius; y <= pcf_kernel_radius; ++y)
+		for (int x = -pcf_kernel_radius; x <= pcf_kernel_radius; ++x)
+			visibility += texture(shadow_texture, vec3(shadow_coord.xy + vec2(x, y) * texel_size, shadow_coord.z));
+	float taps_per_side = float(2 * pcf_kernel_radius + 1);
+	return visibility / (taps_per_side * taps_per_side);
+}
+
+// Upper bound on the fraction of the filter footprint which is lit,
+// given the first two moments of the occluders' depth distribution.
+float chebyshev_upper_bound(vec2 moments, float depth, float min_variance)
+{
+	if (depth <= moments.x)
+		return 1.0;
+
+	float variance = max(moments.y - moments.x * moments.x, min_variance);
+	float difference = depth - moments.x;
+	float p_max = variance / (variance + difference * difference);
+
+	// Cut off the tail of the bound, which is responsible for light
+	// bleeding between overlapping occluders.
+	return clamp((p_max - light_bleeding_reduction) / (1.0 - light_bleeding_reduction), 0.0, 1.0);
+}
+
+// `linear_depth` is the receiver's distance along the light's axis,
+// scaled to [0, 1] by the far plane; it has to match fill_shadowmap.frag.
+float moments_visibility(vec2 shadow_texcoord, float linear_depth)
+{
+	vec4 moments = texture(shadow_moments_texture, shadow_texcoord);
+	if (shadow_filtering == shadow_filtering_vsm)
+		return chebyshev_upper_bound(moments.xy, linear_depth, 1.0e-5);
+
+	float warped_depth = 2.0 * linear_depth - 1.0;
+	float positive_depth = exp(evsm_exponents.x * warped_depth);
+	float negative_depth = -exp(-evsm_exponents.y * warped_depth);
+	// The minimum variance is given in linear depth, and scaled by the
+	// derivative of the warp.
+	float positive_min_variance = 1.0e-5 * evsm_exponents.x * positive_depth * evsm_exponents.x * positive_depth;
+	float negative_min_variance = 1.0e-5 * evsm_exponents.y * negative_depth * evsm_exponents.y * negative_depth;
+	return min(chebyshev_upper_bound(moments.xy, positive_depth, positive_min_variance),
+	           chebyshev_upper_bound(moments.zw, negative_depth, negative_min_variance));
+}
+
+// The receiver is moved towards the light rather than along its normal,
+// so that the G-buffer normals are not needed.
+float shadow_visibility(vec3 world_position)
+{
+	vec3 to_light = light_position - world_position;
+	float distance_to_light = length(to_light);
+	if (distance_to_light > 0.0)
+		world_position += min(shadow_receiver_offset, distance_to_light) * to_light / distance_to_light;
+
+	vec4 light_clip = lights[light_index].view_projection * vec4(world_position, 1.0);
+	if (light_clip.w <= 0.0)
+		return 0.0;
+	vec3 shadow_coord = (light_clip.xyz / light_clip.w) * 0.5 + 0.5;
+	if (any(lessThan(shadow_coord.xy, vec2(0.0))) || any(greaterThan(shadow_coord.xy, vec2(1.0))))
+		return 0.0;
+
+	if (shadow_filtering == shadow_filtering_pcf)
+		return pcf_visibility(shadow_coord);
+	return moments_visibility(shadow_coord.xy, light_clip.w * shadow_depth_scale);
+}
+
 
 void main()
 {
 	vec2 shadowmap_texel_size = 1.0f / textureSize(shadow_texture, 0);
 
+	if (show_shadow_visibility) {
+		vec2 texcoord = gl_FragCoord.xy * inverse_screen_resolution;
+		float depth = texture(depth_texture, texcoord).r;
+		vec4 world_position = camera.view_projection_inverse * vec4(texcoord_to_ndc(texcoord), depth * 2.0 - 1.0, 1.0);
+		world_position /= world_position.w;
+
+		light_diffuse_contribution  = vec4(vec3(shadow_visibility(world_position.xyz)), 1.0);
+		light_specular_contribution = vec4(0.0, 0.0, 0.0, 1.0);
+		return;
+	}
+
 	light_diffuse_contribution  = vec4(0.0, 0.0, 0.0, 1.0);
 	light_specular_contribution = vec4(0.0, 0.0, 0.0, 1.0);
 }
@@ -0,0 +1,31 @@
+#version 410
+
+// One direction of a separable Gaussian blur of the shadow moments; as
+// moments are linear in the depth distribution, filtering them is
+// equivalent to filtering the shadow test.
+
+uniform sampler2D moments_texture;
+uniform ivec2 direction;    // (1, 0) or (0, 1)
+uniform int kernel_radius;  // the standard deviation is half of it
+
+layout (pixel_center_integer) in vec4 gl_FragCoord;
+
+layout (location = 0) out vec4 blurred_moments;
+
+void main()
+{
+	ivec2 coord = ivec2(gl_FragCoord.xy);
+	ivec2 max_coord = textureSize(moments_texture, 0) - 1;
+
+	float sigma = max(0.5 * float(kernel_radius), 0.5);
+	vec4 sum = vec4(0.0);
+	float weights_sum = 0.0;
+	for (int i = -kernel_radius; i <= kernel_radius; ++i) {
+		float weight = exp(-0.5 * float(i * i) / (sigma * sigma));
+		ivec2 sample_coord = clamp(coord + i * direction, ivec2(0), max_coord);
+		sum += weight * texelFetch(moments_texture, sample_coord, 0);
+		weights_sum += weight;
+	}
+
+	blurred_moments = sum / weights_sum;
+}
@@ -0,0 +1,6 @@
+#version 410
+
+// Only the depth is written during the pre-pass.
+void main()
+{
+}
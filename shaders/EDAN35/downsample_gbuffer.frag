@@ -0,0 +1,35 @@
+#version 410
+
+uniform sampler2D depth_texture;
+uniform sampler2D normal_texture;
+
+uniform int downscale;
+uniform ivec2 source_max_coord;
+
+layout (pixel_center_integer) in vec4 gl_FragCoord;
+
+layout (location = 0) out vec4 low_res_normal;
+
+void main()
+{
+	ivec2 base_coord = ivec2(gl_FragCoord.xy) * downscale;
+
+	// Keep the closest sample of the footprint along with its normal,
+	// rather than averaging them: an average across a depth discontinuity
+	// would describe a surface that does not exist.
+	ivec2 closest_coord = min(base_coord, source_max_coord);
+	float closest_depth = texelFetch(depth_texture, closest_coord, 0).r;
+	for (int y = 0; y < downscale; ++y) {
+		for (int x = 0; x < downscale; ++x) {
+			ivec2 coord = min(base_coord + ivec2(x, y), source_max_coord);
+			float depth = texelFetch(depth_texture, coord, 0).r;
+			if (depth < closest_depth) {
+				closest_depth = depth;
+				closest_coord = coord;
+			}
+		}
+	}
+
+	gl_FragDepth = closest_depth;
+	low_res_normal = texelFetch(normal_texture, closest_coord, 0);
+}
@@ -9,34 +9,110 @@ uniform sampler2D specular_texture;
 uniform sampler2D normals_texture;
 uniform sampler2D opacity_texture;
 uniform mat4 normal_model_to_world;
+uniform bool use_compact_gbuffer;
+
+struct MaterialData
+{
+	ivec4 texture_arrays; // diffuse, specular, normals, opacity; -1 if none
+	ivec4 texture_layers;
+	vec4 diffuse_opacity;
+	vec4 specular_shininess;
+};
+
+layout (std140) uniform Materials
+{
+	MaterialData materials[256]; // Has to match edan35::MaterialAtlas::max_materials_nb
+};
+
+uniform bool use_material_atlas;
+uniform sampler2DArray material_texture_arrays[8]; // Has to match edan35::MaterialAtlas::max_texture_arrays_nb
 
 in VS_OUT {
 	vec3 normal;
 	vec2 texcoord;
 	vec3 tangent;
 	vec3 binormal;
+	flat uint material_index;
 } fs_in;
 
 layout (location = 0) out vec4 geometry_diffuse;
 layout (location = 1) out vec4 geometry_specular;
 layout (location = 2) out vec4 geometry_normal;
+layout (location = 3) out float geometry_overdraw;
+
+// Map a unit vector onto the [0,1]² square using an octahedral projection;
+// used by the compact G-buffer layout to store normals in two channels.
+vec2 encode_octahedral(vec3 n)
+{
+	n /= max(abs(n.x) + abs(n.y) + abs(n.z), 1e-6);
+	vec2 folded = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+	return folded * 0.5 + 0.5;
+}
+
+// Sampler arrays can only be indexed by constant expressions in GLSL 4.10,
+// hence the switch.
+vec4 sample_texture_array(int array_index, int layer, vec2 texcoord)
+{
+	vec3 coords = vec3(texcoord, float(layer));
+	switch (array_index) {
+	case 0: return texture(material_texture_arrays[0], coords);
+	case 1: return texture(material_texture_arrays[1], coords);
+	case 2: return texture(material_texture_arrays[2], coords);
+	case 3: return texture(material_texture_arrays[3], coords);
+	case 4: return texture(material_texture_arrays[4], coords);
+	case 5: return texture(material_texture_arrays[5], coords);
+	case 6: return texture(material_texture_arrays[6], coords);
+	case 7: return texture(material_texture_arrays[7], coords);
+	}
+	return vec4(0.0);
+}
+
+// Texture slots: 0 for diffuse, 1 for specular, 2 for normals and 3 for
+// opacity; with the atlas, the textures come from the material table.
+bool has_material_texture(int slot, bool has_texture)
+{
+	if (!use_material_atlas)
+		return has_texture;
+	return materials[fs_in.material_index].texture_arrays[slot] >= 0;
+}
+
+vec4 sample_material_texture(int slot, sampler2D texture_sampler)
+{
+	if (!use_material_atlas)
+		return texture(texture_sampler, fs_in.texcoord);
+	MaterialData material = materials[fs_in.material_index];
+	return sample_texture_array(material.texture_arrays[slot], material.texture_layers[slot], fs_in.texcoord);
+}
 
 
 void main()
 {
-	if (has_opacity_texture && texture(opacity_texture, fs_in.texcoord).r < 1.0)
+	if (has_material_texture(3, has_opacity_texture) && sample_material_texture(3, opacity_texture).r < 1.0)
 		discard;
 
+	// Additively blended, to count how many fragments got shaded per pixel.
+	geometry_overdraw = 1.0;
+
 	// Diffuse color
 	geometry_diffuse = vec4(0.0f);
-	if (has_diffuse_texture)
-		geometry_diffuse = texture(diffuse_texture, fs_in.texcoord);
+	if (has_material_texture(0, has_diffuse_texture))
+		geometry_diffuse = sample_material_texture(0, diffuse_texture);
 
 	// Specular color
 	geometry_specular = vec4(0.0f);
-	if (has_specular_texture)
-		geometry_specular = texture(specular_texture, fs_in.texcoord);
+	if (has_material_texture(1, has_specular_texture))
+		geometry_specular = sample_material_texture(1, specular_texture);
 
 	// Worldspace normal
-	geometry_normal.xyz = vec3(0.0);
+	vec3 normal = vec3(0.0);
+
+	if (use_compact_gbuffer) {
+		// The compact layout stores the specular intensity in the
+		// alpha channel of the diffuse target, and the normal in a
+		// two-channel target.
+		geometry_diffuse.a = dot(geometry_specular.rgb, vec3(0.2126, 0.7152, 0.0722));
+		geometry_normal = vec4(encode_octahedral(normal), 0.0, 0.0);
+	} else {
+		geometry_normal.xyz = normal * 0.5 + 0.5;
+	}
 }
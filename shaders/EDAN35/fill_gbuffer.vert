@@ -12,6 +12,7 @@ layout (std140) uniform CameraViewProjTransforms
 };
 
 uniform mat4 vertex_model_to_world;
+uniform uint material_index;
 
 layout (location = 0) in vec3 vertex;
 layout (location = 1) in vec3 normal;
@@ -24,14 +25,20 @@ out VS_OUT {
 	vec2 texcoord;
 	vec3 tangent;
 	vec3 binormal;
+	flat uint material_index;
 } vs_out;
 
+// The depth pre-pass reuses this shader, and the G-buffer pass then relies
+// on a GL_EQUAL depth test: both have to compute exactly the same depths.
+invariant gl_Position;
+
 
 void main() {
 	vs_out.normal   = normalize(normal);
 	vs_out.texcoord = texcoord.xy;
 	vs_out.tangent  = normalize(tangent);
 	vs_out.binormal = normalize(binormal);
+	vs_out.material_index = material_index;
 
 	gl_Position = camera.view_projection * vertex_model_to_world * vec4(vertex, 1.0);
 }
@@ -0,0 +1,62 @@
+#version 430
+
+struct ViewProjTransforms
+{
+	mat4 view_projection;
+	mat4 view_projection_inverse;
+};
+
+layout (std140) uniform CameraViewProjTransforms
+{
+	ViewProjTransforms camera;
+};
+
+struct DrawData
+{
+	mat4 vertex_model_to_world;
+	mat4 normal_model_to_world;
+	uint material_index;
+};
+
+// Has to match edan35::DrawData and edan35::GeometryBatch::draw_data_binding
+layout (std430, binding = 0) readonly buffer DrawDataBuffer
+{
+	DrawData draws[];
+};
+
+layout (location = 0) in vec3 vertex;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec3 texcoord;
+layout (location = 3) in vec3 tangent;
+layout (location = 4) in vec3 binormal;
+layout (location = 5) in uint draw_id; // Has to match edan35::GeometryBatch::draw_id_location
+
+out VS_OUT {
+	vec3 normal;
+	vec2 texcoord;
+	vec3 tangent;
+	vec3 binormal;
+	flat uint material_index;
+} vs_out;
+
+// Same as fill_gbuffer.vert: the depth pre-pass relies on both passes
+// computing exactly the same depths.
+invariant gl_Position;
+
+
+void main() {
+	DrawData draw = draws[draw_id];
+
+	// The model-to-world transforms differ between the draws of a single
+	// call, so the tangent frame is output in world space here; the
+	// fragment shader gets an identity `normal_model_to_world`.
+	mat3 normal_model_to_world = mat3(draw.normal_model_to_world);
+	mat3 vertex_model_to_world = mat3(draw.vertex_model_to_world);
+	vs_out.normal   = normalize(normal_model_to_world * normal);
+	vs_out.texcoord = texcoord.xy;
+	vs_out.tangent  = normalize(vertex_model_to_world * tangent);
+	vs_out.binormal = normalize(vertex_model_to_world * binormal);
+	vs_out.material_index = draw.material_index;
+
+	gl_Position = camera.view_projection * draw.vertex_model_to_world * vec4(vertex, 1.0);
+}
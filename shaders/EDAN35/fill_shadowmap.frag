@@ -3,12 +3,77 @@
 uniform bool has_opacity_texture;
 uniform sampler2D opacity_texture;
 
+struct MaterialData
+{
+	ivec4 texture_arrays; // diffuse, specular, normals, opacity; -1 if none
+	ivec4 texture_layers;
+	vec4 diffuse_opacity;
+	vec4 specular_shininess;
+};
+
+layout (std140) uniform Materials
+{
+	MaterialData materials[256]; // Has to match edan35::MaterialAtlas::max_materials_nb
+};
+
+uniform bool use_material_atlas;
+uniform sampler2DArray material_texture_arrays[8]; // Has to match edan35::MaterialAtlas::max_texture_arrays_nb
+
+// Has to match the ShadowFiltering enum of assignment2.cpp; with PCF,
+// only the depth is written.
+const int shadow_filtering_vsm  = 1;
+const int shadow_filtering_evsm = 2;
+uniform int shadow_filtering;
+uniform float shadow_depth_scale; // inverse of the light's far plane
+uniform vec2 evsm_exponents;      // positive and negative warps
+
+layout (location = 0) out vec4 shadow_moments;
+
 in VS_OUT {
 	vec2 texcoord;
+	flat uint material_index;
 } fs_in;
 
+// Sampler arrays can only be indexed by constant expressions in GLSL 4.10,
+// hence the switch.
+vec4 sample_texture_array(int array_index, int layer, vec2 texcoord)
+{
+	vec3 coords = vec3(texcoord, float(layer));
+	switch (array_index) {
+	case 0: return texture(material_texture_arrays[0], coords);
+	case 1: return texture(material_texture_arrays[1], coords);
+	case 2: return texture(material_texture_arrays[2], coords);
+	case 3: return texture(material_texture_arrays[3], coords);
+	case 4: return texture(material_texture_arrays[4], coords);
+	case 5: return texture(material_texture_arrays[5], coords);
+	case 6: return texture(material_texture_arrays[6], coords);
+	case 7: return texture(material_texture_arrays[7], coords);
+	}
+	return vec4(0.0);
+}
+
 void main()
 {
-	if (has_opacity_texture && texture(opacity_texture, fs_in.texcoord).r < 1.0)
+	if (use_material_atlas) {
+		MaterialData material = materials[fs_in.material_index];
+		if (material.texture_arrays.w >= 0 && sample_texture_array(material.texture_arrays.w, material.texture_layers.w, fs_in.texcoord).r < 1.0)
+			discard;
+	} else if (has_opacity_texture && texture(opacity_texture, fs_in.texcoord).r < 1.0) {
 		discard;
+	}
+
+	// The moments are computed from the distance along the light's axis,
+	// i.e. the clip-space w, rather than from the non-linear window depth.
+	float linear_depth = shadow_depth_scale / gl_FragCoord.w;
+	if (shadow_filtering == shadow_filtering_vsm) {
+		shadow_moments = vec4(linear_depth, linear_depth * linear_depth, 0.0, 0.0);
+	} else if (shadow_filtering == shadow_filtering_evsm) {
+		float warped_depth = 2.0 * linear_depth - 1.0;
+		float positive_depth = exp(evsm_exponents.x * warped_depth);
+		float negative_depth = -exp(-evsm_exponents.y * warped_depth);
+		shadow_moments = vec4(positive_depth, positive_depth * positive_depth,
+		                      negative_depth, negative_depth * negative_depth);
+	} else {
+		shadow_moments = vec4(0.0);
+	}
 }
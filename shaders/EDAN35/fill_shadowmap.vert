@@ -8,22 +8,25 @@ struct ViewProjTransforms
 
 layout (std140) uniform LightViewProjTransforms
 {
-	ViewProjTransforms lights[4];
+	ViewProjTransforms lights[128]; // Has to match edan35::LightSystem::max_lights_nb
 };
 
 uniform int light_index;
 uniform mat4 vertex_model_to_world;
+uniform uint material_index;
 
 layout (location = 0) in vec3 vertex;
 layout (location = 2) in vec3 texcoord;
 
 out VS_OUT {
 	vec2 texcoord;
+	flat uint material_index;
 } vs_out;
 
 void main()
 {
 	vs_out.texcoord = texcoord.xy;
+	vs_out.material_index = material_index;
 
 	gl_Position = lights[light_index].view_projection * vertex_model_to_world * vec4(vertex, 1.0);
 }
@@ -0,0 +1,44 @@
+#version 430
+
+struct ViewProjTransforms
+{
+	mat4 view_projection;
+	mat4 view_projection_inverse;
+};
+
+layout (std140) uniform LightViewProjTransforms
+{
+	ViewProjTransforms lights[128]; // Has to match edan35::LightSystem::max_lights_nb
+};
+
+struct DrawData
+{
+	mat4 vertex_model_to_world;
+	mat4 normal_model_to_world;
+	uint material_index;
+};
+
+// Has to match edan35::DrawData and edan35::GeometryBatch::draw_data_binding
+layout (std430, binding = 0) readonly buffer DrawDataBuffer
+{
+	DrawData draws[];
+};
+
+uniform int light_index;
+
+layout (location = 0) in vec3 vertex;
+layout (location = 2) in vec3 texcoord;
+layout (location = 5) in uint draw_id; // Has to match edan35::GeometryBatch::draw_id_location
+
+out VS_OUT {
+	vec2 texcoord;
+	flat uint material_index;
+} vs_out;
+
+void main()
+{
+	vs_out.texcoord = texcoord.xy;
+	vs_out.material_index = draws[draw_id].material_index;
+
+	gl_Position = lights[light_index].view_projection * draws[draw_id].vertex_model_to_world * vec4(vertex, 1.0);
+}
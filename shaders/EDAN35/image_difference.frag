@@ -0,0 +1,37 @@
+#version 410
+
+uniform sampler2D result_texture;
+uniform sampler2D reference_texture;
+
+// Fraction of each texture which was rendered into, as the result and the
+// reference might have been rendered with different resolution scales.
+uniform vec2 result_scale;
+uniform vec2 reference_scale;
+uniform vec2 inverse_resolution;
+uniform ivec2 resolution;
+
+// Each fragment sums the errors over a tile of tile_size² pixels, clipped
+// to the resolution.
+uniform int tile_size;
+
+out vec2 error_sums;
+
+void main()
+{
+	ivec2 tile_start = ivec2(gl_FragCoord.xy) * tile_size;
+	ivec2 tile_end = min(tile_start + ivec2(tile_size), resolution);
+
+	error_sums = vec2(0.0);
+	for (int y = tile_start.y; y < tile_end.y; ++y) {
+		for (int x = tile_start.x; x < tile_end.x; ++x) {
+			vec2 texcoord = (vec2(x, y) + 0.5) * inverse_resolution;
+
+			vec3 result    = texture(result_texture,    texcoord * result_scale).rgb;
+			vec3 reference = texture(reference_texture, texcoord * reference_scale).rgb;
+
+			vec3 difference = abs(result - reference);
+			error_sums += vec2(dot(difference, vec3(1.0 / 3.0)),
+			                   dot(difference * difference, vec3(1.0 / 3.0)));
+		}
+	}
+}
@@ -0,0 +1,23 @@
+#version 410
+
+uniform sampler2D overdraw_texture;
+
+// Amount of overdraw mapped to the hottest colour of the ramp.
+uniform float max_overdraw;
+
+out vec4 frag_color;
+
+void main()
+{
+	float overdraw = texelFetch(overdraw_texture, ivec2(gl_FragCoord.xy), 0).r;
+
+	// Black for untouched pixels, then blue, green, yellow and red as the
+	// number of shaded fragments gets closer to `max_overdraw`.
+	float t = clamp(overdraw / max(max_overdraw, 1.0), 0.0, 1.0);
+	vec3 color = overdraw > 0.0 ? vec3(0.0, 0.0, 1.0) : vec3(0.0);
+	color = mix(color, vec3(0.0, 1.0, 0.0), smoothstep(0.0,  0.33, t));
+	color = mix(color, vec3(1.0, 1.0, 0.0), smoothstep(0.33, 0.66, t));
+	color = mix(color, vec3(1.0, 0.0, 0.0), smoothstep(0.66, 1.0,  t));
+
+	frag_color = vec4(color, 1.0);
+}
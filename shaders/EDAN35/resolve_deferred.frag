@@ -4,20 +4,116 @@ uniform sampler2D diffuse_texture;
 uniform sampler2D specular_texture;
 uniform sampler2D light_d_texture;
 uniform sampler2D light_s_texture;
+uniform bool use_compact_gbuffer;
+
+// Only used when lights were accumulated at a lower resolution than the
+// G-buffer's, i.e. when lighting_downscale is greater than 1.
+uniform int lighting_downscale;
+uniform sampler2D depth_texture;
+uniform sampler2D normal_texture;
+uniform sampler2D low_res_depth_texture;
+uniform sampler2D low_res_normal_texture;
+uniform ivec2 low_res_max_coord;
+uniform float camera_near;
+uniform float camera_far;
 
 layout (pixel_center_integer) in vec4 gl_FragCoord;
 
 out vec4 frag_color;
 
+float linearise_depth(float depth)
+{
+	return camera_near * camera_far / (camera_far - depth * (camera_far - camera_near));
+}
+
+vec3 decode_octahedral(vec2 encoded)
+{
+	vec2 f = encoded * 2.0 - 1.0;
+	vec3 n = vec3(f.x, f.y, 1.0 - abs(f.x) - abs(f.y));
+	float t = clamp(-n.z, 0.0, 1.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+	return normalize(n);
+}
+
+vec3 decode_normal(vec4 texel)
+{
+	return use_compact_gbuffer ? decode_octahedral(texel.xy) : texel.xyz * 2.0 - 1.0;
+}
+
+// Joint-bilateral upsampling of the light contributions: the four closest
+// low-resolution samples are weighted by their bilinear weight, but also
+// by how similar their depth and normal are to the full-resolution ones,
+// so that lighting does not bleed across geometric edges.
+void upsample_lighting(ivec2 pixel_coord, out vec3 light_d, out vec3 light_s)
+{
+	const float depth_sigma  = 0.02; // relative depth difference
+	const float normal_power = 16.0;
+
+	float depth  = linearise_depth(texelFetch(depth_texture, pixel_coord, 0).r);
+	vec3  normal = decode_normal(texelFetch(normal_texture, pixel_coord, 0));
+
+	vec2  low_res_coord = (vec2(pixel_coord) + 0.5) / float(lighting_downscale) - 0.5;
+	ivec2 base_coord    = ivec2(floor(low_res_coord));
+	vec2  bilinear      = low_res_coord - vec2(base_coord);
+
+	light_d = vec3(0.0);
+	light_s = vec3(0.0);
+	float weights_sum = 0.0;
+
+	// Used as a fallback if none of the samples is similar enough.
+	ivec2 closest_coord = clamp(base_coord, ivec2(0), low_res_max_coord);
+	float closest_depth_difference = 1.0e30;
+
+	for (int i = 0; i < 4; ++i) {
+		ivec2 offset = ivec2(i & 1, i >> 1);
+		ivec2 coord  = clamp(base_coord + offset, ivec2(0), low_res_max_coord);
+
+		float sample_depth  = linearise_depth(texelFetch(low_res_depth_texture, coord, 0).r);
+		vec3  sample_normal = decode_normal(texelFetch(low_res_normal_texture, coord, 0));
+
+		float depth_difference = abs(sample_depth - depth) / depth;
+		if (depth_difference < closest_depth_difference) {
+			closest_depth_difference = depth_difference;
+			closest_coord = coord;
+		}
+
+		float bilinear_weight = (offset.x == 1 ? bilinear.x : 1.0 - bilinear.x)
+		                      * (offset.y == 1 ? bilinear.y : 1.0 - bilinear.y);
+		float depth_weight  = exp(-depth_difference / depth_sigma);
+		float normal_weight = pow(clamp(dot(normal, sample_normal), 0.0, 1.0), normal_power);
+		float weight = bilinear_weight * depth_weight * normal_weight;
+
+		light_d += weight * texelFetch(light_d_texture, coord, 0).rgb;
+		light_s += weight * texelFetch(light_s_texture, coord, 0).rgb;
+		weights_sum += weight;
+	}
+
+	if (weights_sum > 1.0e-4) {
+		light_d /= weights_sum;
+		light_s /= weights_sum;
+	} else {
+		light_d = texelFetch(light_d_texture, closest_coord, 0).rgb;
+		light_s = texelFetch(light_s_texture, closest_coord, 0).rgb;
+	}
+}
+
 void main()
 {
 	ivec2 pixel_coord = ivec2(gl_FragCoord.xy);
 
-	vec3 diffuse  = texelFetch(diffuse_texture,  pixel_coord, 0).rgb;
-	vec3 specular = texelFetch(specular_texture, pixel_coord, 0).rgb;
+	vec4 diffuse_texel = texelFetch(diffuse_texture, pixel_coord, 0);
+	vec3 diffuse  = diffuse_texel.rgb;
+	vec3 specular = use_compact_gbuffer ? vec3(diffuse_texel.a)
+	                                    : texelFetch(specular_texture, pixel_coord, 0).rgb;
 
-	vec3 light_d  = texelFetch(light_d_texture,  pixel_coord, 0).rgb;
-	vec3 light_s  = texelFetch(light_s_texture,  pixel_coord, 0).rgb;
+	vec3 light_d;
+	vec3 light_s;
+	if (lighting_downscale > 1) {
+		upsample_lighting(pixel_coord, light_d, light_s);
+	} else {
+		light_d = texelFetch(light_d_texture, pixel_coord, 0).rgb;
+		light_s = texelFetch(light_s_texture, pixel_coord, 0).rgb;
+	}
 	const vec3 ambient = vec3(0.15);
 
 	frag_color =  vec4((ambient + light_d) * diffuse + light_s * specular, 1.0);
@@ -0,0 +1,67 @@
+#version 410
+
+// Blend the current, jittered, frame into the accumulated history. The
+// history is fetched where the surface seen by each pixel was during the
+// previous frame, found by reprojecting the depth buffer; it is then
+// clamped to the colour range of the current neighbourhood, so that
+// disoccluded or changed surfaces do not leave ghosts behind.
+
+uniform sampler2D current_texture;
+uniform sampler2D history_texture;
+uniform sampler2D depth_texture;
+
+uniform mat4 clip_to_world;           // current, jittered, view_projection_inverse
+uniform mat4 previous_world_to_clip;  // previous, unjittered, view_projection
+uniform vec2 jitter;                  // current jitter, in normalised device coordinates
+uniform ivec2 render_size;            // area of the textures being rendered to
+uniform vec2 render_scale;            // render_size / textures size
+uniform bool has_history;
+uniform float history_weight;
+
+layout (location = 0) out vec4 result;
+layout (location = 1) out vec4 history;
+
+void main()
+{
+	ivec2 coord = ivec2(gl_FragCoord.xy);
+	ivec2 max_coord = render_size - ivec2(1);
+
+	vec3 current = texelFetch(current_texture, coord, 0).rgb;
+	if (!has_history) {
+		result = vec4(current, 1.0);
+		history = result;
+		return;
+	}
+
+	vec3 neighbourhood_min = current;
+	vec3 neighbourhood_max = current;
+	for (int y = -1; y <= 1; ++y) {
+		for (int x = -1; x <= 1; ++x) {
+			vec3 neighbour = texelFetch(current_texture, clamp(coord + ivec2(x, y), ivec2(0), max_coord), 0).rgb;
+			neighbourhood_min = min(neighbourhood_min, neighbour);
+			neighbourhood_max = max(neighbourhood_max, neighbour);
+		}
+	}
+
+	// Reconstruct the surface at the unjittered pixel centre: it was
+	// rendered offset by the jitter in the current frame.
+	vec2 ndc_position = 2.0 * gl_FragCoord.xy / vec2(render_size) - 1.0;
+	float depth = texelFetch(depth_texture, coord, 0).r;
+	vec4 world_position = clip_to_world * vec4(ndc_position + jitter, 2.0 * depth - 1.0, 1.0);
+	vec4 previous_clip_position = previous_world_to_clip * (world_position / world_position.w);
+	vec2 previous_position = 0.5 * previous_clip_position.xy / previous_clip_position.w + 0.5;
+
+	if (previous_clip_position.w <= 0.0
+	 || any(lessThan(previous_position, vec2(0.0)))
+	 || any(greaterThan(previous_position, vec2(1.0)))) {
+		result = vec4(current, 1.0);
+		history = result;
+		return;
+	}
+
+	vec3 previous = texture(history_texture, previous_position * render_scale).rgb;
+	previous = clamp(previous, neighbourhood_min, neighbourhood_max);
+
+	result = vec4(mix(current, previous, history_weight), 1.0);
+	history = result;
+}
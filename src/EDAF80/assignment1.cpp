@@ -3,6 +3,7 @@
 #include "parametric_shapes.hpp"
 #include "core/Bonobo.h"
 #include "core/FPSCamera.h"
+#include "core/FrameClock.hpp"
 #include "core/helpers.hpp"
 #include "core/node.hpp"
 #include "core/ShaderProgramManager.hpp"
@@ -13,7 +14,7 @@
 #include <cstdlib>
 
 
-int main()
+int main(int argc, char* argv[])
 {
 	std::setlocale(LC_ALL, "");
 
@@ -22,7 +23,7 @@ int main()
 	//
 	// Set up the framework
 	//
-	Bonobo framework;
+	Bonobo framework(argc, argv);
 
 	//
 	// Set up the camera
@@ -177,7 +178,7 @@ int main()
 	glEnable(GL_DEPTH_TEST);
 
 
-	auto last_time = std::chrono::high_resolution_clock::now();
+	FrameClock frame_clock(window_manager.GetFrameClockSettings());
 
 
 	bool pause_animation = false;
@@ -190,10 +191,11 @@ int main()
 		//
 		// Compute timings information
 		//
-		auto const now_time = std::chrono::high_resolution_clock::now();
-		auto const delta_time_us = std::chrono::duration_cast<std::chrono::microseconds>(now_time - last_time);
-		auto const animation_delta_time_us = !pause_animation ? std::chrono::duration_cast<std::chrono::microseconds>(delta_time_us * time_scale) : 0us;
-		last_time = now_time;
+		frame_clock.SetPaused(pause_animation);
+		frame_clock.SetTimeScale(time_scale);
+		frame_clock.Tick();
+		auto const delta_time_us = frame_clock.GetFrameDuration();
+		auto const animation_delta_time_us = frame_clock.GetSimulationDelta();
 
 
 		//
@@ -278,7 +280,7 @@ int main()
 		//
 		// Queue the computed frame for display on screen
 		//
-		glfwSwapBuffers(window);
+		window_manager.SwapBuffers(window);
 	}
 
 	glDeleteTextures(1, &neptune_texture);
@@ -295,5 +297,5 @@ int main()
 
 	bonobo::deinit();
 
-	return EXIT_SUCCESS;
+	return window_manager.GetExitStatus();
 }
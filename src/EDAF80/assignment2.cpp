@@ -5,6 +5,7 @@
 #include "config.hpp"
 #include "core/Bonobo.h"
 #include "core/FPSCamera.h"
+#include "core/FrameClock.hpp"
 #include "core/node.hpp"
 #include "core/ShaderProgramManager.hpp"
 #include <imgui.h>
@@ -160,7 +161,7 @@ edaf80::Assignment2::run()
 	}
 
 
-	auto lastTime = std::chrono::high_resolution_clock::now();
+	FrameClock frame_clock(mWindowManager.GetFrameClockSettings());
 
 	std::int32_t program_index = 0;
 	float elapsed_time_s = 0.0f;
@@ -175,9 +176,8 @@ edaf80::Assignment2::run()
 	changeCullMode(cull_mode);
 
 	while (!glfwWindowShouldClose(window)) {
-		auto const nowTime = std::chrono::high_resolution_clock::now();
-		auto const deltaTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(nowTime - lastTime);
-		lastTime = nowTime;
+		frame_clock.Tick();
+		auto const deltaTimeUs = frame_clock.GetFrameDuration();
 
 		auto& io = ImGui::GetIO();
 		inputHandler.SetUICapture(io.WantCaptureMouse, io.WantCaptureKeyboard);
@@ -185,7 +185,7 @@ edaf80::Assignment2::run()
 		glfwPollEvents();
 		inputHandler.Advance();
 		mCamera.Update(deltaTimeUs, inputHandler);
-		elapsed_time_s += std::chrono::duration<float>(deltaTimeUs).count();
+		elapsed_time_s = frame_clock.GetInterpolatedSimulationTime();
 
 		if (inputHandler.GetKeycodeState(GLFW_KEY_F3) & JUST_RELEASED)
 			show_logs = !show_logs;
@@ -265,20 +265,23 @@ edaf80::Assignment2::run()
 			Log::View::Render();
 		mWindowManager.RenderImGuiFrame(show_gui);
 
-		glfwSwapBuffers(window);
+		mWindowManager.SwapBuffers(window);
 	}
 }
 
-int main()
+int main(int argc, char* argv[])
 {
 	std::setlocale(LC_ALL, "");
 
-	Bonobo framework;
+	Bonobo framework(argc, argv);
 
 	try {
 		edaf80::Assignment2 assignment2(framework.GetWindowManager());
 		assignment2.run();
 	} catch (std::runtime_error const& e) {
 		LogError(e.what());
+		return EXIT_FAILURE;
 	}
+
+	return framework.GetWindowManager().GetExitStatus();
 }
@@ -5,6 +5,7 @@
 #include "config.hpp"
 #include "core/Bonobo.h"
 #include "core/FPSCamera.h"
+#include "core/FrameClock.hpp"
 #include "core/node.hpp"
 #include "core/ShaderProgramManager.hpp"
 
@@ -133,7 +134,7 @@ edaf80::Assignment3::run()
 	glEnable(GL_DEPTH_TEST);
 
 
-	auto lastTime = std::chrono::high_resolution_clock::now();
+	FrameClock frame_clock(mWindowManager.GetFrameClockSettings());
 
 	bool use_orbit_camera = false;
 	std::int32_t demo_sphere_program_index = 0;
@@ -149,9 +150,8 @@ edaf80::Assignment3::run()
 	changeCullMode(cull_mode);
 
 	while (!glfwWindowShouldClose(window)) {
-		auto const nowTime = std::chrono::high_resolution_clock::now();
-		auto const deltaTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(nowTime - lastTime);
-		lastTime = nowTime;
+		frame_clock.Tick();
+		auto const deltaTimeUs = frame_clock.GetFrameDuration();
 
 		auto& io = ImGui::GetIO();
 		inputHandler.SetUICapture(io.WantCaptureMouse, io.WantCaptureKeyboard);
@@ -246,20 +246,23 @@ edaf80::Assignment3::run()
 			Log::View::Render();
 		mWindowManager.RenderImGuiFrame(show_gui);
 
-		glfwSwapBuffers(window);
+		mWindowManager.SwapBuffers(window);
 	}
 }
 
-int main()
+int main(int argc, char* argv[])
 {
 	std::setlocale(LC_ALL, "");
 
-	Bonobo framework;
+	Bonobo framework(argc, argv);
 
 	try {
 		edaf80::Assignment3 assignment3(framework.GetWindowManager());
 		assignment3.run();
 	} catch (std::runtime_error const& e) {
 		LogError(e.what());
+		return EXIT_FAILURE;
 	}
+
+	return framework.GetWindowManager().GetExitStatus();
 }
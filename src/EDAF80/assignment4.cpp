@@ -4,6 +4,7 @@
 #include "config.hpp"
 #include "core/Bonobo.h"
 #include "core/FPSCamera.h"
+#include "core/FrameClock.hpp"
 #include "core/helpers.hpp"
 #include "core/node.hpp"
 #include "core/ShaderProgramManager.hpp"
@@ -13,6 +14,7 @@
 #include <tinyfiledialogs.h>
 
 #include <clocale>
+#include <cstdlib>
 #include <stdexcept>
 
 edaf80::Assignment4::Assignment4(WindowManager& windowManager) :
@@ -74,7 +76,7 @@ edaf80::Assignment4::run()
 	glEnable(GL_DEPTH_TEST);
 
 
-	auto lastTime = std::chrono::high_resolution_clock::now();
+	FrameClock frame_clock(mWindowManager.GetFrameClockSettings());
 
 	bool pause_animation = true;
 	bool use_orbit_camera = false;
@@ -90,12 +92,10 @@ edaf80::Assignment4::run()
 	changeCullMode(cull_mode);
 
 	while (!glfwWindowShouldClose(window)) {
-		auto const nowTime = std::chrono::high_resolution_clock::now();
-		auto const deltaTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(nowTime - lastTime);
-		lastTime = nowTime;
-		if (!pause_animation) {
-			elapsed_time_s += std::chrono::duration<float>(deltaTimeUs).count();
-		}
+		frame_clock.SetPaused(pause_animation);
+		frame_clock.Tick();
+		auto const deltaTimeUs = frame_clock.GetFrameDuration();
+		elapsed_time_s = frame_clock.GetInterpolatedSimulationTime();
 
 		auto& io = ImGui::GetIO();
 		inputHandler.SetUICapture(io.WantCaptureMouse, io.WantCaptureKeyboard);
@@ -184,20 +184,23 @@ edaf80::Assignment4::run()
 			Log::View::Render();
 		mWindowManager.RenderImGuiFrame(show_gui);
 
-		glfwSwapBuffers(window);
+		mWindowManager.SwapBuffers(window);
 	}
 }
 
-int main()
+int main(int argc, char* argv[])
 {
 	std::setlocale(LC_ALL, "");
 
-	Bonobo framework;
+	Bonobo framework(argc, argv);
 
 	try {
 		edaf80::Assignment4 assignment4(framework.GetWindowManager());
 		assignment4.run();
 	} catch (std::runtime_error const& e) {
 		LogError(e.what());
+		return EXIT_FAILURE;
 	}
+
+	return framework.GetWindowManager().GetExitStatus();
 }
@@ -3,6 +3,7 @@
 #include "config.hpp"
 #include "core/Bonobo.h"
 #include "core/FPSCamera.h"
+#include "core/FrameClock.hpp"
 #include "core/helpers.hpp"
 #include "core/ShaderProgramManager.hpp"
 
@@ -10,6 +11,7 @@
 #include <tinyfiledialogs.h>
 
 #include <clocale>
+#include <cstdlib>
 #include <stdexcept>
 
 edaf80::Assignment5::Assignment5(WindowManager& windowManager) :
@@ -67,7 +69,7 @@ edaf80::Assignment5::run()
 	glEnable(GL_DEPTH_TEST);
 
 
-	auto lastTime = std::chrono::high_resolution_clock::now();
+	FrameClock frame_clock(mWindowManager.GetFrameClockSettings());
 
 	bool show_logs = true;
 	bool show_gui = true;
@@ -77,9 +79,8 @@ edaf80::Assignment5::run()
 	float basis_length_scale = 1.0f;
 
 	while (!glfwWindowShouldClose(window)) {
-		auto const nowTime = std::chrono::high_resolution_clock::now();
-		auto const deltaTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(nowTime - lastTime);
-		lastTime = nowTime;
+		frame_clock.Tick();
+		auto const deltaTimeUs = frame_clock.GetFrameDuration();
 
 		auto& io = ImGui::GetIO();
 		inputHandler.SetUICapture(io.WantCaptureMouse, io.WantCaptureKeyboard);
@@ -153,20 +154,23 @@ edaf80::Assignment5::run()
 			Log::View::Render();
 		mWindowManager.RenderImGuiFrame(show_gui);
 
-		glfwSwapBuffers(window);
+		mWindowManager.SwapBuffers(window);
 	}
 }
 
-int main()
+int main(int argc, char* argv[])
 {
 	std::setlocale(LC_ALL, "");
 
-	Bonobo framework;
+	Bonobo framework(argc, argv);
 
 	try {
 		edaf80::Assignment5 assignment5(framework.GetWindowManager());
 		assignment5.run();
 	} catch (std::runtime_error const& e) {
 		LogError(e.what());
+		return EXIT_FAILURE;
 	}
+
+	return framework.GetWindowManager().GetExitStatus();
 }
@@ -0,0 +1,474 @@
+#include "Benchmark.hpp"
+
+#include "core/Log.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+	glm::vec3 catmullRom(glm::vec3 const& p0, glm::vec3 const& p1, glm::vec3 const& p2, glm::vec3 const& p3, float x)
+	{
+		auto const x2 = x * x;
+		auto const x3 = x2 * x;
+		return 0.5f * ((2.0f * p1)
+		             + (-p0 + p2) * x
+		             + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * x2
+		             + (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * x3);
+	}
+
+	struct Summary {
+		float mean{ 0.0f };
+		float min{ 0.0f };
+		float p50{ 0.0f };
+		float p90{ 0.0f };
+		float p95{ 0.0f };
+		float p99{ 0.0f };
+		float max{ 0.0f };
+	};
+
+	// Percentiles use the nearest-rank method.
+	Summary summarise(std::vector<float> values)
+	{
+		Summary summary;
+		if (values.empty())
+			return summary;
+
+		std::sort(values.begin(), values.end());
+		auto const percentile = [&values](float p){
+			auto const rank = static_cast<size_t>(std::ceil(p / 100.0f * static_cast<float>(values.size())));
+			return values[std::min(std::max(rank, size_t(1)), values.size()) - 1u];
+		};
+		double sum = 0.0;
+		for (auto const value : values)
+			sum += value;
+		summary.mean = static_cast<float>(sum / static_cast<double>(values.size()));
+		summary.min = values.front();
+		summary.p50 = percentile(50.0f);
+		summary.p90 = percentile(90.0f);
+		summary.p95 = percentile(95.0f);
+		summary.p99 = percentile(99.0f);
+		summary.max = values.back();
+		return summary;
+	}
+
+	void writeJsonString(std::ostream& stream, std::string const& value)
+	{
+		stream << '"';
+		for (auto const c : value) {
+			if (c == '"' || c == '\\')
+				stream << '\\' << c;
+			else if (static_cast<unsigned char>(c) < 0x20u)
+				stream << ' ';
+			else
+				stream << c;
+		}
+		stream << '"';
+	}
+
+	void writeJsonSummary(std::ostream& stream, Summary const& summary)
+	{
+		stream << "{ \"mean\": " << summary.mean
+		       << ", \"min\": " << summary.min
+		       << ", \"p50\": " << summary.p50
+		       << ", \"p90\": " << summary.p90
+		       << ", \"p95\": " << summary.p95
+		       << ", \"p99\": " << summary.p99
+		       << ", \"max\": " << summary.max << " }";
+	}
+}
+
+edan35::BenchmarkSettings
+edan35::parseBenchmarkSettings(int argc, char const* const argv[])
+{
+	auto const parse_frames_nb = [](char const* const value, unsigned int& frames_nb){
+		auto const parsed_value = std::strtol(value, nullptr, 10);
+		if (parsed_value >= 0)
+			frames_nb = static_cast<unsigned int>(parsed_value);
+		else
+			LogWarning("Invalid number of frames “%s”: keeping %u.", value, frames_nb);
+	};
+
+	BenchmarkSettings settings;
+	for (int i = 1; i < argc; ++i) {
+		char const* const argument = argv[i];
+		if (std::strncmp(argument, "--benchmark=", 12) == 0)
+			settings.camera_path_filename = argument + 12;
+		else if (std::strncmp(argument, "--benchmark-output=", 19) == 0)
+			settings.output_filename = argument + 19;
+		else if (std::strncmp(argument, "--warmup-frames=", 16) == 0)
+			parse_frames_nb(argument + 16, settings.warmup_frames_nb);
+		else if (std::strncmp(argument, "--measured-frames=", 18) == 0)
+			parse_frames_nb(argument + 18, settings.measured_frames_nb);
+	}
+	if (settings.measured_frames_nb == 0u) {
+		LogWarning("At least one frame has to be measured.");
+		settings.measured_frames_nb = 1u;
+	}
+
+	return settings;
+}
+
+bool
+edan35::CameraPath::Load(std::string const& filename)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) {
+		LogError("Failed to open camera path “%s”.", filename.c_str());
+		return false;
+	}
+
+	mKeyframes.clear();
+	std::string line;
+	for (size_t line_number = 1u; std::getline(file, line); ++line_number) {
+		auto const comment = line.find('#');
+		if (comment != std::string::npos)
+			line.erase(comment);
+
+		std::istringstream statement(line);
+		std::string keyword;
+		if (!(statement >> keyword))
+			continue;
+
+		bool is_valid = false;
+		if (keyword == "lights") {
+			int lights_nb = 0;
+			is_valid = static_cast<bool>(statement >> lights_nb);
+			if (is_valid && lights_nb < 1)
+				LogWarning("%s:%zu: at least one light is needed: ignoring “lights %d” and keeping %d.", filename.c_str(), line_number, lights_nb, mLightsNb);
+			else if (is_valid)
+				mLightsNb = lights_nb;
+		} else if (keyword == "animate_lights") {
+			int is_animated = 0;
+			is_valid = static_cast<bool>(statement >> is_animated);
+			mAreLightsAnimated = is_animated != 0;
+		} else if (keyword == "keyframe") {
+			Keyframe keyframe;
+			is_valid = static_cast<bool>(statement >> keyframe.time
+			                                       >> keyframe.position.x >> keyframe.position.y >> keyframe.position.z
+			                                       >> keyframe.target.x >> keyframe.target.y >> keyframe.target.z);
+			if (is_valid && !mKeyframes.empty() && keyframe.time <= mKeyframes.back().time) {
+				LogError("%s:%zu: keyframes have to be sorted by increasing time.", filename.c_str(), line_number);
+				return false;
+			}
+			if (is_valid)
+				mKeyframes.push_back(keyframe);
+		}
+		if (!is_valid) {
+			LogError("%s:%zu: invalid statement “%s”.", filename.c_str(), line_number, line.c_str());
+			return false;
+		}
+	}
+
+	if (mKeyframes.size() < 2u) {
+		LogError("Camera path “%s” needs at least two keyframes.", filename.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+void
+edan35::CameraPath::Evaluate(float time, glm::vec3& position, glm::vec3& target) const
+{
+	assert(mKeyframes.size() >= 2u);
+
+	time = glm::clamp(mKeyframes.front().time + time, mKeyframes.front().time, mKeyframes.back().time);
+	size_t segment = 0u;
+	while (segment + 2u < mKeyframes.size() && mKeyframes[segment + 1u].time <= time)
+		++segment;
+
+	// The end points are duplicated, so that the spline goes through all
+	// keyframes.
+	auto const& k0 = mKeyframes[segment > 0u ? segment - 1u : 0u];
+	auto const& k1 = mKeyframes[segment];
+	auto const& k2 = mKeyframes[segment + 1u];
+	auto const& k3 = mKeyframes[std::min(segment + 2u, mKeyframes.size() - 1u)];
+	auto const x = (time - k1.time) / (k2.time - k1.time);
+	position = catmullRom(k0.position, k1.position, k2.position, k3.position, x);
+	target = catmullRom(k0.target, k1.target, k2.target, k3.target, x);
+}
+
+float
+edan35::CameraPath::GetDuration() const
+{
+	return mKeyframes.empty() ? 0.0f : mKeyframes.back().time - mKeyframes.front().time;
+}
+
+int
+edan35::CameraPath::GetLightsNb() const
+{
+	return mLightsNb;
+}
+
+bool
+edan35::CameraPath::AreLightsAnimated() const
+{
+	return mAreLightsAnimated;
+}
+
+edan35::Benchmark::Benchmark(BenchmarkSettings const& settings) : mSettings(settings)
+{
+	if (!mCameraPath.Load(mSettings.camera_path_filename))
+		throw std::runtime_error("Failed to load the benchmark camera path.");
+
+	mFrames.reserve(mSettings.measured_frames_nb);
+	LogInfo("Benchmarking along “%s”: %u warm-up frames, then %u measured frames.",
+	        mSettings.camera_path_filename.c_str(), mSettings.warmup_frames_nb, mSettings.measured_frames_nb);
+}
+
+float
+edan35::Benchmark::GetPathTime() const
+{
+	if (mFrameIndex < mSettings.warmup_frames_nb)
+		return 0.0f;
+
+	// The last frames only collect the pending GPU times, and stay at the
+	// end of the path.
+	auto const measured_frame = std::min(mFrameIndex - mSettings.warmup_frames_nb, mSettings.measured_frames_nb - 1u);
+	auto const fraction = mSettings.measured_frames_nb > 1u
+	                    ? static_cast<float>(measured_frame) / static_cast<float>(mSettings.measured_frames_nb - 1u)
+	                    : 0.0f;
+	return fraction * mCameraPath.GetDuration();
+}
+
+edan35::CameraPath const&
+edan35::Benchmark::GetCameraPath() const
+{
+	return mCameraPath;
+}
+
+void
+edan35::Benchmark::EndFrame(float cpu_ms, float frame_ms, size_t executed_frames_nb, FrameGraph::FrameGpuTimes const& gpu_times)
+{
+	if (IsMeasuring()) {
+		FrameTimings frame;
+		frame.path_time = GetPathTime();
+		frame.cpu_ms = cpu_ms;
+		frame.frame_ms = frame_ms;
+		frame.graph_frame_index = executed_frames_nb - 1u;
+		if (GLTrace::IsEnabled()) {
+			auto const& gl_stats = GLTrace::GetLastFrameStats();
+			frame.gl_stats.calls_nb = gl_stats.calls_nb;
+			frame.gl_stats.draw_calls_nb = gl_stats.draw_calls_nb;
+			frame.gl_stats.triangles_nb = gl_stats.triangles_nb;
+			frame.gl_stats.state_binds_nb = gl_stats.state_binds_nb;
+			frame.gl_stats.uploaded_bytes = gl_stats.uploaded_bytes;
+			frame.gl_stats.driver_ms = gl_stats.driver_ms;
+		}
+		mFrames.push_back(frame);
+	}
+
+	if (gpu_times.is_valid) {
+		auto frame = std::find_if(mFrames.begin(), mFrames.end(), [&gpu_times](FrameTimings const& frame){
+			return frame.graph_frame_index == gpu_times.frame_index;
+		});
+		if (frame != mFrames.end() && !frame->has_gpu_times) {
+			frame->has_gpu_times = true;
+			frame->gpu_ms = 0.0f;
+			for (auto const& pass_time : gpu_times.pass_times_ms) {
+				auto name = std::find(mPassNames.begin(), mPassNames.end(), pass_time.first);
+				if (name == mPassNames.end())
+					name = mPassNames.insert(mPassNames.end(), pass_time.first);
+				auto const pass_index = static_cast<size_t>(name - mPassNames.begin());
+				if (frame->pass_gpu_ms.size() <= pass_index)
+					frame->pass_gpu_ms.resize(pass_index + 1u, -1.0f);
+				frame->pass_gpu_ms[pass_index] = pass_time.second;
+				frame->gpu_ms += pass_time.second;
+			}
+		}
+	}
+
+	++mFrameIndex;
+}
+
+bool
+edan35::Benchmark::IsDone() const
+{
+	return mFrameIndex >= mSettings.warmup_frames_nb + mSettings.measured_frames_nb + static_cast<unsigned int>(FrameGraph::timing_latency);
+}
+
+bool
+edan35::Benchmark::IsMeasuring() const
+{
+	return mFrameIndex >= mSettings.warmup_frames_nb
+	    && mFrameIndex < mSettings.warmup_frames_nb + mSettings.measured_frames_nb;
+}
+
+bool
+edan35::Benchmark::WriteResults(int width, int height) const
+{
+	LogSummary();
+
+	auto const csv_filename = mSettings.output_filename + ".csv";
+	auto const json_filename = mSettings.output_filename + ".json";
+	auto const has_written_csv = WriteCsv(csv_filename);
+	auto const has_written_json = WriteJson(json_filename, width, height);
+	if (has_written_csv && has_written_json)
+		LogInfo("Benchmark results written to “%s” and “%s”.", csv_filename.c_str(), json_filename.c_str());
+
+	return has_written_csv && has_written_json;
+}
+
+bool
+edan35::Benchmark::WriteCsv(std::string const& filename) const
+{
+	std::ofstream file(filename);
+	if (!file.is_open()) {
+		LogError("Failed to open “%s” for writing.", filename.c_str());
+		return false;
+	}
+
+	// Passes which did not run during a frame, and frames whose GPU times
+	// were never read back, are left empty.
+	file << "frame,path_time_s,frame_ms,cpu_ms,gpu_ms";
+	if (GLTrace::IsEnabled())
+		file << ",gl_calls,draw_calls,triangles,state_binds,uploaded_bytes,driver_ms";
+	for (auto const& name : mPassNames)
+		file << ",\"" << name << " [ms]\"";
+	file << '\n';
+	for (size_t i = 0; i < mFrames.size(); ++i) {
+		auto const& frame = mFrames[i];
+		file << i << ',' << frame.path_time << ',' << frame.frame_ms << ',' << frame.cpu_ms << ',';
+		if (frame.has_gpu_times)
+			file << frame.gpu_ms;
+		if (GLTrace::IsEnabled()) {
+			auto const& gl_stats = frame.gl_stats;
+			file << ',' << gl_stats.calls_nb << ',' << gl_stats.draw_calls_nb << ',' << gl_stats.triangles_nb
+			     << ',' << gl_stats.state_binds_nb << ',' << gl_stats.uploaded_bytes << ',' << gl_stats.driver_ms;
+		}
+		for (size_t pass = 0; pass < mPassNames.size(); ++pass) {
+			file << ',';
+			if (pass < frame.pass_gpu_ms.size() && frame.pass_gpu_ms[pass] >= 0.0f)
+				file << frame.pass_gpu_ms[pass];
+		}
+		file << '\n';
+	}
+
+	return static_cast<bool>(file);
+}
+
+bool
+edan35::Benchmark::WriteJson(std::string const& filename, int width, int height) const
+{
+	std::ofstream file(filename);
+	if (!file.is_open()) {
+		LogError("Failed to open “%s” for writing.", filename.c_str());
+		return false;
+	}
+
+	std::vector<float> frame_ms, cpu_ms, gpu_ms, driver_ms;
+	for (auto const& frame : mFrames) {
+		frame_ms.push_back(frame.frame_ms);
+		cpu_ms.push_back(frame.cpu_ms);
+		if (frame.has_gpu_times)
+			gpu_ms.push_back(frame.gpu_ms);
+		driver_ms.push_back(frame.gl_stats.driver_ms);
+	}
+
+	file << "{\n";
+	file << "  \"camera_path\": ";
+	writeJsonString(file, mSettings.camera_path_filename);
+	file << ",\n";
+	file << "  \"width\": " << width << ",\n";
+	file << "  \"height\": " << height << ",\n";
+	file << "  \"warmup_frames\": " << mSettings.warmup_frames_nb << ",\n";
+	file << "  \"measured_frames\": " << mFrames.size() << ",\n";
+	file << "  \"summary\": {\n";
+	file << "    \"frame_ms\": ";
+	writeJsonSummary(file, summarise(frame_ms));
+	file << ",\n    \"cpu_ms\": ";
+	writeJsonSummary(file, summarise(cpu_ms));
+	file << ",\n    \"gpu_ms\": ";
+	writeJsonSummary(file, summarise(gpu_ms));
+	if (GLTrace::IsEnabled()) {
+		file << ",\n    \"driver_ms\": ";
+		writeJsonSummary(file, summarise(driver_ms));
+	}
+	file << "\n  },\n";
+	file << "  \"frames\": [\n";
+	for (size_t i = 0; i < mFrames.size(); ++i) {
+		auto const& frame = mFrames[i];
+		file << "    { \"path_time_s\": " << frame.path_time
+		     << ", \"frame_ms\": " << frame.frame_ms
+		     << ", \"cpu_ms\": " << frame.cpu_ms;
+		if (frame.has_gpu_times) {
+			file << ", \"gpu_ms\": " << frame.gpu_ms << ", \"passes_gpu_ms\": {";
+			bool is_first = true;
+			for (size_t pass = 0; pass < frame.pass_gpu_ms.size(); ++pass) {
+				if (frame.pass_gpu_ms[pass] < 0.0f)
+					continue;
+				file << (is_first ? " " : ", ");
+				writeJsonString(file, mPassNames[pass]);
+				file << ": " << frame.pass_gpu_ms[pass];
+				is_first = false;
+			}
+			file << " }";
+		}
+		if (GLTrace::IsEnabled()) {
+			auto const& gl_stats = frame.gl_stats;
+			file << ", \"gl\": { \"calls\": " << gl_stats.calls_nb
+			     << ", \"draw_calls\": " << gl_stats.draw_calls_nb
+			     << ", \"triangles\": " << gl_stats.triangles_nb
+			     << ", \"state_binds\": " << gl_stats.state_binds_nb
+			     << ", \"uploaded_bytes\": " << gl_stats.uploaded_bytes
+			     << ", \"driver_ms\": " << gl_stats.driver_ms << " }";
+		}
+		file << " }" << (i + 1u < mFrames.size() ? ",\n" : "\n");
+	}
+	file << "  ]\n";
+	file << "}\n";
+
+	return static_cast<bool>(file);
+}
+
+void
+edan35::Benchmark::LogSummary() const
+{
+	std::vector<float> frame_ms, cpu_ms, gpu_ms;
+	size_t missing_gpu_times_nb = 0u;
+	for (auto const& frame : mFrames) {
+		frame_ms.push_back(frame.frame_ms);
+		cpu_ms.push_back(frame.cpu_ms);
+		if (frame.has_gpu_times)
+			gpu_ms.push_back(frame.gpu_ms);
+		else
+			++missing_gpu_times_nb;
+	}
+
+	LogInfo("Benchmark summary over %zu frames [ms]:", mFrames.size());
+	std::array<std::pair<char const*, Summary>, 3> const summaries{
+		std::make_pair("Frame", summarise(frame_ms)),
+		std::make_pair("CPU", summarise(cpu_ms)),
+		std::make_pair("GPU", summarise(gpu_ms))
+	};
+	for (auto const& summary : summaries) {
+		auto const& s = summary.second;
+		LogInfo("\t%-6s mean %7.3f  min %7.3f  p50 %7.3f  p90 %7.3f  p95 %7.3f  p99 %7.3f  max %7.3f",
+		        summary.first, s.mean, s.min, s.p50, s.p90, s.p95, s.p99, s.max);
+	}
+	if (GLTrace::IsEnabled() && !mFrames.empty()) {
+		std::vector<float> driver_ms;
+		double draw_calls_nb = 0.0, triangles_nb = 0.0;
+		for (auto const& frame : mFrames) {
+			driver_ms.push_back(frame.gl_stats.driver_ms);
+			draw_calls_nb += static_cast<double>(frame.gl_stats.draw_calls_nb);
+			triangles_nb += static_cast<double>(frame.gl_stats.triangles_nb);
+		}
+		auto const s = summarise(driver_ms);
+		LogInfo("\t%-6s mean %7.3f  min %7.3f  p50 %7.3f  p90 %7.3f  p95 %7.3f  p99 %7.3f  max %7.3f",
+		        "Driver", s.mean, s.min, s.p50, s.p90, s.p95, s.p99, s.max);
+		LogInfo("\tOn average, %.0f draw calls and %.0f triangles per frame.",
+		        draw_calls_nb / static_cast<double>(mFrames.size()), triangles_nb / static_cast<double>(mFrames.size()));
+	}
+	if (missing_gpu_times_nb != 0u)
+		LogWarning("The GPU times of %zu frames were not ready in time, and are missing.", missing_gpu_times_nb);
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "core/FrameGraph.hpp"
+#include "core/GLTrace.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace edan35
+{
+	//! \brief Settings of the benchmark mode, extracted from the command
+	//!        line.
+	struct BenchmarkSettings
+	{
+		std::string camera_path_filename;        //!< empty when not benchmarking
+		std::string output_filename{ "benchmark" }; //!< ".csv" and ".json" get appended
+		unsigned int warmup_frames_nb{ 60u };
+		unsigned int measured_frames_nb{ 600u };
+	};
+
+	//! \brief Extract the benchmark settings from the command line.
+	//!
+	//! The recognised arguments are `--benchmark=CAMERA_PATH`,
+	//! `--benchmark-output=FILENAME`, `--warmup-frames=N` and
+	//! `--measured-frames=M`; other arguments are ignored.
+	BenchmarkSettings parseBenchmarkSettings(int argc, char const* const argv[]);
+
+	//! \brief Camera path along which the benchmark flies, along with the
+	//!        light settings to use.
+	//!
+	//! The file is made of one statement per line, `#` starting a comment:
+	//!
+	//!     lights <number of lights>
+	//!     animate_lights <0 or 1>
+	//!     keyframe <time in s> <position x y z> <target x y z>
+	//!
+	//! Positions and targets are in scene units; keyframes are sorted by
+	//! time, and at least two of them are needed. The camera moves along a
+	//! Catmull-Rom spline going through all keyframes.
+	class CameraPath {
+	public:
+		struct Keyframe {
+			float time{ 0.0f };
+			glm::vec3 position{ 0.0f };
+			glm::vec3 target{ 0.0f };
+		};
+
+		//! \brief Load a path from a file, logging the errors found.
+		//!
+		//! @return whether the file could be read and was valid
+		bool Load(std::string const& filename);
+
+		//! \brief Camera placement at a given time since the first
+		//!        keyframe, clamped to the duration of the path.
+		void Evaluate(float time, glm::vec3& position, glm::vec3& target) const;
+
+		float GetDuration() const;
+		int GetLightsNb() const;
+
+		//! \brief Whether the lights rotate with the time along the path,
+		//!        or stay at their initial placement.
+		bool AreLightsAnimated() const;
+
+	private:
+		std::vector<Keyframe> mKeyframes;
+		int mLightsNb{ 4 };
+		bool mAreLightsAnimated{ true };
+	};
+
+	//! \brief Repeatable measurement of the renderer along a camera path.
+	//!
+	//! The benchmark renders `warmup_frames_nb` frames at the start of the
+	//! path, then `measured_frames_nb` frames evenly spread along it. For
+	//! each measured frame, the CPU time and the GPU time of each frame
+	//! graph pass are recorded. As the GPU times are read back a few frames
+	//! later, `FrameGraph::timing_latency` additional frames are rendered
+	//! at the end of the path to collect the last ones. In builds tracing
+	//! the GL calls, the statistics of each frame are recorded too.
+	class Benchmark {
+	public:
+		//! \brief Load the camera path; throws a `std::runtime_error` if
+		//!        it can not be loaded.
+		explicit Benchmark(BenchmarkSettings const& settings);
+
+		//! \brief Time along the camera path of the frame about to be
+		//!        rendered.
+		float GetPathTime() const;
+
+		CameraPath const& GetCameraPath() const;
+
+		//! \brief Record the frame which was just rendered.
+		//!
+		//! @param [in] cpu_ms CPU time spent issuing the frame
+		//! @param [in] frame_ms time since the start of the previous frame
+		//! @param [in] executed_frames_nb number of frames run by the
+		//!             frame graph so far, including this one
+		//! @param [in] gpu_times latest GPU times read back by the frame
+		//!             graph, matched to the frame they belong to
+		void EndFrame(float cpu_ms, float frame_ms, size_t executed_frames_nb, FrameGraph::FrameGpuTimes const& gpu_times);
+
+		bool IsDone() const;
+
+		//! \brief Write the per-frame timings to `<output>.csv` and
+		//!        `<output>.json`, and log a summary of them.
+		//!
+		//! @param [in] width width the frames were rendered at
+		//! @param [in] height height the frames were rendered at
+		//! @return whether all files could be written
+		bool WriteResults(int width, int height) const;
+
+	private:
+		struct FrameTimings {
+			float path_time{ 0.0f };
+			float cpu_ms{ 0.0f };
+			float frame_ms{ 0.0f };
+			size_t graph_frame_index{ 0u };
+			bool has_gpu_times{ false };
+			float gpu_ms{ 0.0f }; //!< sum over all passes
+			std::vector<float> pass_gpu_ms; //!< indexed like mPassNames; negative if the pass did not run
+			GLTrace::FrameStats gl_stats;   //!< without the calls per entry point; only when tracing
+		};
+
+		bool IsMeasuring() const;
+		bool WriteCsv(std::string const& filename) const;
+		bool WriteJson(std::string const& filename, int width, int height) const;
+		void LogSummary() const;
+
+		BenchmarkSettings mSettings;
+		CameraPath mCameraPath;
+		unsigned int mFrameIndex{ 0u };
+		std::vector<FrameTimings> mFrames;
+		std::vector<std::string> mPassNames; //!< all passes seen, in order of first appearance
+	};
+}
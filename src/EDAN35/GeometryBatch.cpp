@@ -0,0 +1,312 @@
+#include "GeometryBatch.hpp"
+
+#include "core/Log.h"
+#include "core/opengl.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <numeric>
+
+namespace
+{
+	constexpr std::array<bonobo::shader_bindings, 5> batched_attributes = {
+		bonobo::shader_bindings::vertices,
+		bonobo::shader_bindings::normals,
+		bonobo::shader_bindings::texcoords,
+		bonobo::shader_bindings::tangents,
+		bonobo::shader_bindings::binormals
+	};
+
+	// All attributes loaded by `bonobo::loadObjects()` are made of three
+	// floats, and stored one after the other in the mesh's buffer.
+	constexpr GLsizeiptr attribute_size = 3 * sizeof(GLfloat);
+}
+
+constexpr GLuint edan35::GeometryBatch::draw_id_location;
+constexpr GLuint edan35::GeometryBatch::draw_data_binding;
+
+bool
+edan35::GeometryBatch::IsSupported()
+{
+	return GLAD_GL_VERSION_4_3 != 0;
+}
+
+edan35::GeometryBatch::GeometryBatch(std::vector<bonobo::mesh_data> const& meshes)
+{
+	assert(IsSupported());
+
+	//
+	// Find out where each mesh's attributes are located, from its VAO.
+	//
+	struct MeshLayout
+	{
+		std::array<GLintptr, batched_attributes.size()> offsets;
+		std::array<bool, batched_attributes.size()> is_enabled;
+		GLsizeiptr vertices_nb{ 0 };
+	};
+	std::vector<MeshLayout> layouts(meshes.size());
+
+	mMeshCommands.resize(meshes.size(), DrawElementsIndirectCommand{ 0u, 0u, 0u, 0, 0u });
+	mDrawData.resize(meshes.size());
+
+	GLuint total_vertices_nb = 0u;
+	GLuint total_indices_nb = 0u;
+	for (size_t i = 0; i < meshes.size(); ++i) {
+		auto const& mesh = meshes[i];
+		if (mesh.drawing_mode != GL_TRIANGLES || mesh.ibo == 0u) {
+			LogWarning("Mesh \"%s\" is not made of indexed triangles: it can not be batched.", mesh.name.c_str());
+			continue;
+		}
+
+		auto& layout = layouts[i];
+		size_t enabled_attributes_nb = 0u;
+		glBindVertexArray(mesh.vao);
+		for (size_t a = 0; a < batched_attributes.size(); ++a) {
+			auto const index = static_cast<GLuint>(batched_attributes[a]);
+			GLint is_enabled = GL_FALSE;
+			glGetVertexAttribiv(index, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &is_enabled);
+			layout.is_enabled[a] = is_enabled == GL_TRUE;
+			if (!layout.is_enabled[a])
+				continue;
+
+			GLvoid* pointer = nullptr;
+			glGetVertexAttribPointerv(index, GL_VERTEX_ATTRIB_ARRAY_POINTER, &pointer);
+			layout.offsets[a] = static_cast<GLintptr>(reinterpret_cast<std::uintptr_t>(pointer));
+			++enabled_attributes_nb;
+		}
+		glBindVertexArray(0u);
+
+		GLint bo_size = 0;
+		glBindBuffer(GL_COPY_READ_BUFFER, mesh.bo);
+		glGetBufferParameteriv(GL_COPY_READ_BUFFER, GL_BUFFER_SIZE, &bo_size);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0u);
+		layout.vertices_nb = static_cast<GLsizeiptr>(bo_size) / (attribute_size * static_cast<GLsizeiptr>(enabled_attributes_nb));
+
+		auto& command = mMeshCommands[i];
+		command.count = static_cast<GLuint>(mesh.indices_nb);
+		command.instance_count = 1u;
+		command.first_index = total_indices_nb;
+		command.base_vertex = static_cast<GLint>(total_vertices_nb);
+		command.base_instance = static_cast<GLuint>(i);
+
+		total_vertices_nb += static_cast<GLuint>(layout.vertices_nb);
+		total_indices_nb += command.count;
+	}
+
+	//
+	// Copy the geometry of all meshes into the shared buffers; each
+	// attribute gets its own block, and missing ones are left to zero.
+	//
+	auto const attribute_block_size = static_cast<GLsizeiptr>(total_vertices_nb) * attribute_size;
+	std::vector<std::uint8_t> const zeroes(static_cast<size_t>(attribute_block_size * static_cast<GLsizeiptr>(batched_attributes.size())), 0u);
+
+	glGenVertexArrays(1, &mVao);
+	glBindVertexArray(mVao);
+
+	glGenBuffers(1, &mVertexBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(zeroes.size()), zeroes.data(), GL_STATIC_DRAW);
+
+	glGenBuffers(1, &mIndexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(total_indices_nb) * static_cast<GLsizeiptr>(sizeof(GLuint)), nullptr, GL_STATIC_DRAW);
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, mVertexBuffer);
+	for (size_t i = 0; i < meshes.size(); ++i) {
+		auto const& command = mMeshCommands[i];
+		if (command.count == 0u)
+			continue;
+
+		auto const& mesh = meshes[i];
+		auto const& layout = layouts[i];
+		auto const vertices_size = layout.vertices_nb * attribute_size;
+
+		glBindBuffer(GL_COPY_READ_BUFFER, mesh.bo);
+		for (size_t a = 0; a < batched_attributes.size(); ++a) {
+			if (!layout.is_enabled[a])
+				continue;
+			auto const destination = static_cast<GLintptr>(a) * attribute_block_size + static_cast<GLintptr>(command.base_vertex) * attribute_size;
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, layout.offsets[a], destination, vertices_size);
+		}
+
+		glBindBuffer(GL_COPY_READ_BUFFER, mesh.ibo);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_ELEMENT_ARRAY_BUFFER, 0,
+		                    static_cast<GLintptr>(command.first_index) * static_cast<GLintptr>(sizeof(GLuint)),
+		                    static_cast<GLsizeiptr>(command.count) * static_cast<GLsizeiptr>(sizeof(GLuint)));
+	}
+	glBindBuffer(GL_COPY_READ_BUFFER, 0u);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0u);
+
+	for (size_t a = 0; a < batched_attributes.size(); ++a) {
+		auto const index = static_cast<GLuint>(batched_attributes[a]);
+		glEnableVertexAttribArray(index);
+		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<GLvoid const*>(static_cast<GLintptr>(a) * attribute_block_size));
+	}
+
+	//
+	// The draw ID is fetched once per instance, starting from the base
+	// instance of each command.
+	//
+	std::vector<GLuint> draw_ids(meshes.size());
+	std::iota(draw_ids.begin(), draw_ids.end(), 0u);
+	glGenBuffers(1, &mDrawIdBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, mDrawIdBuffer);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(draw_ids.size() * sizeof(GLuint)), draw_ids.data(), GL_STATIC_DRAW);
+	glEnableVertexAttribArray(draw_id_location);
+	glVertexAttribIPointer(draw_id_location, 1, GL_UNSIGNED_INT, 0, reinterpret_cast<GLvoid const*>(0x0));
+	glVertexAttribDivisor(draw_id_location, 1u);
+
+	glBindVertexArray(0u);
+	glBindBuffer(GL_ARRAY_BUFFER, 0u);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0u);
+
+	glGenBuffers(1, &mDrawDataBuffer);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, mDrawDataBuffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(mDrawData.size() * sizeof(DrawData)), mDrawData.data(), GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0u);
+
+	glGenBuffers(1, &mIndirectBuffer);
+
+	utils::opengl::debug::nameObject(GL_VERTEX_ARRAY, mVao, "Geometry batch VAO");
+	utils::opengl::debug::nameObject(GL_BUFFER, mVertexBuffer, "Geometry batch VBO");
+	utils::opengl::debug::nameObject(GL_BUFFER, mIndexBuffer, "Geometry batch IBO");
+	utils::opengl::debug::nameObject(GL_BUFFER, mDrawIdBuffer, "Geometry batch draw IDs");
+	utils::opengl::debug::nameObject(GL_BUFFER, mDrawDataBuffer, "Geometry batch draw data");
+
+	LogInfo("Batched %u vertices and %u indices from %zu meshes.", total_vertices_nb, total_indices_nb, meshes.size());
+}
+
+edan35::GeometryBatch::~GeometryBatch()
+{
+	glDeleteBuffers(1, &mIndirectBuffer);
+	glDeleteBuffers(1, &mDrawDataBuffer);
+	glDeleteBuffers(1, &mDrawIdBuffer);
+	glDeleteBuffers(1, &mIndexBuffer);
+	glDeleteBuffers(1, &mVertexBuffer);
+	glDeleteVertexArrays(1, &mVao);
+}
+
+bool
+edan35::GeometryBatch::IsBatched(size_t mesh_index) const
+{
+	return mMeshCommands[mesh_index].count != 0u;
+}
+
+edan35::DrawList
+edan35::GeometryBatch::CreateDrawList(std::vector<size_t> const& mesh_indices)
+{
+	assert(mCommands.size() == mPersistentCommandsNb && "Draw lists should be created before any transient ones.");
+
+	DrawList list;
+	list.first_command = mCommands.size();
+	for (auto const mesh_index : mesh_indices) {
+		if (!IsBatched(mesh_index))
+			continue;
+		mCommands.push_back(mMeshCommands[mesh_index]);
+	}
+	list.commands_nb = static_cast<GLsizei>(mCommands.size() - list.first_command);
+	mPersistentCommandsNb = mCommands.size();
+
+	UploadCommands(list.first_command);
+
+	return list;
+}
+
+edan35::DrawList
+edan35::GeometryBatch::CreateTransientDrawList(DrawList const& list, std::vector<std::uint8_t> const& is_mesh_visible)
+{
+	assert(is_mesh_visible.size() == mMeshCommands.size());
+
+	DrawList transient_list;
+	transient_list.first_command = mCommands.size();
+	for (size_t i = list.first_command; i < list.first_command + static_cast<size_t>(list.commands_nb); ++i) {
+		// The base instance of a command is the index of its mesh.
+		if (is_mesh_visible[mCommands[i].base_instance] != 0u)
+			mCommands.push_back(mCommands[i]);
+	}
+	transient_list.commands_nb = static_cast<GLsizei>(mCommands.size() - transient_list.first_command);
+
+	if (transient_list.commands_nb != 0)
+		UploadCommands(transient_list.first_command);
+
+	return transient_list;
+}
+
+void
+edan35::GeometryBatch::ResetTransientDrawLists()
+{
+	mCommands.resize(mPersistentCommandsNb);
+}
+
+size_t
+edan35::GeometryBatch::GetCommandsNb() const
+{
+	return mCommands.size();
+}
+
+GLuint
+edan35::GeometryBatch::GetIndirectBuffer() const
+{
+	return mIndirectBuffer;
+}
+
+void
+edan35::GeometryBatch::SetTransform(size_t mesh_index, glm::mat4 const& vertex_model_to_world)
+{
+	auto& data = mDrawData[mesh_index];
+	data.vertex_model_to_world = vertex_model_to_world;
+	data.normal_model_to_world = glm::transpose(glm::inverse(vertex_model_to_world));
+	UploadDrawData(mesh_index);
+}
+
+void
+edan35::GeometryBatch::SetMaterialIndex(size_t mesh_index, std::uint32_t material_index)
+{
+	mDrawData[mesh_index].material_index = material_index;
+	UploadDrawData(mesh_index);
+}
+
+void
+edan35::GeometryBatch::Draw(DrawList const& list) const
+{
+	if (list.commands_nb == 0)
+		return;
+
+	glBindVertexArray(mVao);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mIndirectBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, draw_data_binding, mDrawDataBuffer);
+
+	glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+	                            reinterpret_cast<GLvoid const*>(list.first_command * sizeof(DrawElementsIndirectCommand)),
+	                            list.commands_nb, 0);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, draw_data_binding, 0u);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0u);
+	glBindVertexArray(0u);
+}
+
+void
+edan35::GeometryBatch::UploadDrawData(size_t mesh_index) const
+{
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, mDrawDataBuffer);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, static_cast<GLintptr>(mesh_index * sizeof(DrawData)), sizeof(DrawData), mDrawData.data() + mesh_index);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0u);
+}
+
+void
+edan35::GeometryBatch::UploadCommands(size_t first_command)
+{
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mIndirectBuffer);
+	if (mCommands.size() > mIndirectBufferCapacity) {
+		// Grow geometrically, so that transient draw lists only cause a
+		// reallocation during the first frames.
+		mIndirectBufferCapacity = std::max(mCommands.size(), 2u * mIndirectBufferCapacity);
+		glBufferData(GL_DRAW_INDIRECT_BUFFER, static_cast<GLsizeiptr>(mIndirectBufferCapacity * sizeof(DrawElementsIndirectCommand)), nullptr, GL_DYNAMIC_DRAW);
+		first_command = 0u;
+	}
+	glBufferSubData(GL_DRAW_INDIRECT_BUFFER, static_cast<GLintptr>(first_command * sizeof(DrawElementsIndirectCommand)),
+	                static_cast<GLsizeiptr>((mCommands.size() - first_command) * sizeof(DrawElementsIndirectCommand)),
+	                mCommands.data() + first_command);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0u);
+}
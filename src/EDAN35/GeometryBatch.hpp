@@ -0,0 +1,137 @@
+#pragma once
+
+#include "core/helpers.hpp"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+
+namespace edan35
+{
+	//! \brief Per-draw data read by the shaders of the indirect path,
+	//!        indexed by the draw ID; it follows the std430 layout.
+	struct DrawData
+	{
+		glm::mat4 vertex_model_to_world = glm::mat4(1.0f);
+		glm::mat4 normal_model_to_world = glm::mat4(1.0f);
+		std::uint32_t material_index{ 0u };
+		std::uint32_t padding[3]{ 0u, 0u, 0u };
+	};
+
+	//! \brief Contiguous range of commands in the indirect buffer of a
+	//!        `GeometryBatch`, submitted with a single draw call.
+	struct DrawList
+	{
+		size_t first_command{ 0u };
+		GLsizei commands_nb{ 0 };
+	};
+
+	//! \brief Merge a set of meshes into shared vertex and index buffers,
+	//!        so that any subset of them can be drawn with a single
+	//!        `glMultiDrawElementsIndirect()` call.
+	//!
+	//! The draw ID of each command (the index of its mesh) is passed to the
+	//! vertex shader as the per-instance attribute at location
+	//! `draw_id_location`, through the command's base instance; it is used
+	//! to index the `DrawData` shader storage buffer, bound at
+	//! `draw_data_binding`.
+	//!
+	//! Requires OpenGL 4.3; see `IsSupported()`.
+	class GeometryBatch {
+	public:
+		static constexpr GLuint draw_id_location = 5u;
+		static constexpr GLuint draw_data_binding = 0u;
+
+		//! \brief Whether the current context supports the features
+		//!        needed by the batch.
+		static bool IsSupported();
+
+		//! \brief Copy the geometry of the meshes into the batch.
+		//!
+		//! Only indexed triangle meshes can be batched; other meshes are
+		//! skipped, with a warning.
+		//!
+		//! @param [in] meshes meshes to merge; they are not modified and
+		//!             can be released afterwards.
+		explicit GeometryBatch(std::vector<bonobo::mesh_data> const& meshes);
+		~GeometryBatch();
+
+		GeometryBatch(GeometryBatch const&) = delete;
+		GeometryBatch& operator=(GeometryBatch const&) = delete;
+
+		//! \brief Whether a mesh was merged into the batch.
+		bool IsBatched(size_t mesh_index) const;
+
+		//! \brief Append one command per mesh to the indirect buffer, and
+		//!        return the range they span.
+		//!
+		//! @param [in] mesh_indices indices of the meshes, as given to the
+		//!             constructor; non-batched meshes are ignored.
+		DrawList CreateDrawList(std::vector<size_t> const& mesh_indices);
+
+		//! \brief Append the commands of a draw list whose meshes are
+		//!        visible, and return the range they span.
+		//!
+		//! Transient draw lists are meant to be created every frame, e.g.
+		//! after occlusion culling; they stay valid until the next call
+		//! to `ResetTransientDrawLists()`.
+		//!
+		//! @param [in] list draw list returned by `CreateDrawList()`
+		//! @param [in] is_mesh_visible one entry per mesh given to the
+		//!             constructor; meshes whose entry is 0 are skipped.
+		DrawList CreateTransientDrawList(DrawList const& list, std::vector<std::uint8_t> const& is_mesh_visible);
+
+		//! \brief Discard all transient draw lists.
+		void ResetTransientDrawLists();
+
+		//! \brief Number of commands currently in the indirect buffer,
+		//!        including those of the transient draw lists.
+		size_t GetCommandsNb() const;
+
+		//! \brief Buffer holding the commands of all draw lists, so that
+		//!        they can be modified on the GPU; commands follow the
+		//!        `DrawElementsIndirectCommand` layout.
+		GLuint GetIndirectBuffer() const;
+
+		void SetTransform(size_t mesh_index, glm::mat4 const& vertex_model_to_world);
+		void SetMaterialIndex(size_t mesh_index, std::uint32_t material_index);
+
+		//! \brief Submit all the commands of a draw list; the program to
+		//!        use should already be bound.
+		void Draw(DrawList const& list) const;
+
+	private:
+		struct DrawElementsIndirectCommand
+		{
+			GLuint count;
+			GLuint instance_count;
+			GLuint first_index;
+			GLint base_vertex;
+			GLuint base_instance;
+		};
+
+		void UploadDrawData(size_t mesh_index) const;
+		void UploadCommands(size_t first_command);
+
+		GLuint mVao{ 0u };
+		GLuint mVertexBuffer{ 0u };
+		GLuint mIndexBuffer{ 0u };
+		GLuint mDrawIdBuffer{ 0u };
+		GLuint mDrawDataBuffer{ 0u };
+		GLuint mIndirectBuffer{ 0u };
+
+		// One entry per mesh given to the constructor; `count` is zero for
+		// non-batched meshes.
+		std::vector<DrawElementsIndirectCommand> mMeshCommands;
+		std::vector<DrawData> mDrawData;
+
+		// Commands of the draw lists created by `CreateDrawList()`, followed
+		// by those of the transient draw lists.
+		std::vector<DrawElementsIndirectCommand> mCommands;
+		size_t mPersistentCommandsNb{ 0u };
+		size_t mIndirectBufferCapacity{ 0u }; //!< in commands
+	};
+}
@@ -0,0 +1,240 @@
+#include "HiZCuller.hpp"
+
+#include "core/opengl.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+	// Have to match the local sizes of the compute shaders.
+	constexpr GLuint pyramid_group_size = 8u;
+	constexpr GLuint cull_group_size = 64u;
+
+	GLuint groupsNb(GLint size, GLuint group_size)
+	{
+		return (static_cast<GLuint>(size) + group_size - 1u) / group_size;
+	}
+
+	// The bounds are stored as two vec4 per mesh; the w component of the
+	// minimum corner tells whether the bounds are valid.
+	struct GpuBounds
+	{
+		glm::vec4 min;
+		glm::vec4 max;
+	};
+}
+
+constexpr size_t edan35::HiZCuller::readback_latency;
+constexpr GLuint edan35::HiZCuller::commands_binding;
+constexpr GLuint edan35::HiZCuller::bounds_binding;
+constexpr GLuint edan35::HiZCuller::counters_binding;
+
+bool
+edan35::HiZCuller::IsSupported()
+{
+	return GLAD_GL_VERSION_4_3 != 0;
+}
+
+edan35::HiZCuller::HiZCuller(std::vector<glm::vec3> const& bounds_min, std::vector<glm::vec3> const& bounds_max,
+                             std::vector<std::uint8_t> const& is_bounded)
+{
+	assert(IsSupported());
+	assert(bounds_min.size() == bounds_max.size() && bounds_min.size() == is_bounded.size());
+
+	std::vector<GpuBounds> bounds(bounds_min.size());
+	for (size_t i = 0; i < bounds.size(); ++i) {
+		bounds[i].min = glm::vec4(bounds_min[i], is_bounded[i] != 0u ? 1.0f : 0.0f);
+		bounds[i].max = glm::vec4(bounds_max[i], 0.0f);
+	}
+
+	glGenBuffers(1, &mBoundsBuffer);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, mBoundsBuffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(bounds.size() * sizeof(GpuBounds)), bounds.data(), GL_STATIC_DRAW);
+	utils::opengl::debug::nameObject(GL_BUFFER, mBoundsBuffer, "Hi-Z culling bounds");
+
+	std::array<GLuint, 2> const zeroes{ 0u, 0u };
+	glGenBuffers(static_cast<GLsizei>(mCounterBuffers.size()), mCounterBuffers.data());
+	for (auto const buffer : mCounterBuffers) {
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(zeroes), zeroes.data(), GL_DYNAMIC_READ);
+		utils::opengl::debug::nameObject(GL_BUFFER, buffer, "Hi-Z culling counters");
+	}
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0u);
+	mCounterFences.fill(nullptr);
+}
+
+edan35::HiZCuller::~HiZCuller()
+{
+	for (auto const fence : mCounterFences)
+		if (fence != nullptr)
+			glDeleteSync(fence);
+	glDeleteBuffers(static_cast<GLsizei>(mCounterBuffers.size()), mCounterBuffers.data());
+	glDeleteTextures(1, &mPyramidTexture);
+	glDeleteBuffers(1, &mBoundsBuffer);
+}
+
+void
+edan35::HiZCuller::BuildPyramid(GLuint copy_program, GLuint downsample_program, GLuint depth_texture,
+                                glm::ivec2 const& render_size, glm::mat4 const& world_to_clip)
+{
+	glm::ivec2 depth_size(0);
+	glBindTexture(GL_TEXTURE_2D, depth_texture);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &depth_size.x);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &depth_size.y);
+	glBindTexture(GL_TEXTURE_2D, 0u);
+
+	if (depth_size != mPyramidSize) {
+		glDeleteTextures(1, &mPyramidTexture);
+		mPyramidSize = depth_size;
+		mPyramidLevelsNb = 1;
+		for (auto size = std::max(depth_size.x, depth_size.y); size > 1; size /= 2)
+			++mPyramidLevelsNb;
+
+		glGenTextures(1, &mPyramidTexture);
+		glBindTexture(GL_TEXTURE_2D, mPyramidTexture);
+		glTexStorage2D(GL_TEXTURE_2D, mPyramidLevelsNb, GL_R32F, mPyramidSize.x, mPyramidSize.y);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glBindTexture(GL_TEXTURE_2D, 0u);
+		utils::opengl::debug::nameObject(GL_TEXTURE, mPyramidTexture, "Hi-Z pyramid");
+	}
+
+	//
+	// Level 0 is a copy of the depth, where texels outside of the rendered
+	// area are pushed to the far plane.
+	//
+	glUseProgram(copy_program);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, depth_texture);
+	glUniform1i(glGetUniformLocation(copy_program, "depth_texture"), 0);
+	glUniform2i(glGetUniformLocation(copy_program, "render_size"), render_size.x, render_size.y);
+	glBindImageTexture(0, mPyramidTexture, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+	glDispatchCompute(groupsNb(mPyramidSize.x, pyramid_group_size), groupsNb(mPyramidSize.y, pyramid_group_size), 1u);
+	glBindTexture(GL_TEXTURE_2D, 0u);
+
+	//
+	// Each following level keeps the farthest depth of the texels it
+	// covers in the previous one.
+	//
+	glUseProgram(downsample_program);
+	auto level_size = mPyramidSize;
+	for (GLint level = 1; level < mPyramidLevelsNb; ++level) {
+		glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+
+		auto const source_size = level_size;
+		level_size = glm::max(level_size / 2, glm::ivec2(1));
+		glUniform2i(glGetUniformLocation(downsample_program, "source_size"), source_size.x, source_size.y);
+		glBindImageTexture(0, mPyramidTexture, level - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+		glBindImageTexture(1, mPyramidTexture, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+		glDispatchCompute(groupsNb(level_size.x, pyramid_group_size), groupsNb(level_size.y, pyramid_group_size), 1u);
+	}
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+
+	glBindImageTexture(1, 0u, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+	glBindImageTexture(0, 0u, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+	glUseProgram(0u);
+
+	mRenderSize = render_size;
+	mWorldToClip = world_to_clip;
+	mHasPyramid = true;
+}
+
+void
+edan35::HiZCuller::Invalidate()
+{
+	mHasPyramid = false;
+}
+
+bool
+edan35::HiZCuller::HasPyramid() const
+{
+	return mHasPyramid;
+}
+
+void
+edan35::HiZCuller::Cull(GLuint cull_program, GLuint indirect_buffer, size_t first_command, size_t commands_nb)
+{
+	if (!mHasPyramid || commands_nb == 0u)
+		return;
+
+	ReadBackStats();
+
+	auto const slot = mFrameIndex % readback_latency;
+	++mFrameIndex;
+
+	std::array<GLuint, 2> const zeroes{ 0u, 0u };
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, mCounterBuffers[slot]);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(zeroes), zeroes.data());
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0u);
+
+	glUseProgram(cull_program);
+	glUniform1ui(glGetUniformLocation(cull_program, "first_command"), static_cast<GLuint>(first_command));
+	glUniform1ui(glGetUniformLocation(cull_program, "commands_nb"), static_cast<GLuint>(commands_nb));
+	glUniformMatrix4fv(glGetUniformLocation(cull_program, "world_to_clip"), 1, GL_FALSE, glm::value_ptr(mWorldToClip));
+	glUniform2i(glGetUniformLocation(cull_program, "render_size"), mRenderSize.x, mRenderSize.y);
+	glUniform1i(glGetUniformLocation(cull_program, "max_level"), mPyramidLevelsNb - 1);
+	glUniform1i(glGetUniformLocation(cull_program, "pyramid_texture"), 0);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, mPyramidTexture);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, commands_binding, indirect_buffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, bounds_binding, mBoundsBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, counters_binding, mCounterBuffers[slot]);
+
+	glDispatchCompute(groupsNb(static_cast<GLint>(commands_nb), cull_group_size), 1u, 1u);
+
+	// The commands are consumed by the following indirect draws, and the
+	// counters read back a few frames later.
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+	mCounterFences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, counters_binding, 0u);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, bounds_binding, 0u);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, commands_binding, 0u);
+	glBindTexture(GL_TEXTURE_2D, 0u);
+	glUseProgram(0u);
+}
+
+edan35::HiZCuller::Stats const&
+edan35::HiZCuller::GetStats() const
+{
+	return mStats;
+}
+
+GLuint
+edan35::HiZCuller::GetPyramidTexture() const
+{
+	return mPyramidTexture;
+}
+
+void
+edan35::HiZCuller::ReadBackStats()
+{
+	// Read every slot whose results are available, from the oldest to the
+	// most recent one; the oldest slot is about to be reused, so its
+	// results are dropped if they are still not available.
+	auto const oldest_slot = mFrameIndex % readback_latency;
+	for (size_t i = 0; i < readback_latency; ++i) {
+		auto const slot = (oldest_slot + i) % readback_latency;
+		auto& fence = mCounterFences[slot];
+		if (fence == nullptr)
+			continue;
+
+		auto const status = glClientWaitSync(fence, 0, 0u);
+		if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+			std::array<GLuint, 2> counters{ 0u, 0u };
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, mCounterBuffers[slot]);
+			glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(counters), counters.data());
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0u);
+			mStats.tested_commands_nb = counters[0];
+			mStats.culled_commands_nb = counters[1];
+		} else if (slot != oldest_slot) {
+			continue;
+		}
+
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace edan35
+{
+	//! \brief GPU occlusion culling against a hierarchical depth buffer
+	//!        (Hi-Z) built from the previous frame's depth.
+	//!
+	//! At the end of a frame, `BuildPyramid()` reduces the depth buffer
+	//! into a mip pyramid where each texel holds the farthest depth of
+	//! the texels it covers. During the next frame, `Cull()` projects the
+	//! bounding box of each mesh with the previous frame's transform, and
+	//! compares its closest depth against the pyramid level at which the
+	//! box spans at most 2×2 texels; the instance count of the indirect
+	//! commands of hidden meshes is set to 0.
+	//!
+	//! As the pyramid comes from the previous frame, meshes getting
+	//! disoccluded by a fast camera motion can be missing for a frame;
+	//! boxes which were not entirely on screen in the previous frame are
+	//! always kept, as nothing is known about what was outside of it.
+	//!
+	//! Requires OpenGL 4.3; see `IsSupported()`.
+	class HiZCuller {
+	public:
+		//! \brief Number of frames after which the culling statistics are
+		//!        read back, so that reading them does not stall.
+		static constexpr size_t readback_latency = 3u;
+
+		// Have to match the bindings used by hiz_cull.comp.
+		static constexpr GLuint commands_binding = 0u;
+		static constexpr GLuint bounds_binding = 1u;
+		static constexpr GLuint counters_binding = 2u;
+
+		struct Stats {
+			GLuint tested_commands_nb{ 0u };
+			GLuint culled_commands_nb{ 0u };
+		};
+
+		//! \brief Whether the current context supports the features
+		//!        needed by the culler.
+		static bool IsSupported();
+
+		//! \brief Upload the bounding boxes of the meshes.
+		//!
+		//! @param [in] bounds_min world-space minimum corner of each mesh,
+		//!             indexed by the base instance of its commands
+		//! @param [in] bounds_max world-space maximum corner of each mesh
+		//! @param [in] is_bounded whether each mesh has valid bounds;
+		//!             meshes without are never culled.
+		HiZCuller(std::vector<glm::vec3> const& bounds_min, std::vector<glm::vec3> const& bounds_max,
+		          std::vector<std::uint8_t> const& is_bounded);
+		~HiZCuller();
+
+		HiZCuller(HiZCuller const&) = delete;
+		HiZCuller& operator=(HiZCuller const&) = delete;
+
+		//! \brief Build the pyramid from a depth buffer.
+		//!
+		//! @param [in] copy_program compute program copying the depth
+		//!             into the first level (hiz_copy_depth.comp)
+		//! @param [in] downsample_program compute program reducing a level
+		//!             into the next one (hiz_downsample.comp)
+		//! @param [in] depth_texture depth texture to read from; the
+		//!             pyramid is reallocated whenever its size changes.
+		//! @param [in] render_size size of the area of `depth_texture`
+		//!             which was rendered to; the rest is considered empty
+		//! @param [in] world_to_clip transform the depth was rendered with
+		void BuildPyramid(GLuint copy_program, GLuint downsample_program, GLuint depth_texture,
+		                  glm::ivec2 const& render_size, glm::mat4 const& world_to_clip);
+
+		//! \brief Forget the pyramid, e.g. when it was not rebuilt during
+		//!        the last frame; `Cull()` is a no-op until the next call
+		//!        to `BuildPyramid()`.
+		void Invalidate();
+
+		bool HasPyramid() const;
+
+		//! \brief Cull a range of indirect commands against the pyramid.
+		//!
+		//! Should be called at most once per frame.
+		//!
+		//! @param [in] cull_program compute program testing the commands
+		//!             (hiz_cull.comp)
+		//! @param [in] indirect_buffer buffer holding the commands, in the
+		//!             `DrawElementsIndirectCommand` layout; the instance
+		//!             count of each command gets overwritten.
+		//! @param [in] first_command index of the first command to test
+		//! @param [in] commands_nb number of commands to test
+		void Cull(GLuint cull_program, GLuint indirect_buffer, size_t first_command, size_t commands_nb);
+
+		//! \brief Statistics of the latest call to `Cull()` whose results
+		//!        are available.
+		Stats const& GetStats() const;
+
+		GLuint GetPyramidTexture() const;
+
+	private:
+		void ReadBackStats();
+
+		GLuint mBoundsBuffer{ 0u };
+		GLuint mPyramidTexture{ 0u };
+		glm::ivec2 mPyramidSize{ 0 };
+		GLint mPyramidLevelsNb{ 0 };
+		glm::ivec2 mRenderSize{ 0 };
+		glm::mat4 mWorldToClip{ 1.0f };
+		bool mHasPyramid{ false };
+
+		std::array<GLuint, readback_latency> mCounterBuffers;
+		std::array<GLsync, readback_latency> mCounterFences;
+		size_t mFrameIndex{ 0u };
+		Stats mStats;
+	};
+}
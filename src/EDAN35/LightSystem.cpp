@@ -0,0 +1,188 @@
+#include "LightSystem.hpp"
+
+#include "core/Log.h"
+
+#include <algorithm>
+#include <cassert>
+
+constexpr size_t edan35::LightSystem::max_lights_nb;
+
+edan35::LightSystem::LightSystem(GLuint uniform_buffer, glm::mat4 const& projection,
+                                 glm::mat4 const& offset, glm::mat4 const& volume_scale) :
+	mUniformBuffer(uniform_buffer), mProjection(projection),
+	mOffset(offset), mOffsetInverse(glm::inverse(offset)), mVolumeScale(volume_scale)
+{
+	mTransforms.reserve(max_lights_nb);
+	mColors.reserve(max_lights_nb);
+	mPositions.reserve(max_lights_nb);
+	mDirections.reserve(max_lights_nb);
+	mVolumeWorldMatrices.reserve(max_lights_nb);
+	mViewProjTransforms.reserve(max_lights_nb);
+	mIsDirty.reserve(max_lights_nb);
+}
+
+size_t
+edan35::LightSystem::Add(TRSTransformf const& transform, glm::vec3 const& color)
+{
+	if (mTransforms.size() >= max_lights_nb) {
+		LogWarning("The light system is full (%zu lights): the light was not added.", max_lights_nb);
+		return max_lights_nb;
+	}
+
+	mTransforms.push_back(transform);
+	mColors.push_back(color);
+	mPositions.emplace_back(0.0f);
+	mDirections.emplace_back(0.0f);
+	mVolumeWorldMatrices.emplace_back(1.0f);
+	mViewProjTransforms.emplace_back();
+	mIsDirty.push_back(0u);
+
+	auto const index = mTransforms.size() - 1u;
+	MarkDirty(index);
+	return index;
+}
+
+void
+edan35::LightSystem::Remove(size_t index)
+{
+	assert(index < mTransforms.size());
+
+	auto const last = mTransforms.size() - 1u;
+	if (index != last) {
+		mTransforms[index] = mTransforms[last];
+		mColors[index] = mColors[last];
+		mPositions[index] = mPositions[last];
+		mDirections[index] = mDirections[last];
+		mVolumeWorldMatrices[index] = mVolumeWorldMatrices[last];
+		mViewProjTransforms[index] = mViewProjTransforms[last];
+		mIsDirty[index] = mIsDirty[last];
+
+		// The derived properties are still valid, but the GPU copy at
+		// `index` now needs to be updated.
+		MarkDirty(index);
+	}
+
+	mTransforms.pop_back();
+	mColors.pop_back();
+	mPositions.pop_back();
+	mDirections.pop_back();
+	mVolumeWorldMatrices.pop_back();
+	mViewProjTransforms.pop_back();
+	mIsDirty.pop_back();
+
+	mDirtyEnd = std::min(mDirtyEnd, mTransforms.size());
+	if (mDirtyBegin >= mDirtyEnd)
+		mDirtyBegin = mDirtyEnd = 0u;
+}
+
+size_t
+edan35::LightSystem::GetLightsNb() const
+{
+	return mTransforms.size();
+}
+
+void
+edan35::LightSystem::SetTransform(size_t index, TRSTransformf const& transform)
+{
+	mTransforms[index] = transform;
+	MarkDirty(index);
+}
+
+TRSTransformf const&
+edan35::LightSystem::GetTransform(size_t index) const
+{
+	return mTransforms[index];
+}
+
+void
+edan35::LightSystem::SetColor(size_t index, glm::vec3 const& color)
+{
+	// Colours are passed as uniforms rather than through the uniform
+	// buffer, so there is nothing to recompute nor upload.
+	mColors[index] = color;
+}
+
+glm::vec3 const&
+edan35::LightSystem::GetColor(size_t index) const
+{
+	return mColors[index];
+}
+
+glm::vec3 const&
+edan35::LightSystem::GetPosition(size_t index) const
+{
+	return mPositions[index];
+}
+
+glm::vec3 const&
+edan35::LightSystem::GetDirection(size_t index) const
+{
+	return mDirections[index];
+}
+
+glm::mat4 const&
+edan35::LightSystem::GetVolumeWorldMatrix(size_t index) const
+{
+	return mVolumeWorldMatrices[index];
+}
+
+edan35::ViewProjTransforms const&
+edan35::LightSystem::GetViewProjTransforms(size_t index) const
+{
+	return mViewProjTransforms[index];
+}
+
+void
+edan35::LightSystem::Update()
+{
+	mLastUploadedLightsNb = 0u;
+	if (mDirtyBegin >= mDirtyEnd)
+		return;
+
+	for (size_t i = mDirtyBegin; i < mDirtyEnd; ++i) {
+		if (!mIsDirty[i])
+			continue;
+
+		auto const& transform = mTransforms[i];
+		auto const light_world_matrix = transform.GetMatrix() * mOffset;
+		auto const light_view_matrix = mOffsetInverse * transform.GetMatrixInverse();
+		auto const light_world_to_clip_matrix = mProjection * light_view_matrix;
+
+		mPositions[i] = transform.GetTranslation();
+		mDirections[i] = transform.GetFront();
+		mVolumeWorldMatrices[i] = light_world_matrix * mVolumeScale;
+		mViewProjTransforms[i].view_projection = light_world_to_clip_matrix;
+		mViewProjTransforms[i].view_projection_inverse = glm::inverse(light_world_to_clip_matrix);
+
+		mIsDirty[i] = 0u;
+	}
+
+	glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer);
+	glBufferSubData(GL_UNIFORM_BUFFER,
+	                static_cast<GLintptr>(mDirtyBegin * sizeof(ViewProjTransforms)),
+	                static_cast<GLsizeiptr>((mDirtyEnd - mDirtyBegin) * sizeof(ViewProjTransforms)),
+	                mViewProjTransforms.data() + mDirtyBegin);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+
+	mLastUploadedLightsNb = mDirtyEnd - mDirtyBegin;
+	mDirtyBegin = mDirtyEnd = 0u;
+}
+
+size_t
+edan35::LightSystem::GetLastUploadedLightsNb() const
+{
+	return mLastUploadedLightsNb;
+}
+
+void
+edan35::LightSystem::MarkDirty(size_t index)
+{
+	mIsDirty[index] = 1u;
+	if (mDirtyBegin >= mDirtyEnd) {
+		mDirtyBegin = index;
+		mDirtyEnd = index + 1u;
+	} else {
+		mDirtyBegin = std::min(mDirtyBegin, index);
+		mDirtyEnd = std::max(mDirtyEnd, index + 1u);
+	}
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "core/TRSTransform.h"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+
+namespace edan35
+{
+	struct ViewProjTransforms
+	{
+		glm::mat4 view_projection = glm::mat4(1.0f);
+		glm::mat4 view_projection_inverse = glm::mat4(1.0f);
+	};
+
+	//! \brief Storage for the spot lights of the deferred renderer.
+	//!
+	//! Lights are stored as a structure of arrays. The matrices derived
+	//! from a light's transform are only recomputed when that transform
+	//! changed, and only the range of lights modified since the last call
+	//! to `Update()` gets uploaded to the uniform buffer.
+	class LightSystem {
+	public:
+		//! \brief Maximum number of lights; it has to match the size of
+		//!        the `lights` array in the `LightViewProjTransforms`
+		//!        uniform block of the shaders.
+		static constexpr size_t max_lights_nb = 128;
+
+		//! \brief Create an empty light system.
+		//!
+		//! @param [in] uniform_buffer buffer object the view-projection
+		//!             transforms are uploaded to; it should be able to
+		//!             hold `max_lights_nb` `ViewProjTransforms`, and is
+		//!             not owned by the light system.
+		//! @param [in] projection projection matrix shared by all lights
+		//! @param [in] offset transform from the light's frame to the
+		//!             origin of its projection
+		//! @param [in] volume_scale transform applied to the unit cone to
+		//!             obtain the light's volume
+		LightSystem(GLuint uniform_buffer, glm::mat4 const& projection,
+		            glm::mat4 const& offset, glm::mat4 const& volume_scale);
+
+		//! \brief Add a new light at the end of the list.
+		//!
+		//! @return the index of the new light, or `max_lights_nb` if the
+		//!         light system is already full.
+		size_t Add(TRSTransformf const& transform, glm::vec3 const& color);
+
+		//! \brief Remove a light; the last light is moved to its index.
+		void Remove(size_t index);
+
+		size_t GetLightsNb() const;
+
+		void SetTransform(size_t index, TRSTransformf const& transform);
+		TRSTransformf const& GetTransform(size_t index) const;
+
+		void SetColor(size_t index, glm::vec3 const& color);
+		glm::vec3 const& GetColor(size_t index) const;
+
+		glm::vec3 const& GetPosition(size_t index) const;
+		glm::vec3 const& GetDirection(size_t index) const;
+
+		//! \brief Model-to-world matrix of the light's volume (a cone).
+		glm::mat4 const& GetVolumeWorldMatrix(size_t index) const;
+
+		ViewProjTransforms const& GetViewProjTransforms(size_t index) const;
+
+		//! \brief Recompute the matrices of all modified lights, and
+		//!        upload the range they span to the uniform buffer.
+		void Update();
+
+		//! \brief Number of lights uploaded by the last call to `Update()`.
+		size_t GetLastUploadedLightsNb() const;
+
+	private:
+		void MarkDirty(size_t index);
+
+		GLuint mUniformBuffer;
+		glm::mat4 mProjection;
+		glm::mat4 mOffset;
+		glm::mat4 mOffsetInverse;
+		glm::mat4 mVolumeScale;
+
+		// Properties set by the user
+		std::vector<TRSTransformf> mTransforms;
+		std::vector<glm::vec3> mColors;
+
+		// Properties derived from the transforms
+		std::vector<glm::vec3> mPositions;
+		std::vector<glm::vec3> mDirections;
+		std::vector<glm::mat4> mVolumeWorldMatrices;
+		std::vector<ViewProjTransforms> mViewProjTransforms;
+
+		std::vector<std::uint8_t> mIsDirty;
+		size_t mDirtyBegin{ 0u };
+		size_t mDirtyEnd{ 0u };
+		size_t mLastUploadedLightsNb{ 0u };
+	};
+}
@@ -0,0 +1,213 @@
+#include "MaterialAtlas.hpp"
+
+#include "core/Log.h"
+#include "core/opengl.hpp"
+
+#include <array>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+	constexpr std::array<char const*, 4> texture_binding_names = {
+		"diffuse_texture",
+		"specular_texture",
+		"normals_texture",
+		"opacity_texture"
+	};
+
+	struct TextureFormat
+	{
+		GLint width{ 0 };
+		GLint height{ 0 };
+		GLint internal_format{ 0 };
+
+		bool operator==(TextureFormat const& other) const
+		{
+			return width == other.width && height == other.height && internal_format == other.internal_format;
+		}
+	};
+
+	struct TextureLocation
+	{
+		int array_index{ -1 };
+		int layer{ 0 };
+	};
+}
+
+constexpr size_t edan35::MaterialAtlas::max_texture_arrays_nb;
+constexpr size_t edan35::MaterialAtlas::max_materials_nb;
+
+edan35::MaterialAtlas::MaterialAtlas(std::vector<bonobo::mesh_data> const& meshes, GLuint uniform_buffer)
+{
+	//
+	// Sort all the textures used by the meshes by size and format.
+	//
+	std::vector<TextureFormat> array_formats;
+	std::vector<std::vector<GLuint>> array_textures;
+	std::unordered_map<GLuint, TextureLocation> texture_locations;
+	for (auto const& mesh : meshes) {
+		for (auto const name : texture_binding_names) {
+			auto const binding = mesh.bindings.find(name);
+			if (binding == mesh.bindings.end() || texture_locations.find(binding->second) != texture_locations.end())
+				continue;
+
+			TextureFormat format;
+			glBindTexture(GL_TEXTURE_2D, binding->second);
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &format.width);
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &format.height);
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format.internal_format);
+			glBindTexture(GL_TEXTURE_2D, 0u);
+
+			auto const array_format = std::find(array_formats.begin(), array_formats.end(), format);
+			TextureLocation location;
+			location.array_index = static_cast<int>(array_format - array_formats.begin());
+			if (array_format == array_formats.end()) {
+				array_formats.push_back(format);
+				array_textures.emplace_back();
+			}
+			location.layer = static_cast<int>(array_textures[static_cast<size_t>(location.array_index)].size());
+			array_textures[static_cast<size_t>(location.array_index)].push_back(binding->second);
+			texture_locations.emplace(binding->second, location);
+		}
+	}
+
+	if (array_formats.size() > max_texture_arrays_nb) {
+		LogWarning("The textures use %zu different sizes or formats, but the material atlas only supports %zu texture arrays.", array_formats.size(), max_texture_arrays_nb);
+		return;
+	}
+
+	//
+	// Build the material table.
+	//
+	mMeshMaterialIndices.reserve(meshes.size());
+	for (auto const& mesh : meshes) {
+		MaterialData material;
+		for (size_t i = 0; i < texture_binding_names.size(); ++i) {
+			auto const binding = mesh.bindings.find(texture_binding_names[i]);
+			if (binding == mesh.bindings.end())
+				continue;
+			auto const& location = texture_locations[binding->second];
+			material.texture_arrays[static_cast<int>(i)] = location.array_index;
+			material.texture_layers[static_cast<int>(i)] = location.layer;
+		}
+		material.diffuse_opacity = glm::vec4(mesh.material.diffuse, mesh.material.opacity);
+		material.specular_shininess = glm::vec4(mesh.material.specular, mesh.material.shininess);
+
+		auto const same_material = std::find_if(mMaterials.begin(), mMaterials.end(), [&material](MaterialData const& other){
+			return other.texture_arrays == material.texture_arrays
+			    && other.texture_layers == material.texture_layers
+			    && other.diffuse_opacity == material.diffuse_opacity
+			    && other.specular_shininess == material.specular_shininess;
+		});
+		mMeshMaterialIndices.push_back(static_cast<std::uint32_t>(same_material - mMaterials.begin()));
+		if (same_material == mMaterials.end())
+			mMaterials.push_back(material);
+	}
+
+	if (mMaterials.size() > max_materials_nb) {
+		LogWarning("The meshes use %zu different materials, but the material atlas only supports %zu.", mMaterials.size(), max_materials_nb);
+		mMaterials.clear();
+		mMeshMaterialIndices.clear();
+		return;
+	}
+
+	//
+	// Copy each texture into its layer; the mipmaps are regenerated
+	// afterwards rather than copied level by level.
+	//
+	bool const can_copy_on_gpu = GLAD_GL_VERSION_4_3 != 0;
+	std::vector<std::uint8_t> pixels;
+
+	mTextureArrays.resize(array_formats.size(), 0u);
+	glGenTextures(static_cast<GLsizei>(mTextureArrays.size()), mTextureArrays.data());
+	for (size_t a = 0; a < mTextureArrays.size(); ++a) {
+		auto const& format = array_formats[a];
+		auto const& textures = array_textures[a];
+		auto const layers_nb = static_cast<GLsizei>(textures.size());
+
+		glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureArrays[a]);
+		glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, format.internal_format, format.width, format.height, layers_nb, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+		for (GLsizei layer = 0; layer < layers_nb; ++layer) {
+			auto const texture = textures[static_cast<size_t>(layer)];
+			if (can_copy_on_gpu) {
+				glCopyImageSubData(texture, GL_TEXTURE_2D, 0, 0, 0, 0,
+				                   mTextureArrays[a], GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+				                   format.width, format.height, 1);
+			} else {
+				// All textures loaded by bonobo::loadTexture2D() are RGBA8.
+				pixels.resize(static_cast<size_t>(format.width) * static_cast<size_t>(format.height) * 4u);
+				glBindTexture(GL_TEXTURE_2D, texture);
+				glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+				glBindTexture(GL_TEXTURE_2D, 0u);
+				glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, format.width, format.height, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+			}
+		}
+		glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, 0u);
+
+		utils::opengl::debug::nameObject(GL_TEXTURE, mTextureArrays[a],
+		                                 "Material atlas " + std::to_string(format.width) + "x" + std::to_string(format.height));
+	}
+
+	glBindBuffer(GL_UNIFORM_BUFFER, uniform_buffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(mMaterials.size() * sizeof(MaterialData)), mMaterials.data());
+	glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+
+	LogInfo("Packed %zu textures into %zu texture arrays, for %zu materials.", texture_locations.size(), mTextureArrays.size(), mMaterials.size());
+	mIsValid = true;
+}
+
+edan35::MaterialAtlas::~MaterialAtlas()
+{
+	glDeleteTextures(static_cast<GLsizei>(mTextureArrays.size()), mTextureArrays.data());
+}
+
+bool
+edan35::MaterialAtlas::IsValid() const
+{
+	return mIsValid;
+}
+
+std::uint32_t
+edan35::MaterialAtlas::GetMaterialIndex(size_t mesh_index) const
+{
+	return mMeshMaterialIndices[mesh_index];
+}
+
+size_t
+edan35::MaterialAtlas::GetMaterialsNb() const
+{
+	return mMaterials.size();
+}
+
+size_t
+edan35::MaterialAtlas::GetTextureArraysNb() const
+{
+	return mTextureArrays.size();
+}
+
+void
+edan35::MaterialAtlas::BindTextureArrays(GLuint first_texture_unit, GLuint sampler) const
+{
+	for (size_t a = 0; a < mTextureArrays.size(); ++a) {
+		auto const unit = first_texture_unit + static_cast<GLuint>(a);
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureArrays[a]);
+		glBindSampler(unit, sampler);
+	}
+}
+
+void
+edan35::MaterialAtlas::UnbindTextureArrays(GLuint first_texture_unit) const
+{
+	for (size_t a = 0; a < mTextureArrays.size(); ++a) {
+		auto const unit = first_texture_unit + static_cast<GLuint>(a);
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, 0u);
+		glBindSampler(unit, 0u);
+	}
+	glActiveTexture(GL_TEXTURE0);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "core/helpers.hpp"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+
+namespace edan35
+{
+	//! \brief Entry of the material table, following the std140 layout of
+	//!        the `Materials` uniform block.
+	struct MaterialData
+	{
+		//! Texture array and layer of the diffuse, specular, normals and
+		//! opacity textures, in that order; the array is -1 when the
+		//! material has no texture of that kind.
+		glm::ivec4 texture_arrays = glm::ivec4(-1);
+		glm::ivec4 texture_layers = glm::ivec4(0);
+		glm::vec4 diffuse_opacity = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		glm::vec4 specular_shininess = glm::vec4(0.0f);
+	};
+
+	//! \brief Pack the textures of a set of meshes into a few texture
+	//!        arrays, so that draws only need to select a material index
+	//!        rather than bind their own textures.
+	//!
+	//! Textures of the same size and format end up as layers of the same
+	//! `GL_TEXTURE_2D_ARRAY`. Meshes using the same textures and constants
+	//! share the same entry of the material table, which is uploaded to a
+	//! uniform buffer.
+	class MaterialAtlas {
+	public:
+		//! \brief Maximum number of texture arrays; it has to match the
+		//!        size of `material_texture_arrays` in the shaders.
+		static constexpr size_t max_texture_arrays_nb = 8;
+
+		//! \brief Maximum number of materials; it has to match the size
+		//!        of the `Materials` uniform block in the shaders.
+		static constexpr size_t max_materials_nb = 256;
+
+		//! \brief Copy the textures of the meshes into texture arrays,
+		//!        and upload the material table.
+		//!
+		//! @param [in] meshes meshes whose materials should be packed; the
+		//!             original textures are left untouched.
+		//! @param [in] uniform_buffer buffer object the material table is
+		//!             uploaded to; it should be able to hold
+		//!             `max_materials_nb` `MaterialData`, and is not owned
+		//!             by the atlas.
+		MaterialAtlas(std::vector<bonobo::mesh_data> const& meshes, GLuint uniform_buffer);
+		~MaterialAtlas();
+
+		MaterialAtlas(MaterialAtlas const&) = delete;
+		MaterialAtlas& operator=(MaterialAtlas const&) = delete;
+
+		//! \brief Whether all textures and materials fitted within the
+		//!        limits; the atlas should not be used otherwise.
+		bool IsValid() const;
+
+		std::uint32_t GetMaterialIndex(size_t mesh_index) const;
+		size_t GetMaterialsNb() const;
+		size_t GetTextureArraysNb() const;
+
+		//! \brief Bind all texture arrays to consecutive texture units.
+		//!
+		//! @param [in] first_texture_unit unit the first array is bound
+		//!             to, i.e. 0 for GL_TEXTURE0
+		//! @param [in] sampler sampler object bound to each of those units
+		void BindTextureArrays(GLuint first_texture_unit, GLuint sampler) const;
+
+		//! \brief Unbind the texture arrays bound by `BindTextureArrays()`.
+		void UnbindTextureArrays(GLuint first_texture_unit) const;
+
+	private:
+		bool mIsValid{ false };
+		std::vector<GLuint> mTextureArrays;
+		std::vector<MaterialData> mMaterials;
+		std::vector<std::uint32_t> mMeshMaterialIndices;
+	};
+}
@@ -3,14 +3,25 @@
 #define GLM_FORCE_PURE 1
 
 #include "assignment2.hpp"
+#include "Benchmark.hpp"
+#include "GeometryBatch.hpp"
+#include "HiZCuller.hpp"
+#include "LightSystem.hpp"
+#include "MaterialAtlas.hpp"
 
 #include "config.hpp"
 #include "core/Bonobo.h"
 #include "core/FPSCamera.h"
+#include "core/FrameClock.hpp"
+#include "core/FrameGraph.hpp"
+#include "core/GpuMemory.hpp"
 #include "core/helpers.hpp"
 #include "core/node.hpp"
+#include "core/OcclusionCuller.hpp"
+#include "core/Profiler.h"
 #include "core/opengl.hpp"
 #include "core/ShaderProgramManager.hpp"
+#include "core/StreamingUniformBuffer.hpp"
 
 #include <imgui.h>
 #include <glm/glm.hpp>
@@ -18,10 +29,15 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <tinyfiledialogs.h>
 
+#include <algorithm>
 #include <array>
 #include <clocale>
+#include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <memory>
 #include <stdexcept>
+#include <thread>
 
 namespace constant
 {
@@ -30,9 +46,17 @@ namespace constant
 
 	constexpr float  scale_lengths       = 100.0f; // The scene is expressed in centimetres rather than metres, hence the x100.
 
-	constexpr size_t lights_nb           = 4;
+	constexpr size_t default_lights_nb   = 4;
 	constexpr float  light_intensity     = 72.0f * (scale_lengths * scale_lengths);
 	constexpr float  light_angle_falloff = glm::radians(37.0f);
+
+	constexpr float  shadow_receiver_offset      = 0.02f * scale_lengths;
+	constexpr float  evsm_positive_exponent      = 40.0f; // largest exponents not overflowing 32-bit floats
+	constexpr float  evsm_negative_exponent      = 5.0f;
+
+	constexpr int    occlusion_buffer_res_x      = 256;
+	constexpr int    occlusion_buffer_res_y      = 128;
+	constexpr size_t occluder_triangles_budget   = 40000u;
 }
 
 namespace
@@ -42,45 +66,259 @@ namespace
 		return static_cast<std::underlying_type_t<E>>(e);
 	}
 
+	enum class GBufferLayout : uint32_t {
+		Reference = 0u, //!< RGBA8 diffuse, specular and normal; RGBA8 light accumulation
+		Compact,        //!< RGBA8 diffuse+specular, RG16 octahedral normal; R11G11B10F light accumulation
+		Count
+	};
+	std::array<char const*, 2> const gbuffer_layout_labels{
+		"Reference",
+		"Compact"
+	};
+
+	//! \brief Number of bytes per pixel taken by the different groups of
+	//!        render targets, for a given G-buffer layout.
+	struct LayoutFootprint
+	{
+		uint32_t gbuffer{ 0u };            //!< depth + all G-buffer colour targets
+		uint32_t light_accumulation{ 0u }; //!< both light contribution targets
+		uint32_t per_light_reads{ 0u };    //!< G-buffer data fetched by each light
+		uint32_t resolve_reads{ 0u };      //!< data fetched by the resolve pass
+	};
+	LayoutFootprint computeLayoutFootprint(GBufferLayout layout);
+
+	//! \brief Display a timing in milliseconds, or a dash until it has
+	//!        been measured.
+	void showTiming(bool is_valid, float timing_ms);
+
+	enum class LightingResolution : uint32_t {
+		Full = 0u,
+		Half,
+		Quarter,
+		Count
+	};
+	std::array<char const*, 3> const lighting_resolution_labels{
+		"Full",
+		"Half",
+		"Quarter"
+	};
+	//! \brief Ratio between the G-buffer and the light accumulation
+	//!        resolutions, along each axis.
+	GLsizei getLightingDownscale(LightingResolution resolution);
+
+	//! \brief Everything that the render targets depend on, besides the
+	//!        framebuffer size; they need to be recreated whenever it
+	//!        changes.
+	struct RenderTargetsConfig
+	{
+		GBufferLayout gbuffer_layout{ GBufferLayout::Reference };
+		LightingResolution lighting_resolution{ LightingResolution::Full };
+
+		bool operator!=(RenderTargetsConfig const& other) const
+		{
+			return gbuffer_layout != other.gbuffer_layout
+			    || lighting_resolution != other.lighting_resolution;
+		}
+	};
+
+	enum class LightVolumeMode : uint32_t {
+		DepthTested = 0u, //!< back faces of the cone, depth-tested against the G-buffer
+		Stencil,          //!< two-sided stencil marking of the pixels inside the cone
+		Count
+	};
+	std::array<char const*, 2> const light_volume_mode_labels{
+		"Depth-tested back faces",
+		"Two-sided stencil"
+	};
+
+	//! \brief How the shadow maps are filtered; the values have to match
+	//!        the constants of fill_shadowmap.frag and accumulate_lights.frag.
+	enum class ShadowFiltering : uint32_t {
+		PCF = 0u,            //!< n×n hardware-compared taps per pixel
+		Variance,            //!< blurred depth moments, single filtered tap (VSM)
+		ExponentialVariance, //!< blurred moments of exponentially warped depths (EVSM)
+		Count
+	};
+	std::array<char const*, 3> const shadow_filtering_labels{
+		"PCF",
+		"Variance (VSM)",
+		"Exponential variance (EVSM)"
+	};
+
+	//! \brief State of the dynamic resolution controller.
+	//!
+	//! All render targets are allocated at the size of the window
+	//! framebuffer, but the G-buffer, lighting and resolve passes only
+	//! render into the lower-left sub-rectangle of them whose size is
+	//! given by `scale`; that sub-rectangle is then upscaled when copied
+	//! to the default framebuffer.
+	struct DynamicResolution
+	{
+		bool enabled{ false };
+		float target_gpu_time_ms{ 8.0f };
+		float min_scale{ 0.5f };
+		float max_scale{ 1.0f };
+		float scale{ 1.0f };
+		float smoothed_scalable_ms{ 0.0f }; //!< GPU time of the passes affected by the scale
+		float smoothed_fixed_ms{ 0.0f };    //!< GPU time of the passes not affected by the scale
+		//! Scale of the last frames, indexed by their frame graph index
+		//! modulo the size, as their timings arrive a few frames late.
+		std::array<float, FrameGraph::timing_latency + 1u> frame_scales{};
+		size_t measured_frame_index{ SIZE_MAX }; //!< frame graph index of the latest timings used
+	};
+
+	//! \brief State of the temporal anti-aliasing (TAA), kept from one
+	//!        frame to the next.
+	//!
+	//! The projection is offset by a different sub-pixel jitter every
+	//! frame, and each frame is blended into a history reprojected from
+	//! the previous one; the history is ping-ponged between two textures.
+	struct TemporalAntiAliasing
+	{
+		bool enabled{ false };
+		float history_weight{ 0.9f };
+		std::uint32_t frame_index{ 0u };   //!< position in the jitter sequence
+		std::uint32_t history_index{ 0u }; //!< history texture written to last
+		bool has_history{ false };
+		glm::ivec2 history_render_size{ 0 };
+		glm::mat4 previous_world_to_clip{ 1.0f }; //!< without the jitter
+	};
+
+	//! \brief Number of jitter offsets cycled through by the TAA.
+	constexpr std::uint32_t taa_jitter_samples_nb = 8u;
+
+	//! \brief Sub-pixel jitter used by the TAA for a given frame.
+	//!
+	//! @param [in] frame_index index of the frame in the jitter sequence
+	//! @return an offset in pixels, in [-0.5, 0.5]², following the
+	//!         Halton (2, 3) sequence
+	glm::vec2 getTaaJitter(std::uint32_t frame_index);
+
+	//! \brief Pick a new resolution scale from the GPU timings of a
+	//!        recent frame.
+	//!
+	//! @param [in,out] controller the controller to update
+	//! @param [in] measured_scale scale the measured frame was rendered at
+	//! @param [in] scalable_gpu_time_ms GPU time spent in passes whose
+	//!             cost depends on the number of pixels rendered
+	//! @param [in] fixed_gpu_time_ms GPU time spent in all other passes
+	void updateDynamicResolution(DynamicResolution& controller, float measured_scale, float scalable_gpu_time_ms, float fixed_gpu_time_ms);
+
+	//! \brief Whether the cost of a frame graph pass depends on the
+	//!        render size picked by the dynamic resolution.
+	bool isScalablePass(std::string const& name);
+
+	//! \brief Size of the sub-rectangle to render into, for a given scale.
+	glm::ivec2 computeRenderSize(float scale, GLsizei framebuffer_width, GLsizei framebuffer_height);
+
+	//! \brief Render targets kept from one frame to the next; all other
+	//!        ones are transient, and allocated by the frame graph.
 	enum class Texture : uint32_t {
 		DepthBuffer = 0u,
-		ShadowMap,
 		GBufferDiffuse,
 		GBufferSpecular,
 		GBufferWorldSpaceNormal,
-		LightDiffuseContribution,
-		LightSpecularContribution,
 		Result,
+		TaaHistory0,
+		TaaHistory1,
 		Count
 	};
 	using Textures = std::array<GLuint, toU(Texture::Count)>;
-	Textures createTextures(GLsizei framebuffer_width, GLsizei framebuffer_height);
+	Textures createTextures(GLsizei framebuffer_width, GLsizei framebuffer_height, RenderTargetsConfig const& config);
+
+	//! \brief Descriptions of the transient render targets, declared to
+	//!        the frame graph every frame.
+	struct TransientTextureDescriptions
+	{
+		FrameGraph::TextureDescription shadow_map;
+		FrameGraph::TextureDescription variance_shadow_moments;
+		FrameGraph::TextureDescription exponential_shadow_moments;
+		FrameGraph::TextureDescription low_res_depth;
+		FrameGraph::TextureDescription low_res_normal;
+		FrameGraph::TextureDescription light_contribution; //!< for both the diffuse and specular contributions
+		FrameGraph::TextureDescription overdraw;
+		FrameGraph::TextureDescription jittered_result; //!< resolved image before the TAA
+	};
+	TransientTextureDescriptions createTransientTextureDescriptions(GLsizei framebuffer_width, GLsizei framebuffer_height, RenderTargetsConfig const& config);
+
+	//! \brief Names of the frame graph passes referred to outside of
+	//!        their declaration.
+	namespace pass_name
+	{
+		char const* const depth_prepass = "Depth pre-pass";
+		char const* const gbuffer = "Fill G-buffer";
+		char const* const downsample = "Downsample G-buffer";
+		char const* const begin_light_accumulation = "Begin light accumulation";
+		char const* const resolve = "Resolve";
+		char const* const temporal_antialiasing = "Temporal anti-aliasing";
+		char const* const hiz_culling = "Hi-Z culling";
+		char const* const hiz_pyramid = "Build Hi-Z pyramid";
+	}
 
 	enum class Sampler : uint32_t {
 		Nearest = 0u,
 		Linear,
 		Mipmaps,
+		ShadowComparison, //!< bilinear depth comparison, for sampler2DShadow
 		Count
 	};
 	using Samplers = std::array<GLuint, toU(Sampler::Count)>;
 	Samplers createSamplers();
 
+	//! \brief Framebuffer objects used after the frame graph has run; the
+	//!        graph creates the ones used by its passes.
 	enum class FBO : uint32_t {
-		GBuffer = 0u,
-		ShadowMap,
-		LightAccumulation,
-		Resolve,
+		Resolve = 0u,
 		FinalWithDepth,
 		Count
 	};
 	using FBOs = std::array<GLuint, toU(FBO::Count)>;
 	FBOs createFramebufferObjects(Textures const& textures);
 
+	//! \brief Resources used for comparing the final image against a
+	//!        previously captured reference one.
+	//!
+	//! They are kept separate from the other render targets, as the
+	//! reference has to survive changes to the render targets
+	//! configuration in order to be of any use.
+	//!
+	//! The difference pass sums the errors over tiles of
+	//! `image_difference_tile_size`² pixels; those sums are read back
+	//! through a pixel buffer a frame or more later, and added up on the
+	//! CPU.
+	struct ImageComparison
+	{
+		GLuint reference_texture{ 0u };
+		GLuint difference_texture{ 0u };
+		GLuint difference_fbo{ 0u };
+		GLuint readback_buffer{ 0u };
+		GLsync readback_fence{ nullptr };
+		//! filtering used by the image being read back; `Count` when it
+		//! did not show the shadow visibility, as only those images are
+		//! credited to a filtering
+		ShadowFiltering readback_shadow_filtering{ ShadowFiltering::Count };
+		glm::ivec2 resolution{ 0 };
+		glm::ivec2 tiles_nb{ 0 };
+		glm::vec2 reference_scale{ 1.0f }; //!< dynamic resolution scale the reference was rendered at
+		bool has_reference{ false };
+		bool is_enabled{ false };
+		float mean_absolute_error{ 0.0f };
+		float mean_squared_error{ 0.0f };
+	};
+	constexpr GLint image_difference_tile_size = 8;
+	ImageComparison createImageComparison(GLsizei framebuffer_width, GLsizei framebuffer_height);
+	void deleteImageComparison(ImageComparison& comparison);
+
+	//! \brief Retrieve the errors of the last difference pass, if the GPU
+	//!        is done with it.
+	//!
+	//! @return whether new errors were retrieved
+	bool readBackImageDifference(ImageComparison& comparison);
+
+	//! \brief Queries measuring the passes outside of the frame graph;
+	//!        the graph times its own passes.
 	enum class ElapsedTimeQuery : uint32_t {
-		GbufferGeneration = 0u,
-		ShadowMap0Generation,
-		Light0Accumulation = ShadowMap0Generation + static_cast<uint32_t>(constant::lights_nb),
-		Resolve = Light0Accumulation + static_cast<uint32_t>(constant::lights_nb),
+		ImageDifference = 0u,
 		ConeWireframe,
 		GUI,
 		CopyToFramebuffer,
@@ -89,18 +327,41 @@ namespace
 	using ElapsedTimeQueries = std::array<GLuint, toU(ElapsedTimeQuery::Count)>;
 	ElapsedTimeQueries createElapsedTimeQueries();
 
+	//! \brief Queries measuring the passes run for a single light.
+	//!
+	//! As the number of lights changes at runtime, they are kept in a
+	//! vector grown and shrunk along with the lights, rather than in
+	//! ElapsedTimeQueries.
+	struct LightQueries
+	{
+		GLuint shadow_map_generation{ 0u }; //!< GL_TIME_ELAPSED
+		GLuint accumulation{ 0u };          //!< GL_TIME_ELAPSED
+		GLuint shaded_pixels{ 0u };         //!< GL_SAMPLES_PASSED
+	};
+	void resizeLightQueries(std::vector<LightQueries>& queries, size_t lights_nb);
+
+	struct LightTimings
+	{
+		GLuint64 shadow_map_generation{ 0u };
+		GLuint64 accumulation{ 0u };
+		GLuint64 shaded_pixels{ 0u };
+	};
+
 	enum class UBO : uint32_t {
 		CameraViewProjTransforms = 0u,
 		LightViewProjTransforms,
+		Materials,
 		Count
 	};
 	using UBOs = std::array<GLuint, toU(UBO::Count)>;
 	UBOs createUniformBufferObjects();
 
-	struct ViewProjTransforms
-	{
-		glm::mat4 view_projection = glm::mat4(1.0f);
-		glm::mat4 view_projection_inverse = glm::mat4(1.0f);
+	//! \brief Sponza's geometry is split into buckets, drawn in that
+	//!        order; only opaque geometry is part of the depth pre-pass.
+	enum class GeometryBucket : uint32_t {
+		Opaque = 0u,
+		AlphaTested, //!< geometry with an opacity texture, whose fragments can get discarded
+		Count
 	};
 
 	struct GeometryTextureData
@@ -111,6 +372,44 @@ namespace
 		GLuint opacity_texture_id{ 0u };
 	};
 
+	//! \brief Meshes sharing the same textures, which the indirect path
+	//!        draws with a single call.
+	struct BatchedDrawGroup
+	{
+		GeometryTextureData texture_data;
+		edan35::DrawList draw_list;
+	};
+
+	//! \brief Group meshes by textures, and create a draw list per group.
+	//!
+	//! @param [in] batch batch the draw lists are created in
+	//! @param [in] mesh_indices meshes to group, in drawing order
+	//! @param [in] meshes_texture_data textures used by each mesh; meshes
+	//!             end up in the same group only if all of them match
+	std::vector<BatchedDrawGroup> createBatchedDrawGroups(edan35::GeometryBatch& batch,
+	                                                      std::vector<size_t> const& mesh_indices,
+	                                                      std::vector<GeometryTextureData> const& meshes_texture_data);
+
+	//! \brief Create transient draw lists for the groups, only keeping
+	//!        their visible meshes; groups left empty are dropped.
+	std::vector<BatchedDrawGroup> createVisibleDrawGroups(edan35::GeometryBatch& batch,
+	                                                      std::vector<BatchedDrawGroup> const& groups,
+	                                                      std::vector<std::uint8_t> const& is_mesh_visible);
+
+	//! \brief World-space bounding box of a mesh, used for culling.
+	struct MeshBounds
+	{
+		glm::vec3 min{ 0.0f };
+		glm::vec3 max{ 0.0f };
+		bool is_bounded{ false }; //!< false for meshes which are never culled
+	};
+
+	//! \brief Compute the bounds of a mesh from its CPU-side positions.
+	//!
+	//! Only triangle meshes loaded with their CPU geometry are supported;
+	//! other meshes are left unbounded.
+	MeshBounds computeMeshBounds(bonobo::mesh_data const& mesh);
+
 	struct GBufferShaderLocations
 	{
 		GLuint ubo_CameraViewProjTransforms{ 0u };
@@ -124,6 +423,11 @@ namespace
 		GLuint has_specular_texture{ 0u };
 		GLuint has_normals_texture{ 0u };
 		GLuint has_opacity_texture{ 0u };
+		GLuint use_compact_gbuffer{ 0u };
+		GLuint ubo_Materials{ 0u };
+		GLuint material_index{ 0u };
+		GLuint use_material_atlas{ 0u };
+		GLuint material_texture_arrays{ 0u };
 	};
 	void fillGBufferShaderLocations(GLuint gbuffer_shader, GBufferShaderLocations& locations);
 
@@ -134,6 +438,13 @@ namespace
 		GLuint vertex_model_to_world{ 0u };
 		GLuint opacity_texture{ 0u };
 		GLuint has_opacity_texture{ 0u };
+		GLuint ubo_Materials{ 0u };
+		GLuint material_index{ 0u };
+		GLuint use_material_atlas{ 0u };
+		GLuint material_texture_arrays{ 0u };
+		GLuint shadow_filtering{ 0u };
+		GLuint shadow_depth_scale{ 0u };
+		GLuint evsm_exponents{ 0u };
 	};
 	void fillShadowmapShaderLocations(GLuint shadowmap_shader, FillShadowmapShaderLocations& locations);
 
@@ -148,28 +459,42 @@ namespace
 		GLuint depth_texture{ 0u };
 		GLuint normal_texture{ 0u };
 		GLuint shadow_texture{ 0u };
+		GLuint shadow_moments_texture{ 0u };
+		GLuint shadow_filtering{ 0u };
+		GLuint pcf_kernel_radius{ 0u };
+		GLuint shadow_depth_scale{ 0u };
+		GLuint shadow_receiver_offset{ 0u };
+		GLuint evsm_exponents{ 0u };
+		GLuint light_bleeding_reduction{ 0u };
+		GLuint show_shadow_visibility{ 0u };
 		GLuint camera_position{ 0u };
 		GLuint inverse_screen_resolution{ 0u };
+		GLuint render_scale{ 0u };
 		GLuint light_color{ 0u };
 		GLuint light_position{ 0u };
 		GLuint light_direction{ 0u };
 		GLuint light_intensity{ 0u };
 		GLuint light_angle_falloff{ 0u };
+		GLuint use_compact_gbuffer{ 0u };
 	};
 	void fillAccumulateLightsShaderLocations(GLuint accumulate_lights_shader, AccumulateLightsShaderLocations& locations);
 
 	bonobo::mesh_data loadCone();
 } // namespace
 
-edan35::Assignment2::Assignment2(WindowManager& windowManager) :
+edan35::Assignment2::Assignment2(WindowManager& windowManager, BenchmarkSettings const& benchmark_settings) :
 	mCamera(0.5f * glm::half_pi<float>(),
 	        static_cast<float>(config::resolution_x) / static_cast<float>(config::resolution_y),
 	        0.01f * constant::scale_lengths, 40.0f * constant::scale_lengths),
-	inputHandler(), mWindowManager(windowManager), window(nullptr)
+	inputHandler(), mWindowManager(windowManager), window(nullptr),
+	mBenchmarkSettings(benchmark_settings)
 {
 	WindowManager::WindowDatum window_datum{ inputHandler, mCamera, config::resolution_x, config::resolution_y, 0, 0, 0, 0};
 
-	window = mWindowManager.CreateGLFWWindow("EDAN35: Assignment 2", window_datum, config::msaa_rate);
+	// Frames should not wait for the display while being measured.
+	auto const swap_strategy = mBenchmarkSettings.camera_path_filename.empty() ? WindowManager::SwapStrategy::enable_vsync
+	                                                                           : WindowManager::SwapStrategy::disable_vsync;
+	window = mWindowManager.CreateGLFWWindow("EDAN35: Assignment 2", window_datum, config::msaa_rate, false, false, swap_strategy);
 	if (window == nullptr) {
 		throw std::runtime_error("Failed to get a window: aborting!");
 	}
@@ -186,7 +511,9 @@ void
 edan35::Assignment2::run()
 {
 	// Load the geometry of Sponza
-	auto const sponza_geometry = bonobo::loadObjects(config::resources_path("sponza/sponza.obj"));
+	// The CPU copies of the geometry are only kept until the occluders
+	// have been set up.
+	auto sponza_geometry = bonobo::loadObjects(config::resources_path("sponza/sponza.obj"), true);
 	if (sponza_geometry.empty()) {
 		LogError("Failed to load the Sponza model");
 		return;
@@ -219,6 +546,71 @@ edan35::Assignment2::run()
 		sponza_geometry_texture_data.emplace_back(std::move(data));
 	}
 
+	std::array<std::vector<size_t>, toU(GeometryBucket::Count)> sponza_geometry_buckets;
+	for (size_t i = 0; i < sponza_geometry_texture_data.size(); ++i) {
+		auto const bucket = sponza_geometry_texture_data[i].opacity_texture_id != 0u ? GeometryBucket::AlphaTested : GeometryBucket::Opaque;
+		sponza_geometry_buckets[toU(bucket)].push_back(i);
+	}
+
+	// With OpenGL 4.3, Sponza is merged into a single batch and each pass
+	// submits it with one multi-draw indirect call per set of textures;
+	// the per-mesh loops are kept as the fallback for OpenGL 4.1.
+	std::unique_ptr<GeometryBatch> sponza_batch;
+	std::array<std::vector<BatchedDrawGroup>, toU(GeometryBucket::Count)> sponza_gbuffer_groups;
+	std::array<std::vector<BatchedDrawGroup>, toU(GeometryBucket::Count)> sponza_shadowmap_groups;
+	if (GeometryBatch::IsSupported()) {
+		sponza_batch = std::make_unique<GeometryBatch>(sponza_geometry);
+
+		// The shadow maps only use the opacity textures.
+		std::vector<GeometryTextureData> sponza_opacity_texture_data(sponza_geometry_texture_data.size());
+		for (size_t i = 0; i < sponza_geometry_texture_data.size(); ++i)
+			sponza_opacity_texture_data[i].opacity_texture_id = sponza_geometry_texture_data[i].opacity_texture_id;
+
+		for (size_t bucket = 0; bucket < sponza_geometry_buckets.size(); ++bucket) {
+			sponza_gbuffer_groups[bucket] = createBatchedDrawGroups(*sponza_batch, sponza_geometry_buckets[bucket], sponza_geometry_texture_data);
+			sponza_shadowmap_groups[bucket] = createBatchedDrawGroups(*sponza_batch, sponza_geometry_buckets[bucket], sponza_opacity_texture_data);
+		}
+	} else {
+		LogInfo("Multi-draw indirect requires OpenGL 4.3: Sponza will be drawn one mesh at a time.");
+	}
+
+	// The largest opaque meshes are rasterized on the CPU as occluders, so
+	// that the meshes they hide can be skipped by the G-buffer and shadow
+	// map passes; the triangle budget keeps the rasterization around a
+	// millisecond.
+	std::vector<MeshBounds> sponza_mesh_bounds;
+	sponza_mesh_bounds.reserve(sponza_geometry.size());
+	for (auto const& geometry : sponza_geometry)
+		sponza_mesh_bounds.push_back(computeMeshBounds(geometry));
+
+	auto const worker_threads_nb = std::max(std::thread::hardware_concurrency(), 1u) - 1u;
+	OcclusionCuller occlusion_culler(constant::occlusion_buffer_res_x, constant::occlusion_buffer_res_y, worker_threads_nb);
+	{
+		auto occluder_candidates = sponza_geometry_buckets[toU(GeometryBucket::Opaque)];
+		std::sort(occluder_candidates.begin(), occluder_candidates.end(), [&sponza_mesh_bounds](size_t lhs, size_t rhs){
+			return glm::length(sponza_mesh_bounds[lhs].max - sponza_mesh_bounds[lhs].min)
+			     > glm::length(sponza_mesh_bounds[rhs].max - sponza_mesh_bounds[rhs].min);
+		});
+
+		size_t occluders_nb = 0u;
+		size_t occluder_triangles_nb = 0u;
+		for (auto const i : occluder_candidates) {
+			auto const& geometry = sponza_geometry[i];
+			auto const triangles_nb = geometry.indices.size() / 3u;
+			if (!sponza_mesh_bounds[i].is_bounded || occluder_triangles_nb + triangles_nb > constant::occluder_triangles_budget)
+				continue;
+			occlusion_culler.AddOccluder(geometry.positions, geometry.indices);
+			++occluders_nb;
+			occluder_triangles_nb += triangles_nb;
+		}
+		LogInfo("Occlusion culling uses %zu occluders (%zu triangles), rasterized by %u threads.",
+		        occluders_nb, occluder_triangles_nb, worker_threads_nb + 1u);
+	}
+	for (auto& geometry : sponza_geometry) {
+		std::vector<glm::vec3>().swap(geometry.positions);
+		std::vector<GLuint>().swap(geometry.indices);
+	}
+
 	auto const cone_geometry = loadCone();
 	Node cone;
 	cone.set_geometry(cone_geometry);
@@ -237,12 +629,48 @@ edan35::Assignment2::run()
 	// Setup OpenGL objects
 	// Look further down in this file to see the implementation of those functions.
 	//
-	Textures const textures = createTextures(framebuffer_width, framebuffer_height);
-	FBOs const fbos = createFramebufferObjects(textures);
+	RenderTargetsConfig render_targets_config;
+	auto selected_render_targets_config = render_targets_config;
+	Textures textures = createTextures(framebuffer_width, framebuffer_height, render_targets_config);
+	FBOs fbos = createFramebufferObjects(textures);
+	FrameGraph frame_graph;
+	ImageComparison image_comparison = createImageComparison(framebuffer_width, framebuffer_height);
 	Samplers const samplers = createSamplers();
 	ElapsedTimeQueries const elapsed_time_queries = createElapsedTimeQueries();
+	std::vector<LightQueries> light_queries;
 	UBOs const ubos = createUniformBufferObjects();
 
+	// The camera transforms are rewritten every frame; streaming them
+	// avoids updating a UBO the GPU may still be reading from. The light
+	// transforms rarely change, and stay in the LightSystem's UBO which
+	// only uploads the lights that moved.
+	StreamingUniformBuffer streaming_uniforms(4 * static_cast<GLsizeiptr>(sizeof(ViewProjTransforms)));
+	bool use_streaming_uniforms = true;
+
+	// With the material atlas, draws only select their material index
+	// rather than binding their own textures; the indirect path can then
+	// submit each bucket (or all of Sponza for the shadow maps) at once.
+	MaterialAtlas const sponza_material_atlas(sponza_geometry, ubos[toU(UBO::Materials)]);
+	std::array<DrawList, toU(GeometryBucket::Count)> sponza_bucket_draw_lists;
+	DrawList sponza_draw_list;
+	if (sponza_batch != nullptr && sponza_material_atlas.IsValid()) {
+		std::vector<size_t> all_meshes(sponza_geometry.size());
+		for (size_t i = 0; i < sponza_geometry.size(); ++i) {
+			sponza_batch->SetMaterialIndex(i, sponza_material_atlas.GetMaterialIndex(i));
+			all_meshes[i] = i;
+		}
+		for (size_t bucket = 0; bucket < sponza_geometry_buckets.size(); ++bucket)
+			sponza_bucket_draw_lists[bucket] = sponza_batch->CreateDrawList(sponza_geometry_buckets[bucket]);
+		sponza_draw_list = sponza_batch->CreateDrawList(all_meshes);
+	}
+	// Texture units used by the atlas' texture arrays, after those of the
+	// per-mesh textures; the shaders' sampler arrays always point to them,
+	// so they never alias a `sampler2D`.
+	GLuint const material_atlas_first_unit = 4u;
+	std::array<GLint, MaterialAtlas::max_texture_arrays_nb> material_atlas_units;
+	for (size_t a = 0; a < material_atlas_units.size(); ++a)
+		material_atlas_units[a] = static_cast<GLint>(material_atlas_first_unit + a);
+
 	//
 	// Load all the shader programs used
 	//
@@ -269,6 +697,46 @@ edan35::Assignment2::run()
 	GBufferShaderLocations fill_gbuffer_shader_locations;
 	fillGBufferShaderLocations(fill_gbuffer_shader, fill_gbuffer_shader_locations);
 
+	// The pre-pass reuses the G-buffer vertex shader, as it has to output
+	// the exact same depths for the G-buffer pass' GL_EQUAL depth test.
+	GLuint depth_prepass_shader = 0u;
+	program_manager.CreateAndRegisterProgram("Depth pre-pass",
+	                                         { { ShaderType::vertex, "EDAN35/fill_gbuffer.vert" },
+	                                           { ShaderType::fragment, "EDAN35/depth_prepass.frag" } },
+	                                         depth_prepass_shader);
+	if (depth_prepass_shader == 0u) {
+		LogError("Failed to load depth pre-pass shader");
+		return;
+	}
+	GBufferShaderLocations depth_prepass_shader_locations;
+	fillGBufferShaderLocations(depth_prepass_shader, depth_prepass_shader_locations);
+
+	// Variants of the above used when drawing through `sponza_batch`;
+	// they share the fragment shaders of the per-mesh programs.
+	GLuint fill_gbuffer_indirect_shader = 0u;
+	GLuint depth_prepass_indirect_shader = 0u;
+	GLuint fill_shadowmap_indirect_shader = 0u;
+	if (sponza_batch != nullptr) {
+		program_manager.CreateAndRegisterProgram("Fill G-Buffer (indirect)",
+		                                         { { ShaderType::vertex, "EDAN35/fill_gbuffer_indirect.vert" },
+		                                           { ShaderType::fragment, "EDAN35/fill_gbuffer.frag" } },
+		                                         fill_gbuffer_indirect_shader);
+		program_manager.CreateAndRegisterProgram("Depth pre-pass (indirect)",
+		                                         { { ShaderType::vertex, "EDAN35/fill_gbuffer_indirect.vert" },
+		                                           { ShaderType::fragment, "EDAN35/depth_prepass.frag" } },
+		                                         depth_prepass_indirect_shader);
+		program_manager.CreateAndRegisterProgram("Fill shadow map (indirect)",
+		                                         { { ShaderType::vertex, "EDAN35/fill_shadowmap_indirect.vert" },
+		                                           { ShaderType::fragment, "EDAN35/fill_shadowmap.frag" } },
+		                                         fill_shadowmap_indirect_shader);
+		if (fill_gbuffer_indirect_shader == 0u || depth_prepass_indirect_shader == 0u || fill_shadowmap_indirect_shader == 0u) {
+			LogWarning("Failed to load the multi-draw indirect shaders: falling back to drawing one mesh at a time.");
+			sponza_batch.reset();
+		}
+	}
+	GBufferShaderLocations fill_gbuffer_indirect_shader_locations;
+	GBufferShaderLocations depth_prepass_indirect_shader_locations;
+
 	GLuint fill_shadowmap_shader = 0u;
 	program_manager.CreateAndRegisterProgram("Fill shadow map",
 	                                         { { ShaderType::vertex, "EDAN35/fill_shadowmap.vert" },
@@ -280,6 +748,12 @@ edan35::Assignment2::run()
 	}
 	FillShadowmapShaderLocations fill_shadowmap_shader_locations;
 	fillShadowmapShaderLocations(fill_shadowmap_shader, fill_shadowmap_shader_locations);
+	FillShadowmapShaderLocations fill_shadowmap_indirect_shader_locations;
+	if (sponza_batch != nullptr) {
+		fillGBufferShaderLocations(fill_gbuffer_indirect_shader, fill_gbuffer_indirect_shader_locations);
+		fillGBufferShaderLocations(depth_prepass_indirect_shader, depth_prepass_indirect_shader_locations);
+		fillShadowmapShaderLocations(fill_shadowmap_indirect_shader, fill_shadowmap_indirect_shader_locations);
+	}
 
 	GLuint accumulate_lights_shader = 0u;
 	program_manager.CreateAndRegisterProgram("Accumulate light",
@@ -303,6 +777,81 @@ edan35::Assignment2::run()
 		return;
 	}
 
+	GLuint downsample_gbuffer_shader = 0u;
+	program_manager.CreateAndRegisterProgram("Downsample G-buffer",
+	                                         { { ShaderType::vertex, "EDAN35/resolve_deferred.vert" },
+	                                           { ShaderType::fragment, "EDAN35/downsample_gbuffer.frag" } },
+	                                         downsample_gbuffer_shader);
+	if (downsample_gbuffer_shader == 0u) {
+		LogError("Failed to load G-buffer downsampling shader");
+		return;
+	}
+
+	GLuint image_difference_shader = 0u;
+	program_manager.CreateAndRegisterProgram("Image difference",
+	                                         { { ShaderType::vertex, "EDAN35/resolve_deferred.vert" },
+	                                           { ShaderType::fragment, "EDAN35/image_difference.frag" } },
+	                                         image_difference_shader);
+	if (image_difference_shader == 0u) {
+		LogError("Failed to load image difference shader");
+		return;
+	}
+
+	GLuint overdraw_heatmap_shader = 0u;
+	program_manager.CreateAndRegisterProgram("Overdraw heat map",
+	                                         { { ShaderType::vertex, "EDAN35/resolve_deferred.vert" },
+	                                           { ShaderType::fragment, "EDAN35/overdraw_heatmap.frag" } },
+	                                         overdraw_heatmap_shader);
+	if (overdraw_heatmap_shader == 0u) {
+		LogError("Failed to load overdraw heat map shader");
+		return;
+	}
+
+	GLuint temporal_antialiasing_shader = 0u;
+	program_manager.CreateAndRegisterProgram("Temporal anti-aliasing",
+	                                         { { ShaderType::vertex, "EDAN35/resolve_deferred.vert" },
+	                                           { ShaderType::fragment, "EDAN35/temporal_antialiasing.frag" } },
+	                                         temporal_antialiasing_shader);
+	if (temporal_antialiasing_shader == 0u) {
+		LogError("Failed to load temporal anti-aliasing shader");
+		return;
+	}
+
+	GLuint blur_shadow_moments_shader = 0u;
+	program_manager.CreateAndRegisterProgram("Blur shadow moments",
+	                                         { { ShaderType::vertex, "EDAN35/resolve_deferred.vert" },
+	                                           { ShaderType::fragment, "EDAN35/blur_shadow_moments.frag" } },
+	                                         blur_shadow_moments_shader);
+	if (blur_shadow_moments_shader == 0u) {
+		LogError("Failed to load shadow moments blurring shader");
+		return;
+	}
+
+	// The Hi-Z culling tests the indirect commands of the G-buffer pass
+	// against the previous frame's depth, entirely on the GPU.
+	GLuint hiz_copy_depth_shader = 0u;
+	GLuint hiz_downsample_shader = 0u;
+	GLuint hiz_cull_shader = 0u;
+	std::unique_ptr<HiZCuller> hiz_culler;
+	if (sponza_batch != nullptr && HiZCuller::IsSupported()) {
+		program_manager.CreateAndRegisterComputeProgram("Hi-Z copy depth", "EDAN35/hiz_copy_depth.comp", hiz_copy_depth_shader);
+		program_manager.CreateAndRegisterComputeProgram("Hi-Z downsample", "EDAN35/hiz_downsample.comp", hiz_downsample_shader);
+		program_manager.CreateAndRegisterComputeProgram("Hi-Z cull", "EDAN35/hiz_cull.comp", hiz_cull_shader);
+		if (hiz_copy_depth_shader != 0u && hiz_downsample_shader != 0u && hiz_cull_shader != 0u) {
+			std::vector<glm::vec3> bounds_min(sponza_mesh_bounds.size());
+			std::vector<glm::vec3> bounds_max(sponza_mesh_bounds.size());
+			std::vector<std::uint8_t> is_bounded(sponza_mesh_bounds.size());
+			for (size_t i = 0; i < sponza_mesh_bounds.size(); ++i) {
+				bounds_min[i] = sponza_mesh_bounds[i].min;
+				bounds_max[i] = sponza_mesh_bounds[i].max;
+				is_bounded[i] = sponza_mesh_bounds[i].is_bounded ? 1u : 0u;
+			}
+			hiz_culler = std::make_unique<HiZCuller>(bounds_min, bounds_max, is_bounded);
+		} else {
+			LogWarning("Failed to load the Hi-Z culling shaders: Hi-Z culling is disabled.");
+		}
+	}
+
 	GLuint render_light_cones_shader = 0u;
 	program_manager.CreateAndRegisterProgram("Render light cones",
 	                                         { { ShaderType::vertex, "EDAN35/render_light_cones.vert" },
@@ -316,10 +865,41 @@ edan35::Assignment2::run()
 	auto const set_uniforms = [](GLuint /*program*/){};
 
 	ViewProjTransforms camera_view_proj_transforms;
-	std::array<ViewProjTransforms, constant::lights_nb> light_view_proj_transforms;
 
 	const GLuint debug_texture_id = bonobo::getDebugTextureID();
 
+	auto const bind_gbuffer_textures = [&samplers,debug_texture_id](GBufferShaderLocations const& locations, GeometryTextureData const& texture_data){
+		auto const default_sampler = samplers[toU(Sampler::Nearest)];
+		auto const mipmap_sampler = samplers[toU(Sampler::Mipmaps)];
+
+		glUniform1i(locations.has_diffuse_texture, texture_data.diffuse_texture_id != 0u ? 1 : 0);
+		glBindSampler(0u, texture_data.diffuse_texture_id != 0u ? mipmap_sampler : default_sampler);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, texture_data.diffuse_texture_id != 0u ? texture_data.diffuse_texture_id : debug_texture_id);
+
+		glUniform1i(locations.has_specular_texture, texture_data.specular_texture_id != 0u ? 1 : 0);
+		glBindSampler(1u, texture_data.specular_texture_id != 0u ? mipmap_sampler : default_sampler);
+		glActiveTexture(GL_TEXTURE1);
+		glBindTexture(GL_TEXTURE_2D, texture_data.specular_texture_id != 0u ? texture_data.specular_texture_id : debug_texture_id);
+
+		glUniform1i(locations.has_normals_texture, texture_data.normals_texture_id != 0u ? 1 : 0);
+		glBindSampler(2u, texture_data.normals_texture_id != 0u ? mipmap_sampler : default_sampler);
+		glActiveTexture(GL_TEXTURE2);
+		glBindTexture(GL_TEXTURE_2D, texture_data.normals_texture_id != 0u ? texture_data.normals_texture_id : debug_texture_id);
+
+		glUniform1i(locations.has_opacity_texture, texture_data.opacity_texture_id != 0u ? 1 : 0);
+		glBindSampler(3u, texture_data.opacity_texture_id != 0u ? mipmap_sampler : default_sampler);
+		glActiveTexture(GL_TEXTURE3);
+		glBindTexture(GL_TEXTURE_2D, texture_data.opacity_texture_id != 0u ? texture_data.opacity_texture_id : debug_texture_id);
+	};
+
+	auto const bind_shadowmap_opacity_texture = [&samplers,debug_texture_id](FillShadowmapShaderLocations const& locations, GeometryTextureData const& texture_data){
+		glUniform1i(locations.has_opacity_texture, texture_data.opacity_texture_id != 0u ? 1 : 0);
+		glBindSampler(0u, texture_data.opacity_texture_id != 0u ? samplers[toU(Sampler::Mipmaps)] : samplers[toU(Sampler::Nearest)]);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, texture_data.opacity_texture_id != 0u ? texture_data.opacity_texture_id : debug_texture_id);
+	};
+
 	auto const bind_texture_with_sampler = [](GLenum target, unsigned int slot, GLuint program, std::string const& name, GLuint texture, GLuint sampler){
 		glActiveTexture(GL_TEXTURE0 + slot);
 		glBindTexture(target, texture);
@@ -331,18 +911,6 @@ edan35::Assignment2::run()
 	//
 	// Setup lights properties
 	//
-	std::array<TRSTransformf, constant::lights_nb> lightTransforms;
-	std::array<glm::vec3, constant::lights_nb> lightColors;
-	int lights_nb = static_cast<int>(constant::lights_nb);
-	bool are_lights_paused = false;
-
-	for (size_t i = 0; i < static_cast<size_t>(lights_nb); ++i) {
-		lightTransforms[i].SetTranslate(glm::vec3(0.0f, 1.25f, 0.0f) * constant::scale_lengths);
-		lightColors[i] = glm::vec3(0.5f + 0.5f * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)),
-		                           0.5f + 0.5f * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)),
-		                           0.5f + 0.5f * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)));
-	}
-
 	float const lightProjectionNearPlane = 0.01f * constant::scale_lengths;
 	float const lightProjectionFarPlane = 20.0f * constant::scale_lengths;
 	auto lightProjection = glm::perspective(0.5f * glm::pi<float>(),
@@ -355,6 +923,28 @@ edan35::Assignment2::run()
 	TRSTransformf lightOffsetTransform;
 	lightOffsetTransform.SetTranslate(glm::vec3(0.0f, 0.0f, -0.4f) * constant::scale_lengths);
 
+	edan35::LightSystem light_system(ubos[toU(UBO::LightViewProjTransforms)], lightProjection,
+	                                 lightOffsetTransform.GetMatrix(), coneScaleTransform.GetMatrix());
+	auto const add_light = [&light_system](){
+		TRSTransformf transform;
+		transform.SetTranslate(glm::vec3(0.0f, 1.25f, 0.0f) * constant::scale_lengths);
+		auto const color = glm::vec3(0.5f + 0.5f * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)),
+		                             0.5f + 0.5f * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)),
+		                             0.5f + 0.5f * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)));
+		light_system.Add(transform, color);
+	};
+	for (size_t i = 0; i < constant::default_lights_nb; ++i)
+		add_light();
+	int lights_nb = static_cast<int>(light_system.GetLightsNb());
+	bool are_lights_paused = false;
+	// Light transforms only need to be updated when the animation time or
+	// the number of lights changes.
+	auto animated_seconds_nb = -1.0f;
+	size_t animated_lights_nb = 0u;
+	// Number of lights rendered during the previous frame, i.e. the number
+	// of light queries with results available.
+	size_t rendered_lights_nb = 0u;
+
 
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 	glClearDepthf(1.0f);
@@ -367,6 +957,81 @@ edan35::Assignment2::run()
 
 	auto seconds_nb = 0.0f;
 	std::array<GLuint64, toU(ElapsedTimeQuery::Count)> pass_elapsed_times;
+	// Keep the latest timings measured with each G-buffer layout, so they
+	// can be compared side by side.
+	struct LayoutTimings {
+		bool is_valid{ false };
+		float gbuffer_ms{ 0.0f };
+		float accumulation_ms{ 0.0f };
+		float resolve_ms{ 0.0f };
+	};
+	std::array<LayoutTimings, toU(GBufferLayout::Count)> layout_timings;
+	DynamicResolution dynamic_resolution;
+	TemporalAntiAliasing taa;
+	auto light_volume_mode = LightVolumeMode::DepthTested;
+	auto shadow_filtering = ShadowFiltering::PCF;
+	int pcf_kernel_radius = 2;
+	int shadow_blur_radius = 2;
+	float light_bleeding_reduction = 0.2f;
+	bool show_shadow_visibility = false;
+	std::vector<LightTimings> light_timings;
+	bool use_depth_prepass = false;
+	// Off by default: culling the shadow casters rasterizes the occluders
+	// once more per light, for up to 128 lights.
+	bool use_occlusion_culling = false;
+	bool cull_shadow_casters = false;
+	bool use_hiz_culling = hiz_culler != nullptr;
+	// Visibility of each mesh, from the camera and from each light.
+	std::vector<std::uint8_t> is_sponza_mesh_visible(sponza_geometry.size(), 1u);
+	std::vector<std::vector<std::uint8_t>> is_sponza_mesh_casting_shadows;
+	// Draw lists of the visible meshes, only rebuilt while culling;
+	// otherwise the static ones are drawn directly.
+	std::array<std::vector<BatchedDrawGroup>, toU(GeometryBucket::Count)> culled_gbuffer_groups;
+	std::array<DrawList, toU(GeometryBucket::Count)> culled_bucket_draw_lists;
+	std::vector<std::array<std::vector<BatchedDrawGroup>, toU(GeometryBucket::Count)>> culled_shadowmap_groups;
+	std::vector<DrawList> culled_shadowmap_draw_lists;
+	OcclusionCuller::Stats camera_occlusion_stats;
+	OcclusionCuller::Stats lights_occlusion_stats;
+	bool use_indirect_draws = sponza_batch != nullptr;
+	bool use_material_atlas = sponza_material_atlas.IsValid();
+	bool show_overdraw = false;
+	float overdraw_heatmap_max = 8.0f;
+	// Keep the latest timings measured with and without the depth
+	// pre-pass, so they can be compared side by side.
+	struct DepthPrepassTimings {
+		bool is_valid{ false };
+		float prepass_ms{ 0.0f };
+		float gbuffer_ms{ 0.0f };
+	};
+	std::array<DepthPrepassTimings, 2> depth_prepass_timings;
+	// Keep the latest statistics measured with each light volume mode, so
+	// they can be compared side by side.
+	struct LightVolumeStats {
+		bool is_valid{ false };
+		float accumulation_ms{ 0.0f };
+		GLuint64 shaded_pixels{ 0u };
+	};
+	std::array<LightVolumeStats, toU(LightVolumeMode::Count)> light_volume_stats;
+	// Same for each shadow filtering; the error is the one of the latest
+	// image comparison made with that filtering.
+	struct ShadowFilteringStats {
+		bool is_valid{ false };
+		float shadow_maps_ms{ 0.0f };
+		float accumulation_ms{ 0.0f };
+		bool has_error{ false };
+		float mean_absolute_error{ 0.0f };
+	};
+	std::array<ShadowFilteringStats, toU(ShadowFiltering::Count)> shadow_filtering_stats;
+	struct LightingResolutionStats {
+		bool is_valid{ false };
+		float downsample_ms{ 0.0f };
+		float accumulation_ms{ 0.0f };
+		float resolve_ms{ 0.0f };
+	};
+	std::array<LightingResolutionStats, toU(LightingResolution::Count)> lighting_resolution_stats;
+	// The clock drives the camera and the light animation, while the real
+	// time elapsed is kept for the performance measurements.
+	FrameClock frame_clock(mWindowManager.GetFrameClockSettings());
 	auto lastTime = std::chrono::high_resolution_clock::now();
 	bool show_textures = true;
 	bool show_cone_wireframe = false;
@@ -377,27 +1042,52 @@ edan35::Assignment2::run()
 	bool copy_elapsed_times = true;
 	bool first_frame = true;
 	bool show_basis = false;
+	bool show_frame_profiler = false;
+	bool show_gpu_memory = false;
 	float basis_thickness_scale = 40.0f;
 	float basis_length_scale = 400.0f;
 
+	std::unique_ptr<Benchmark> benchmark;
+	if (!mBenchmarkSettings.camera_path_filename.empty())
+		benchmark = std::make_unique<Benchmark>(mBenchmarkSettings);
+
+	PROFILE_THREAD("Main thread");
 	while (!glfwWindowShouldClose(window)) {
+		PROFILE_NEW_FRAME();
+		PROFILE_SCOPE("Frame");
 		auto const nowTime = std::chrono::high_resolution_clock::now();
 		auto const deltaTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(nowTime - lastTime);
 		lastTime = nowTime;
-		if (!are_lights_paused)
-			seconds_nb += std::chrono::duration<decltype(seconds_nb)>(deltaTimeUs).count();
+		frame_clock.SetPaused(are_lights_paused);
+		frame_clock.Tick();
+		seconds_nb = frame_clock.GetInterpolatedSimulationTime();
 
 		auto& io = ImGui::GetIO();
 		inputHandler.SetUICapture(io.WantCaptureMouse, io.WantCaptureKeyboard);
 
-		glfwPollEvents();
+		{
+			PROFILE_SCOPE("Poll events");
+			glfwPollEvents();
+		}
 		inputHandler.Advance();
-		mCamera.Update(deltaTimeUs, inputHandler);
-
-		camera_view_proj_transforms.view_projection = mCamera.GetWorldToClipMatrix();
-		camera_view_proj_transforms.view_projection_inverse = mCamera.GetClipToWorldMatrix();
-
-		auto const view_projection = camera_view_proj_transforms.view_projection;
+		if (benchmark != nullptr) {
+			// Everything the path does not control is left at its default,
+			// except for the dynamic resolution which would make the
+			// frames incomparable.
+			auto const& camera_path = benchmark->GetCameraPath();
+			auto const path_time = benchmark->GetPathTime();
+			glm::vec3 camera_position, camera_target;
+			camera_path.Evaluate(path_time, camera_position, camera_target);
+			mCamera.mWorld.SetTranslate(camera_position);
+			mCamera.mWorld.LookAt(camera_target);
+			lights_nb = glm::clamp(camera_path.GetLightsNb(), 1, static_cast<int>(LightSystem::max_lights_nb));
+			seconds_nb = camera_path.AreLightsAnimated() ? path_time : 0.0f;
+			dynamic_resolution.enabled = false;
+			show_gui = false;
+			show_logs = false;
+		} else {
+			mCamera.Update(frame_clock.GetFrameDuration(), inputHandler);
+		}
 
 		if (inputHandler.GetKeycodeState(GLFW_KEY_R) & JUST_PRESSED) {
 			shader_reload_failed = !program_manager.ReloadAllPrograms();
@@ -411,7 +1101,13 @@ edan35::Assignment2::run()
 			else
 			{
 				fillGBufferShaderLocations(fill_gbuffer_shader, fill_gbuffer_shader_locations);
+				fillGBufferShaderLocations(depth_prepass_shader, depth_prepass_shader_locations);
 				fillShadowmapShaderLocations(fill_shadowmap_shader, fill_shadowmap_shader_locations);
+				if (sponza_batch != nullptr) {
+					fillGBufferShaderLocations(fill_gbuffer_indirect_shader, fill_gbuffer_indirect_shader_locations);
+					fillGBufferShaderLocations(depth_prepass_indirect_shader, depth_prepass_indirect_shader_locations);
+					fillShadowmapShaderLocations(fill_shadowmap_indirect_shader, fill_shadowmap_indirect_shader_locations);
+				}
 				fillAccumulateLightsShaderLocations(accumulate_lights_shader, accumulate_light_shader_locations);
 			}
 		}
@@ -424,252 +1120,977 @@ edan35::Assignment2::run()
 
 		if (!first_frame && show_gui && copy_elapsed_times) {
 			// Copy all timings back from the GPU to the CPU.
-			for (GLuint i = 0; i < pass_elapsed_times.size(); ++i) {
-				glGetQueryObjectui64v(elapsed_time_queries[i], GL_QUERY_RESULT, pass_elapsed_times.data() + i);
+			{
+				PROFILE_SCOPE("Wait for GPU timings");
+				for (GLuint i = 0; i < pass_elapsed_times.size(); ++i) {
+					glGetQueryObjectui64v(elapsed_time_queries[i], GL_QUERY_RESULT, pass_elapsed_times.data() + i);
+				}
 			}
+
+			auto& timings = layout_timings[toU(render_targets_config.gbuffer_layout)];
+			timings.is_valid = true;
+			// The frame graph reads its timings back a few frames later,
+			// without waiting for them.
+			timings.gbuffer_ms = frame_graph.GetPassGpuTime(pass_name::gbuffer);
+			timings.resolve_ms = frame_graph.GetPassGpuTime(pass_name::resolve);
+
+			auto& prepass_timings = depth_prepass_timings[use_depth_prepass ? 1 : 0];
+			prepass_timings.is_valid = true;
+			prepass_timings.prepass_ms = frame_graph.GetPassGpuTime(pass_name::depth_prepass);
+			prepass_timings.gbuffer_ms = timings.gbuffer_ms;
+
+			light_timings.resize(rendered_lights_nb);
+			auto shadow_maps_ms = 0.0f;
+			timings.accumulation_ms = 0.0f;
+			auto& stats = light_volume_stats[toU(light_volume_mode)];
+			stats.is_valid = true;
+			stats.shaded_pixels = 0u;
+			for (size_t i = 0; i < rendered_lights_nb; ++i) {
+				glGetQueryObjectui64v(light_queries[i].shadow_map_generation, GL_QUERY_RESULT, &light_timings[i].shadow_map_generation);
+				glGetQueryObjectui64v(light_queries[i].accumulation, GL_QUERY_RESULT, &light_timings[i].accumulation);
+				glGetQueryObjectui64v(light_queries[i].shaded_pixels, GL_QUERY_RESULT, &light_timings[i].shaded_pixels);
+				shadow_maps_ms += light_timings[i].shadow_map_generation / 1000000.0f;
+				timings.accumulation_ms += light_timings[i].accumulation / 1000000.0f;
+				stats.shaded_pixels += light_timings[i].shaded_pixels;
+			}
+			stats.accumulation_ms = timings.accumulation_ms;
+
+			auto& filtering_stats = shadow_filtering_stats[toU(shadow_filtering)];
+			filtering_stats.is_valid = true;
+			filtering_stats.shadow_maps_ms = shadow_maps_ms;
+			filtering_stats.accumulation_ms = timings.accumulation_ms;
+
+			auto& resolution_stats = lighting_resolution_stats[toU(render_targets_config.lighting_resolution)];
+			resolution_stats.is_valid = true;
+			resolution_stats.downsample_ms = frame_graph.GetPassGpuTime(pass_name::downsample);
+			resolution_stats.accumulation_ms = timings.accumulation_ms;
+			resolution_stats.resolve_ms = timings.resolve_ms;
 		}
 
+		// Only the frame graph's timings are used, as they are read back
+		// a few frames late without waiting for the GPU; the passes run
+		// after the graph (GUI, copy to the framebuffer) are left out.
+		if (dynamic_resolution.enabled) {
+			auto const& gpu_times = frame_graph.GetLatestFrameGpuTimes();
+			if (gpu_times.is_valid && gpu_times.frame_index != dynamic_resolution.measured_frame_index) {
+				auto scalable_ms = 0.0f;
+				auto fixed_ms = 0.0f;
+				for (auto const& pass_time : gpu_times.pass_times_ms)
+					(isScalablePass(pass_time.first) ? scalable_ms : fixed_ms) += pass_time.second;
+				auto const measured_scale = dynamic_resolution.frame_scales[gpu_times.frame_index % dynamic_resolution.frame_scales.size()];
+				updateDynamicResolution(dynamic_resolution, measured_scale, scalable_ms, fixed_ms);
+				dynamic_resolution.measured_frame_index = gpu_times.frame_index;
+			}
+		} else {
+			dynamic_resolution.smoothed_scalable_ms = 0.0f;
+			dynamic_resolution.smoothed_fixed_ms = 0.0f;
+		}
+		dynamic_resolution.frame_scales[frame_graph.GetExecutedFramesNb() % dynamic_resolution.frame_scales.size()] = dynamic_resolution.scale;
+		auto const render_size = computeRenderSize(dynamic_resolution.scale, framebuffer_width, framebuffer_height);
 
-		for (size_t i = 0; i < static_cast<size_t>(lights_nb); ++i) {
-			auto& lightTransform = lightTransforms[i];
-			lightTransform.SetRotate(glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(constant::lights_nb) + 0.1f * seconds_nb, glm::vec3(0.0f, 1.0f, 0.0f));
+		// The history is only valid for the render size it was
+		// accumulated at.
+		if (!taa.enabled || shader_reload_failed || taa.history_render_size != render_size)
+			taa.has_history = false;
+		auto const taa_jitter = taa.enabled ? 2.0f * getTaaJitter(taa.frame_index) / glm::vec2(render_size) : glm::vec2(0.0f);
+		mCamera.SetJitter(taa_jitter);
+		taa.frame_index = (taa.frame_index + 1u) % taa_jitter_samples_nb;
 
-			auto const light_view_matrix = lightOffsetTransform.GetMatrixInverse() * lightTransform.GetMatrixInverse();
-			auto const light_world_matrix = glm::inverse(light_view_matrix) * coneScaleTransform.GetMatrix();
-			auto const light_world_to_clip_matrix = lightProjection * light_view_matrix;
+		camera_view_proj_transforms.view_projection = mCamera.GetWorldToClipMatrix();
+		camera_view_proj_transforms.view_projection_inverse = mCamera.GetClipToWorldMatrix();
+
+		auto const view_projection = camera_view_proj_transforms.view_projection;
 
-			light_view_proj_transforms[i].view_projection = light_world_to_clip_matrix;
-			light_view_proj_transforms[i].view_projection_inverse = glm::inverse(light_world_to_clip_matrix);
+		if (selected_render_targets_config != render_targets_config) {
+			// The render targets of the previous configuration are not
+			// needed anymore; release them before allocating the new ones.
+			glDeleteFramebuffers(static_cast<GLsizei>(fbos.size()), fbos.data());
+			glDeleteTextures(static_cast<GLsizei>(textures.size()), textures.data());
+
+			// The frame graph's cached framebuffer objects might reference
+			// the deleted textures.
+			frame_graph.ReleaseResources();
+
+			render_targets_config = selected_render_targets_config;
+			textures = createTextures(framebuffer_width, framebuffer_height, render_targets_config);
+			fbos = createFramebufferObjects(textures);
+			taa.has_history = false;
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, fbos[toU(FBO::Resolve)]);
+		}
+		auto const gbuffer_layout = render_targets_config.gbuffer_layout;
+		bool const use_compact_gbuffer = gbuffer_layout == GBufferLayout::Compact;
+		auto const lighting_downscale = getLightingDownscale(render_targets_config.lighting_resolution);
+		auto const lighting_texture_size = (glm::ivec2(framebuffer_width, framebuffer_height) + lighting_downscale - 1) / lighting_downscale;
+		auto const lighting_render_size = (render_size + lighting_downscale - 1) / lighting_downscale;
+
+
+		while (light_system.GetLightsNb() < static_cast<size_t>(lights_nb))
+			add_light();
+		while (light_system.GetLightsNb() > static_cast<size_t>(lights_nb))
+			light_system.Remove(light_system.GetLightsNb() - 1u);
+		resizeLightQueries(light_queries, light_system.GetLightsNb());
+
+		if (seconds_nb != animated_seconds_nb || light_system.GetLightsNb() != animated_lights_nb) {
+			for (size_t i = 0; i < light_system.GetLightsNb(); ++i) {
+				auto lightTransform = light_system.GetTransform(i);
+				lightTransform.SetRotate(glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(light_system.GetLightsNb()) + 0.1f * seconds_nb, glm::vec3(0.0f, 1.0f, 0.0f));
+				light_system.SetTransform(i, lightTransform);
+			}
+			animated_seconds_nb = seconds_nb;
+			animated_lights_nb = light_system.GetLightsNb();
 		}
 
 
 		//
 		// Update per-frame changing UBOs.
 		//
-		glBindBuffer(GL_UNIFORM_BUFFER, ubos[toU(UBO::CameraViewProjTransforms)]);
-		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(camera_view_proj_transforms), &camera_view_proj_transforms);
-		glBindBuffer(GL_UNIFORM_BUFFER, ubos[toU(UBO::LightViewProjTransforms)]);
-		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(light_view_proj_transforms), light_view_proj_transforms.data());
-		glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+		streaming_uniforms.BeginFrame();
+		if (use_streaming_uniforms) {
+			auto const camera_allocation = streaming_uniforms.Upload(&camera_view_proj_transforms, sizeof(camera_view_proj_transforms));
+			streaming_uniforms.Bind(toU(UBO::CameraViewProjTransforms), camera_allocation);
+		} else {
+			glBindBuffer(GL_UNIFORM_BUFFER, ubos[toU(UBO::CameraViewProjTransforms)]);
+			glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(camera_view_proj_transforms), &camera_view_proj_transforms);
+			glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+			glBindBufferBase(GL_UNIFORM_BUFFER, toU(UBO::CameraViewProjTransforms), ubos[toU(UBO::CameraViewProjTransforms)]);
+		}
+		light_system.Update();
+
+
+		//
+		// Find out which meshes might be visible from the camera and, for
+		// the shadow maps, from each light.
+		//
+		std::fill(is_sponza_mesh_visible.begin(), is_sponza_mesh_visible.end(), 1u);
+		is_sponza_mesh_casting_shadows.resize(light_system.GetLightsNb());
+		for (auto& is_mesh_casting_shadows : is_sponza_mesh_casting_shadows)
+			is_mesh_casting_shadows.assign(sponza_geometry.size(), 1u);
+		camera_occlusion_stats = OcclusionCuller::Stats();
+		lights_occlusion_stats = OcclusionCuller::Stats();
+		auto const test_sponza_meshes = [&occlusion_culler, &sponza_mesh_bounds](std::vector<std::uint8_t>& is_mesh_visible){
+			for (size_t i = 0; i < sponza_mesh_bounds.size(); ++i) {
+				auto const& bounds = sponza_mesh_bounds[i];
+				is_mesh_visible[i] = !bounds.is_bounded || occlusion_culler.IsVisible(bounds.min, bounds.max) ? 1u : 0u;
+			}
+		};
+		if (use_occlusion_culling) {
+			PROFILE_SCOPE("CPU occlusion culling");
+			occlusion_culler.Rasterize(view_projection);
+			test_sponza_meshes(is_sponza_mesh_visible);
+			camera_occlusion_stats = occlusion_culler.GetStats();
+
+			// Casters hidden from a light, or outside of its cone, do not
+			// contribute to its shadow map.
+			if (cull_shadow_casters) {
+				for (size_t i = 0; i < light_system.GetLightsNb(); ++i) {
+					occlusion_culler.Rasterize(light_system.GetViewProjTransforms(i).view_projection);
+					test_sponza_meshes(is_sponza_mesh_casting_shadows[i]);
+					auto const& stats = occlusion_culler.GetStats();
+					lights_occlusion_stats.occluder_triangles_nb += stats.occluder_triangles_nb;
+					lights_occlusion_stats.rasterized_triangles_nb += stats.rasterized_triangles_nb;
+					lights_occlusion_stats.tested_boxes_nb += stats.tested_boxes_nb;
+					lights_occlusion_stats.culled_boxes_nb += stats.culled_boxes_nb;
+					lights_occlusion_stats.rasterization_ms += stats.rasterization_ms;
+				}
+			}
+		}
+
+		// The indirect path submits transient draw lists, only made of the
+		// meshes which passed the tests above; the G-buffer ones are then
+		// culled further on the GPU, against the previous frame's Hi-Z
+		// pyramid.
+		bool const is_hiz_culling_enabled = hiz_culler != nullptr && use_hiz_culling && use_indirect_draws && !shader_reload_failed;
+		if (hiz_culler != nullptr && !is_hiz_culling_enabled)
+			hiz_culler->Invalidate();
+		size_t hiz_first_command = 0u;
+		size_t hiz_commands_nb = 0u;
+		bool const are_meshes_culled = sponza_batch != nullptr && (use_occlusion_culling || is_hiz_culling_enabled) && use_indirect_draws;
+		bool const are_shadow_casters_culled = sponza_batch != nullptr && use_occlusion_culling && cull_shadow_casters && use_indirect_draws;
+		if (sponza_batch != nullptr) {
+			sponza_batch->ResetTransientDrawLists();
+			hiz_first_command = sponza_batch->GetCommandsNb();
+			if (are_meshes_culled) {
+				for (size_t bucket = 0; bucket < sponza_geometry_buckets.size(); ++bucket) {
+					if (use_material_atlas)
+						culled_bucket_draw_lists[bucket] = sponza_batch->CreateTransientDrawList(sponza_bucket_draw_lists[bucket], is_sponza_mesh_visible);
+					else
+						culled_gbuffer_groups[bucket] = createVisibleDrawGroups(*sponza_batch, sponza_gbuffer_groups[bucket], is_sponza_mesh_visible);
+				}
+				// Without the material atlas, the depth pre-pass still
+				// goes through the G-buffer groups.
+				if (use_material_atlas && use_depth_prepass)
+					culled_gbuffer_groups[toU(GeometryBucket::Opaque)] = createVisibleDrawGroups(*sponza_batch, sponza_gbuffer_groups[toU(GeometryBucket::Opaque)], is_sponza_mesh_visible);
+			}
+			hiz_commands_nb = sponza_batch->GetCommandsNb() - hiz_first_command;
+			if (are_shadow_casters_culled) {
+				culled_shadowmap_groups.resize(light_system.GetLightsNb());
+				culled_shadowmap_draw_lists.resize(light_system.GetLightsNb());
+				for (size_t i = 0; i < light_system.GetLightsNb(); ++i) {
+					if (use_material_atlas) {
+						culled_shadowmap_draw_lists[i] = sponza_batch->CreateTransientDrawList(sponza_draw_list, is_sponza_mesh_casting_shadows[i]);
+						continue;
+					}
+					for (size_t bucket = 0; bucket < sponza_geometry_buckets.size(); ++bucket)
+						culled_shadowmap_groups[i][bucket] = createVisibleDrawGroups(*sponza_batch, sponza_shadowmap_groups[bucket], is_sponza_mesh_casting_shadows[i]);
+				}
+			}
+		}
+		auto const& visible_gbuffer_groups = are_meshes_culled ? culled_gbuffer_groups : sponza_gbuffer_groups;
+		auto const& visible_bucket_draw_lists = are_meshes_culled ? culled_bucket_draw_lists : sponza_bucket_draw_lists;
+		auto const get_visible_shadowmap_groups = [&](size_t light_index) -> decltype(sponza_shadowmap_groups) const& {
+			return are_shadow_casters_culled ? culled_shadowmap_groups[light_index] : sponza_shadowmap_groups;
+		};
+		auto const get_visible_shadowmap_draw_list = [&](size_t light_index) -> DrawList const& {
+			return are_shadow_casters_culled ? culled_shadowmap_draw_lists[light_index] : sponza_draw_list;
+		};
 
 
+		rendered_lights_nb = shader_reload_failed ? 0u : light_system.GetLightsNb();
+		GLuint displayed_shadow_map = 0u;
+		GLuint displayed_light_diffuse_contribution = 0u;
+		GLuint displayed_light_specular_contribution = 0u;
 		if (!shader_reload_failed) {
 			//
-			// Pass 1: Render scene into the g-buffer
+			// Declare the textures used by the frame: the G-buffer and the
+			// final image are kept from one frame to the next, while the
+			// other targets are only alive during the frame and can share
+			// their storage.
 			//
-			utils::opengl::debug::beginDebugGroup("Fill G-buffer");
-			glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::GbufferGeneration)]);
-
-			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbos[toU(FBO::GBuffer)]);
-			glViewport(0, 0, framebuffer_width, framebuffer_height);
-			glClear(GL_DEPTH_BUFFER_BIT);
-			// XXX: Is any other clearing needed?
-
-			glUseProgram(fill_gbuffer_shader);
-			glUniform1i(fill_gbuffer_shader_locations.diffuse_texture, 0);
-			glUniform1i(fill_gbuffer_shader_locations.specular_texture, 1);
-			glUniform1i(fill_gbuffer_shader_locations.normals_texture, 2);
-			glUniform1i(fill_gbuffer_shader_locations.opacity_texture, 3);
-			for (std::size_t i = 0; i < sponza_geometry.size(); ++i)
-			{
-				auto const& geometry = sponza_geometry[i];
-				auto const& texture_data = sponza_geometry_texture_data[i];
-
-				utils::opengl::debug::beginDebugGroup(geometry.name);
+			frame_graph.Reset();
+			auto const depth_buffer = frame_graph.ImportTexture("Depth buffer", textures[toU(Texture::DepthBuffer)]);
+			auto const gbuffer_diffuse = frame_graph.ImportTexture("GBuffer diffuse", textures[toU(Texture::GBufferDiffuse)]);
+			auto const gbuffer_specular = frame_graph.ImportTexture("GBuffer specular", textures[toU(Texture::GBufferSpecular)]);
+			auto const gbuffer_normal = frame_graph.ImportTexture("GBuffer normals", textures[toU(Texture::GBufferWorldSpaceNormal)]);
+			auto const result = frame_graph.ImportTexture("Final result", textures[toU(Texture::Result)]);
+			auto const previous_taa_history = frame_graph.ImportTexture("Previous TAA history", textures[toU(Texture::TaaHistory0) + taa.history_index]);
+			auto const taa_history = frame_graph.ImportTexture("TAA history", textures[toU(Texture::TaaHistory0) + 1u - taa.history_index]);
+
+			auto const transient_descriptions = createTransientTextureDescriptions(framebuffer_width, framebuffer_height, render_targets_config);
+			auto const overdraw = frame_graph.CreateTexture("Overdraw", transient_descriptions.overdraw);
+			auto const low_res_depth_buffer = frame_graph.CreateTexture("Low-resolution depth buffer", transient_descriptions.low_res_depth);
+			auto const low_res_normal = frame_graph.CreateTexture("Low-resolution normals", transient_descriptions.low_res_normal);
+			auto const light_diffuse_contribution = frame_graph.CreateTexture("Light diffuse contribution", transient_descriptions.light_contribution);
+			auto const light_specular_contribution = frame_graph.CreateTexture("Light specular contribution", transient_descriptions.light_contribution);
+			// With TAA, the resolve pass renders a jittered image which is
+			// then blended into the history to produce the final one.
+			auto const resolved_image = taa.enabled ? frame_graph.CreateTexture("Jittered result", transient_descriptions.jittered_result) : result;
+			if (show_textures) {
+				frame_graph.MarkAsOutput(light_diffuse_contribution);
+				frame_graph.MarkAsOutput(light_specular_contribution);
+			}
 
-				auto const vertex_model_to_world = glm::mat4(1.0f);
-				auto const normal_model_to_world = glm::mat4(1.0f);
+			// When lights are accumulated at full resolution, they directly
+			// use the G-buffer depth and normals, and the downsampling pass
+			// gets culled.
+			auto const lighting_depth_buffer = lighting_downscale > 1 ? low_res_depth_buffer : depth_buffer;
+			auto const lighting_normal = lighting_downscale > 1 ? low_res_normal : gbuffer_normal;
 
-				glUniformMatrix4fv(fill_gbuffer_shader_locations.vertex_model_to_world, 1, GL_FALSE, glm::value_ptr(vertex_model_to_world));
-				glUniformMatrix4fv(fill_gbuffer_shader_locations.normal_model_to_world, 1, GL_FALSE, glm::value_ptr(normal_model_to_world));
 
-				auto const default_sampler = samplers[toU(Sampler::Nearest)];
-				auto const mipmap_sampler = samplers[toU(Sampler::Mipmaps)];
+			//
+			// Pass -1: Cull the G-buffer commands against the Hi-Z pyramid
+			// of the previous frame.
+			//
+			if (is_hiz_culling_enabled && hiz_culler->HasPyramid() && hiz_commands_nb != 0u) {
+				frame_graph.AddPass(pass_name::hiz_culling, [&](FrameGraph::PassBuilder& builder){
+					// The pass only writes to the indirect buffer.
+					builder.SetSideEffects();
+				}, [&](FrameGraph::PassResources const& /*resources*/){
+					hiz_culler->Cull(hiz_cull_shader, sponza_batch->GetIndirectBuffer(), hiz_first_command, hiz_commands_nb);
+				});
+			}
 
-				glUniform1i(fill_gbuffer_shader_locations.has_diffuse_texture, texture_data.diffuse_texture_id != 0u ? 1 : 0);
-				glBindSampler(0u, texture_data.diffuse_texture_id != 0u ? mipmap_sampler : default_sampler);
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, texture_data.diffuse_texture_id != 0u ? texture_data.diffuse_texture_id : debug_texture_id);
 
-				glUniform1i(fill_gbuffer_shader_locations.has_specular_texture, texture_data.specular_texture_id != 0u ? 1 : 0);
-				glBindSampler(1u, texture_data.specular_texture_id != 0u ? mipmap_sampler : default_sampler);
-				glActiveTexture(GL_TEXTURE1);
-				glBindTexture(GL_TEXTURE_2D, texture_data.specular_texture_id != 0u ? texture_data.specular_texture_id : debug_texture_id);
+			//
+			// Pass 0: Fill the depth buffer with the opaque geometry only,
+			// so that the G-buffer pass only shades visible fragments.
+			//
+			if (use_depth_prepass) {
+				frame_graph.AddPass(pass_name::depth_prepass, [&](FrameGraph::PassBuilder& builder){
+					builder.Write(depth_buffer, GL_DEPTH_STENCIL_ATTACHMENT);
+				}, [&](FrameGraph::PassResources const& /*resources*/){
+					glViewport(0, 0, render_size.x, render_size.y);
+					glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+					if (use_indirect_draws) {
+						// Opaque geometry does not need any texture here.
+						glUseProgram(depth_prepass_indirect_shader);
+						for (auto const& group : visible_gbuffer_groups[toU(GeometryBucket::Opaque)])
+							sponza_batch->Draw(group.draw_list);
+					} else {
+						glUseProgram(depth_prepass_shader);
+						for (auto const i : sponza_geometry_buckets[toU(GeometryBucket::Opaque)])
+						{
+							if (is_sponza_mesh_visible[i] == 0u)
+								continue;
+
+							auto const& geometry = sponza_geometry[i];
+
+							auto const vertex_model_to_world = glm::mat4(1.0f);
+							glUniformMatrix4fv(depth_prepass_shader_locations.vertex_model_to_world, 1, GL_FALSE, glm::value_ptr(vertex_model_to_world));
+
+							glBindVertexArray(geometry.vao);
+							if (geometry.ibo != 0u)
+								glDrawElements(geometry.drawing_mode, geometry.indices_nb, GL_UNSIGNED_INT, reinterpret_cast<GLvoid const*>(0x0));
+							else
+								glDrawArrays(geometry.drawing_mode, 0, geometry.vertices_nb);
+						}
+					}
+					glBindVertexArray(0u);
+					glUseProgram(0u);
+				});
+			}
 
-				glUniform1i(fill_gbuffer_shader_locations.has_normals_texture, texture_data.normals_texture_id != 0u ? 1 : 0);
-				glBindSampler(2u, texture_data.normals_texture_id != 0u ? mipmap_sampler : default_sampler);
-				glActiveTexture(GL_TEXTURE2);
-				glBindTexture(GL_TEXTURE_2D, texture_data.normals_texture_id != 0u ? texture_data.normals_texture_id : debug_texture_id);
 
-				glUniform1i(fill_gbuffer_shader_locations.has_opacity_texture, texture_data.opacity_texture_id != 0u ? 1 : 0);
-				glBindSampler(3u, texture_data.opacity_texture_id != 0u ? mipmap_sampler : default_sampler);
-				glActiveTexture(GL_TEXTURE3);
-				glBindTexture(GL_TEXTURE_2D, texture_data.opacity_texture_id != 0u ? texture_data.opacity_texture_id : debug_texture_id);
+			//
+			// Pass 1: Render scene into the g-buffer
+			//
+			frame_graph.AddPass(pass_name::gbuffer, [&](FrameGraph::PassBuilder& builder){
+				builder.Write(gbuffer_diffuse, GL_COLOR_ATTACHMENT0);
+				// The compact layout packs the specular intensity into the
+				// diffuse texture, so the output at location 1 is discarded.
+				if (!use_compact_gbuffer)
+					builder.Write(gbuffer_specular, GL_COLOR_ATTACHMENT1);
+				builder.Write(gbuffer_normal, GL_COLOR_ATTACHMENT2);
+				if (show_overdraw)
+					builder.Write(overdraw, GL_COLOR_ATTACHMENT3);
+				builder.Write(depth_buffer, GL_DEPTH_STENCIL_ATTACHMENT);
+			}, [&](FrameGraph::PassResources const& /*resources*/){
+				glViewport(0, 0, render_size.x, render_size.y);
+				if (!use_depth_prepass)
+					glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+				// XXX: Is any other clearing needed?
+
+				// The overdraw counter (draw buffer 3) is only written to when
+				// its heat map is displayed, and accumulates additively.
+				glColorMaski(3, show_overdraw, GL_FALSE, GL_FALSE, GL_FALSE);
+				if (show_overdraw) {
+					std::array<GLfloat, 4> const zero{ 0.0f, 0.0f, 0.0f, 0.0f };
+					glClearBufferfv(GL_COLOR, 3, zero.data());
+					glEnablei(GL_BLEND, 3);
+					glBlendEquationi(3, GL_FUNC_ADD);
+					glBlendFunci(3, GL_ONE, GL_ONE);
+				}
 
-				glBindVertexArray(geometry.vao);
-				if (geometry.ibo != 0u)
-					glDrawElements(geometry.drawing_mode, geometry.indices_nb, GL_UNSIGNED_INT, reinterpret_cast<GLvoid const*>(0x0));
-				else
-					glDrawArrays(geometry.drawing_mode, 0, geometry.vertices_nb);
+				auto const gbuffer_shader = use_indirect_draws ? fill_gbuffer_indirect_shader : fill_gbuffer_shader;
+				auto const& gbuffer_shader_locations = use_indirect_draws ? fill_gbuffer_indirect_shader_locations : fill_gbuffer_shader_locations;
+				glUseProgram(gbuffer_shader);
+				glUniform1i(gbuffer_shader_locations.diffuse_texture, 0);
+				glUniform1i(gbuffer_shader_locations.specular_texture, 1);
+				glUniform1i(gbuffer_shader_locations.normals_texture, 2);
+				glUniform1i(gbuffer_shader_locations.opacity_texture, 3);
+				glUniform1i(gbuffer_shader_locations.use_compact_gbuffer, use_compact_gbuffer ? 1 : 0);
+				if (use_indirect_draws) {
+					// The indirect vertex shader outputs world-space normals.
+					auto const normal_model_to_world = glm::mat4(1.0f);
+					glUniformMatrix4fv(gbuffer_shader_locations.normal_model_to_world, 1, GL_FALSE, glm::value_ptr(normal_model_to_world));
+				}
+				glUniform1iv(gbuffer_shader_locations.material_texture_arrays, static_cast<GLsizei>(material_atlas_units.size()), material_atlas_units.data());
+				glUniform1i(gbuffer_shader_locations.use_material_atlas, use_material_atlas ? 1 : 0);
+				if (use_material_atlas)
+					sponza_material_atlas.BindTextureArrays(material_atlas_first_unit, samplers[toU(Sampler::Mipmaps)]);
+				for (std::size_t bucket = 0; bucket < sponza_geometry_buckets.size(); ++bucket)
+				{
+					// With the depth pre-pass, opaque geometry only shades the
+					// fragments matching the pre-pass depth. Alpha-tested geometry
+					// was left out of the pre-pass, so it still relies on the
+					// regular depth test and writes.
+					bool const is_prepassed = use_depth_prepass && bucket == toU(GeometryBucket::Opaque);
+					glDepthFunc(is_prepassed ? GL_EQUAL : GL_LESS);
+					glDepthMask(is_prepassed ? GL_FALSE : GL_TRUE);
+
+					if (use_indirect_draws && use_material_atlas) {
+						sponza_batch->Draw(visible_bucket_draw_lists[bucket]);
+						continue;
+					}
+					if (use_indirect_draws) {
+						for (auto const& group : visible_gbuffer_groups[bucket]) {
+							bind_gbuffer_textures(gbuffer_shader_locations, group.texture_data);
+							sponza_batch->Draw(group.draw_list);
+						}
+						continue;
+					}
+
+					for (auto const i : sponza_geometry_buckets[bucket])
+					{
+						if (is_sponza_mesh_visible[i] == 0u)
+							continue;
+
+						auto const& geometry = sponza_geometry[i];
+						auto const& texture_data = sponza_geometry_texture_data[i];
+
+						utils::opengl::debug::beginDebugGroup(geometry.name);
+
+						auto const vertex_model_to_world = glm::mat4(1.0f);
+						auto const normal_model_to_world = glm::mat4(1.0f);
+
+						glUniformMatrix4fv(gbuffer_shader_locations.vertex_model_to_world, 1, GL_FALSE, glm::value_ptr(vertex_model_to_world));
+						glUniformMatrix4fv(gbuffer_shader_locations.normal_model_to_world, 1, GL_FALSE, glm::value_ptr(normal_model_to_world));
+
+						if (use_material_atlas)
+							glUniform1ui(gbuffer_shader_locations.material_index, sponza_material_atlas.GetMaterialIndex(i));
+						else
+							bind_gbuffer_textures(gbuffer_shader_locations, texture_data);
+
+						glBindVertexArray(geometry.vao);
+						if (geometry.ibo != 0u)
+							glDrawElements(geometry.drawing_mode, geometry.indices_nb, GL_UNSIGNED_INT, reinterpret_cast<GLvoid const*>(0x0));
+						else
+							glDrawArrays(geometry.drawing_mode, 0, geometry.vertices_nb);
+
+
+						utils::opengl::debug::endDebugGroup();
+					}
+				}
+				if (use_material_atlas)
+					sponza_material_atlas.UnbindTextureArrays(material_atlas_first_unit);
+				glDepthFunc(GL_LESS);
+				glDepthMask(GL_TRUE);
+				glDisablei(GL_BLEND, 3);
+				glColorMaski(3, GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+				glBindTexture(GL_TEXTURE_2D, 0);
+				glBindVertexArray(0u);
+				glUseProgram(0u);
+			});
 
 
-				utils::opengl::debug::endDebugGroup();
-			}
-			glBindTexture(GL_TEXTURE_2D, 0);
-			glBindVertexArray(0u);
-			glUseProgram(0u);
 
-			glEndQuery(GL_TIME_ELAPSED);
-			utils::opengl::debug::endDebugGroup();
+			//
+			// Pass 1.5: Downsample the depth and normals, when lights are
+			// accumulated at a lower resolution than the G-buffer's.
+			//
+			frame_graph.AddPass(pass_name::downsample, [&](FrameGraph::PassBuilder& builder){
+				builder.Read(depth_buffer);
+				builder.Read(gbuffer_normal);
+				builder.Write(low_res_normal, GL_COLOR_ATTACHMENT0);
+				builder.Write(low_res_depth_buffer, GL_DEPTH_STENCIL_ATTACHMENT);
+			}, [&](FrameGraph::PassResources const& resources){
+				glViewport(0, 0, lighting_render_size.x, lighting_render_size.y);
+				glClear(GL_STENCIL_BUFFER_BIT);
+				// The depth is written from the fragment shader, so the depth
+				// test has to be enabled but should always pass.
+				glDepthFunc(GL_ALWAYS);
+
+				glUseProgram(downsample_gbuffer_shader);
+				bind_texture_with_sampler(GL_TEXTURE_2D, 0, downsample_gbuffer_shader, "depth_texture", resources.GetTexture(depth_buffer), samplers[toU(Sampler::Nearest)]);
+				bind_texture_with_sampler(GL_TEXTURE_2D, 1, downsample_gbuffer_shader, "normal_texture", resources.GetTexture(gbuffer_normal), samplers[toU(Sampler::Nearest)]);
+				glUniform1i(glGetUniformLocation(downsample_gbuffer_shader, "downscale"), lighting_downscale);
+				glUniform2i(glGetUniformLocation(downsample_gbuffer_shader, "source_max_coord"), render_size.x - 1, render_size.y - 1);
+
+				bonobo::drawFullscreen();
+
+				glBindSampler(1, 0u);
+				glBindSampler(0, 0u);
+				glUseProgram(0u);
+				glDepthFunc(GL_LESS);
+			});
 
 
 
 			//
 			// Pass 2: Generate shadowmaps and accumulate lights' contribution
 			//
-			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbos[toU(FBO::LightAccumulation)]);
-			glViewport(0, 0, framebuffer_width, framebuffer_height);
-			// XXX: Is any clearing needed?
-			for (size_t i = 0; i < static_cast<size_t>(lights_nb); ++i) {
-				auto const& lightTransform = lightTransforms[i];
-				auto const light_view_matrix = lightOffsetTransform.GetMatrixInverse() * lightTransform.GetMatrixInverse();
-				auto const light_world_matrix = glm::inverse(light_view_matrix) * coneScaleTransform.GetMatrix();
-				auto const light_world_to_clip_matrix = lightProjection * light_view_matrix;
+			frame_graph.AddPass(pass_name::begin_light_accumulation, [&](FrameGraph::PassBuilder& builder){
+				builder.Write(light_diffuse_contribution, GL_COLOR_ATTACHMENT0);
+				builder.Write(light_specular_contribution, GL_COLOR_ATTACHMENT1);
+				builder.Write(lighting_depth_buffer, GL_DEPTH_STENCIL_ATTACHMENT);
+			}, [&](FrameGraph::PassResources const& /*resources*/){
+				glViewport(0, 0, lighting_render_size.x, lighting_render_size.y);
+				// XXX: Is any clearing needed?
+				// The shadow visibility output does not rely on the
+				// answer to the above.
+				if (show_shadow_visibility)
+					glClear(GL_COLOR_BUFFER_BIT);
+			});
+			// Each light gets its own shadow map; as each of them is only
+			// alive until the light has been accumulated, they all end up
+			// sharing the same storage.
+			//
+			// With the moments-based filterings, the shadow map pass also
+			// writes the depth moments, which are then blurred at shadow map
+			// resolution; the accumulation only needs a single filtered
+			// lookup into them.
+			auto const use_shadow_moments = shadow_filtering != ShadowFiltering::PCF;
+			auto const& shadow_moments_description = shadow_filtering == ShadowFiltering::Variance
+			                                       ? transient_descriptions.variance_shadow_moments
+			                                       : transient_descriptions.exponential_shadow_moments;
+			// The moments of a texel no occluder was rendered to, i.e. of
+			// a depth of 1.
+			auto const evsm_exponents = glm::vec2(constant::evsm_positive_exponent, constant::evsm_negative_exponent);
+			auto const cleared_shadow_moments = shadow_filtering == ShadowFiltering::Variance
+			                                  ? glm::vec4(1.0f, 1.0f, 0.0f, 0.0f)
+			                                  : glm::vec4(std::exp(evsm_exponents.x), std::exp(2.0f * evsm_exponents.x),
+			                                              -std::exp(-evsm_exponents.y), std::exp(-2.0f * evsm_exponents.y));
+			std::vector<FrameGraph::Handle> shadow_maps(light_system.GetLightsNb(), FrameGraph::invalid_handle);
+			std::vector<FrameGraph::Handle> shadow_moments(light_system.GetLightsNb(), FrameGraph::invalid_handle);
+			std::vector<FrameGraph::Handle> half_blurred_shadow_moments(light_system.GetLightsNb(), FrameGraph::invalid_handle);
+			for (size_t i = 0; i < light_system.GetLightsNb(); ++i) {
+				shadow_maps[i] = frame_graph.CreateTexture("Shadow map " + std::to_string(i), transient_descriptions.shadow_map);
+				if (show_textures && i + 1u == light_system.GetLightsNb())
+					frame_graph.MarkAsOutput(shadow_maps[i]);
+				if (use_shadow_moments) {
+					shadow_moments[i] = frame_graph.CreateTexture("Shadow moments " + std::to_string(i), shadow_moments_description);
+					half_blurred_shadow_moments[i] = frame_graph.CreateTexture("Half-blurred shadow moments " + std::to_string(i), shadow_moments_description);
+				}
 
 				//
 				// Pass 2.1: Generate shadow map for light i
 				//
-				utils::opengl::debug::beginDebugGroup("Create shadow map " + std::to_string(i));
-				glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::ShadowMap0Generation) + i]);
-
-				glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbos[toU(FBO::ShadowMap)]);
-				glViewport(0, 0, constant::shadowmap_res_x, constant::shadowmap_res_y);
-				// XXX: Is any clearing needed?
-
-				glUseProgram(fill_shadowmap_shader);
-				glUniform1i(fill_shadowmap_shader_locations.light_index, static_cast<int>(i));
-				glUniform1i(fill_shadowmap_shader_locations.opacity_texture, 0);
-				for (std::size_t i = 0; i < sponza_geometry.size(); ++i)
-				{
-					auto const& geometry = sponza_geometry[i];
-					auto const& texture_data = sponza_geometry_texture_data[i];
+				frame_graph.AddPass("Create shadow map " + std::to_string(i), [&, i](FrameGraph::PassBuilder& builder){
+					builder.Write(shadow_maps[i], GL_DEPTH_ATTACHMENT);
+					if (use_shadow_moments)
+						builder.Write(shadow_moments[i], GL_COLOR_ATTACHMENT0);
+				}, [&, i](FrameGraph::PassResources const& /*resources*/){
+					// With moments, the query is ended once they are blurred.
+					glBeginQuery(GL_TIME_ELAPSED, light_queries[i].shadow_map_generation);
+
+					glViewport(0, 0, constant::shadowmap_res_x, constant::shadowmap_res_y);
+					// XXX: Is any clearing needed?
+					if (show_shadow_visibility)
+						glClear(GL_DEPTH_BUFFER_BIT);
+					if (use_shadow_moments)
+						glClearBufferfv(GL_COLOR, 0, glm::value_ptr(cleared_shadow_moments));
+
+					auto const& shadowmap_shader_locations = use_indirect_draws ? fill_shadowmap_indirect_shader_locations : fill_shadowmap_shader_locations;
+					glUseProgram(use_indirect_draws ? fill_shadowmap_indirect_shader : fill_shadowmap_shader);
+					glUniform1i(shadowmap_shader_locations.shadow_filtering, static_cast<int>(toU(shadow_filtering)));
+					glUniform1f(shadowmap_shader_locations.shadow_depth_scale, 1.0f / lightProjectionFarPlane);
+					glUniform2fv(shadowmap_shader_locations.evsm_exponents, 1, glm::value_ptr(evsm_exponents));
+					glUniform1i(shadowmap_shader_locations.light_index, static_cast<int>(i));
+					glUniform1i(shadowmap_shader_locations.opacity_texture, 0);
+					glUniform1iv(shadowmap_shader_locations.material_texture_arrays, static_cast<GLsizei>(material_atlas_units.size()), material_atlas_units.data());
+					glUniform1i(shadowmap_shader_locations.use_material_atlas, use_material_atlas ? 1 : 0);
+					if (use_material_atlas)
+						sponza_material_atlas.BindTextureArrays(material_atlas_first_unit, samplers[toU(Sampler::Mipmaps)]);
+					if (use_indirect_draws && use_material_atlas) {
+						sponza_batch->Draw(get_visible_shadowmap_draw_list(i));
+					} else if (use_indirect_draws) {
+						for (auto const& groups : get_visible_shadowmap_groups(i))
+							for (auto const& group : groups) {
+								bind_shadowmap_opacity_texture(shadowmap_shader_locations, group.texture_data);
+								sponza_batch->Draw(group.draw_list);
+							}
+					} else {
+						auto const& is_mesh_casting_shadows = is_sponza_mesh_casting_shadows[i];
+						for (std::size_t i = 0; i < sponza_geometry.size(); ++i)
+						{
+							if (is_mesh_casting_shadows[i] == 0u)
+								continue;
+
+							auto const& geometry = sponza_geometry[i];
+							auto const& texture_data = sponza_geometry_texture_data[i];
+
+							utils::opengl::debug::beginDebugGroup(geometry.name);
+
+							auto const vertex_model_to_world = glm::mat4(1.0f);
+							glUniformMatrix4fv(shadowmap_shader_locations.vertex_model_to_world, 1, GL_FALSE, glm::value_ptr(vertex_model_to_world));
+
+							if (use_material_atlas)
+								glUniform1ui(shadowmap_shader_locations.material_index, sponza_material_atlas.GetMaterialIndex(i));
+							else
+								bind_shadowmap_opacity_texture(shadowmap_shader_locations, texture_data);
+
+							glBindVertexArray(geometry.vao);
+							if (geometry.ibo != 0u)
+								glDrawElements(geometry.drawing_mode, geometry.indices_nb, GL_UNSIGNED_INT, reinterpret_cast<GLvoid const*>(0x0));
+							else
+								glDrawArrays(geometry.drawing_mode, 0, geometry.vertices_nb);
+
+
+							utils::opengl::debug::endDebugGroup();
+						}
+					}
+					if (use_material_atlas)
+						sponza_material_atlas.UnbindTextureArrays(material_atlas_first_unit);
+					glBindTexture(GL_TEXTURE_2D, 0);
+					glBindVertexArray(0u);
+					glUseProgram(0u);
+
+					if (!use_shadow_moments)
+						glEndQuery(GL_TIME_ELAPSED);
+				});
+
+				if (use_shadow_moments) {
+					//
+					// Pass 2.1.1: Blur the moments of light i, one direction
+					// at a time
+					//
+					auto const blur_moments = [&](GLuint source, glm::ivec2 const& direction){
+						glViewport(0, 0, constant::shadowmap_res_x, constant::shadowmap_res_y);
+						glDisable(GL_DEPTH_TEST);
+						glUseProgram(blur_shadow_moments_shader);
+						bind_texture_with_sampler(GL_TEXTURE_2D, 0, blur_shadow_moments_shader, "moments_texture", source, samplers[toU(Sampler::Nearest)]);
+						glUniform2i(glGetUniformLocation(blur_shadow_moments_shader, "direction"), direction.x, direction.y);
+						glUniform1i(glGetUniformLocation(blur_shadow_moments_shader, "kernel_radius"), shadow_blur_radius);
+
+						bonobo::drawFullscreen();
+
+						glBindSampler(0, 0u);
+						glUseProgram(0u);
+						glEnable(GL_DEPTH_TEST);
+					};
+					frame_graph.AddPass("Blur shadow moments " + std::to_string(i) + " horizontally", [&, i](FrameGraph::PassBuilder& builder){
+						builder.Read(shadow_moments[i]);
+						builder.Write(half_blurred_shadow_moments[i], GL_COLOR_ATTACHMENT0);
+					}, [&, i, blur_moments](FrameGraph::PassResources const& resources){
+						blur_moments(resources.GetTexture(shadow_moments[i]), glm::ivec2(1, 0));
+					});
+					frame_graph.AddPass("Blur shadow moments " + std::to_string(i) + " vertically", [&, i](FrameGraph::PassBuilder& builder){
+						builder.Read(half_blurred_shadow_moments[i]);
+						builder.Write(shadow_moments[i], GL_COLOR_ATTACHMENT0);
+					}, [&, i, blur_moments](FrameGraph::PassResources const& resources){
+						blur_moments(resources.GetTexture(half_blurred_shadow_moments[i]), glm::ivec2(0, 1));
+
+						glBindTexture(GL_TEXTURE_2D, resources.GetTexture(shadow_moments[i]));
+						glGenerateMipmap(GL_TEXTURE_2D);
+						glBindTexture(GL_TEXTURE_2D, 0u);
+
+						glEndQuery(GL_TIME_ELAPSED);
+					});
+				}
 
-					utils::opengl::debug::beginDebugGroup(geometry.name);
 
-					auto const vertex_model_to_world = glm::mat4(1.0f);
-					glUniformMatrix4fv(fill_shadowmap_shader_locations.vertex_model_to_world, 1, GL_FALSE, glm::value_ptr(vertex_model_to_world));
+				//
+				// Pass 2.2: Accumulate light i contribution
+				frame_graph.AddPass("Accumulate light " + std::to_string(i), [&, i](FrameGraph::PassBuilder& builder){
+					builder.Read(lighting_depth_buffer);
+					builder.Read(lighting_normal);
+					builder.Read(use_shadow_moments ? shadow_moments[i] : shadow_maps[i]);
+					builder.Write(light_diffuse_contribution, GL_COLOR_ATTACHMENT0);
+					builder.Write(light_specular_contribution, GL_COLOR_ATTACHMENT1);
+					builder.Write(lighting_depth_buffer, GL_DEPTH_STENCIL_ATTACHMENT);
+				}, [&, i](FrameGraph::PassResources const& resources){
+					auto const& light_world_matrix = light_system.GetVolumeWorldMatrix(i);
+
+					// The stencil marking, if any, is part of the cost of
+					// accumulating the light and is therefore timed with it.
+					glBeginQuery(GL_TIME_ELAPSED, light_queries[i].accumulation);
+
+					glViewport(0, 0, lighting_render_size.x, lighting_render_size.y);
+					glDepthMask(GL_FALSE);
+
+					if (light_volume_mode == LightVolumeMode::Stencil) {
+						//
+						// Pass 2.2.1: Mark the pixels whose G-buffer depth lies
+						// inside the cone, using the depth-fail variant so that
+						// it keeps working when the camera is inside the cone:
+						// back faces behind the geometry increment the stencil,
+						// front faces behind it decrement it again.
+						//
+						utils::opengl::debug::beginDebugGroup("Stencil marking");
+						glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+						glDisable(GL_CULL_FACE);
+						glEnable(GL_STENCIL_TEST);
+						glStencilFunc(GL_ALWAYS, 0, 0xFF);
+						glStencilOpSeparate(GL_BACK, GL_KEEP, GL_INCR_WRAP, GL_KEEP);
+						glStencilOpSeparate(GL_FRONT, GL_KEEP, GL_DECR_WRAP, GL_KEEP);
+
+						glUseProgram(render_light_cones_shader);
+						glUniformMatrix4fv(glGetUniformLocation(render_light_cones_shader, "vertex_model_to_world"), 1, GL_FALSE, glm::value_ptr(light_world_matrix));
+						glUniformMatrix4fv(glGetUniformLocation(render_light_cones_shader, "vertex_world_to_clip"), 1, GL_FALSE, glm::value_ptr(view_projection));
+						glBindVertexArray(cone_geometry.vao);
+						glDrawArrays(cone_geometry.drawing_mode, 0, cone_geometry.vertices_nb);
+
+						glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+						utils::opengl::debug::endDebugGroup();
+
+						// Only shade the marked pixels, and reset their stencil
+						// value on the way for the next light. The depth test
+						// is not needed anymore, and rendering back faces only
+						// shades each pixel once even if the camera is inside
+						// the cone.
+						glEnable(GL_CULL_FACE);
+						glCullFace(GL_FRONT);
+						glDisable(GL_DEPTH_TEST);
+						glStencilFunc(GL_NOTEQUAL, 0, 0xFF);
+						glStencilOp(GL_KEEP, GL_KEEP, GL_ZERO);
+					} else {
+						glCullFace(GL_FRONT);
+						glDepthFunc(GL_GREATER);
+					}
+
+					glEnable(GL_BLEND);
+					glBlendEquationSeparate(GL_FUNC_ADD, GL_MIN);
+					glBlendFuncSeparate(GL_ONE, GL_ONE, GL_ONE, GL_ONE);
+					glUseProgram(accumulate_lights_shader);
+
+					glUniform1i(accumulate_light_shader_locations.light_index, static_cast<int>(i));
+					glUniformMatrix4fv(accumulate_light_shader_locations.vertex_model_to_world, 1, GL_FALSE, glm::value_ptr(light_world_matrix));
+					glUniform3fv(accumulate_light_shader_locations.camera_position, 1, glm::value_ptr(mCamera.mWorld.GetTranslation()));
+					glUniform2f(accumulate_light_shader_locations.inverse_screen_resolution,
+					            1.0f / static_cast<float>(lighting_texture_size.x),
+					            1.0f / static_cast<float>(lighting_texture_size.y));
+					glUniform2f(accumulate_light_shader_locations.render_scale,
+					            static_cast<float>(lighting_render_size.x) / static_cast<float>(lighting_texture_size.x),
+					            static_cast<float>(lighting_render_size.y) / static_cast<float>(lighting_texture_size.y));
+					glUniform3fv(accumulate_light_shader_locations.light_color, 1, glm::value_ptr(light_system.GetColor(i)));
+					glUniform3fv(accumulate_light_shader_locations.light_position, 1, glm::value_ptr(light_system.GetPosition(i)));
+					glUniform3fv(accumulate_light_shader_locations.light_direction, 1, glm::value_ptr(light_system.GetDirection(i)));
+					glUniform1f(accumulate_light_shader_locations.light_intensity, constant::light_intensity);
+					glUniform1f(accumulate_light_shader_locations.light_angle_falloff, constant::light_angle_falloff);
+					glUniform1i(accumulate_light_shader_locations.use_compact_gbuffer, use_compact_gbuffer ? 1 : 0);
+					glUniform1i(accumulate_light_shader_locations.shadow_filtering, static_cast<int>(toU(shadow_filtering)));
+					glUniform1i(accumulate_light_shader_locations.pcf_kernel_radius, pcf_kernel_radius);
+					glUniform1f(accumulate_light_shader_locations.shadow_depth_scale, 1.0f / lightProjectionFarPlane);
+					glUniform1f(accumulate_light_shader_locations.shadow_receiver_offset, constant::shadow_receiver_offset);
+					glUniform2fv(accumulate_light_shader_locations.evsm_exponents, 1, glm::value_ptr(evsm_exponents));
+					glUniform1f(accumulate_light_shader_locations.light_bleeding_reduction, light_bleeding_reduction);
+					glUniform1i(accumulate_light_shader_locations.show_shadow_visibility, show_shadow_visibility ? 1 : 0);
 
-					glUniform1i(fill_shadowmap_shader_locations.has_opacity_texture, texture_data.opacity_texture_id != 0u ? 1 : 0);
-					glBindSampler(0u, texture_data.opacity_texture_id != 0u ? samplers[toU(Sampler::Mipmaps)] : samplers[toU(Sampler::Nearest)]);
 					glActiveTexture(GL_TEXTURE0);
-					glBindTexture(GL_TEXTURE_2D, texture_data.opacity_texture_id != 0u ? texture_data.opacity_texture_id : debug_texture_id);
-
-					glBindVertexArray(geometry.vao);
-					if (geometry.ibo != 0u)
-						glDrawElements(geometry.drawing_mode, geometry.indices_nb, GL_UNSIGNED_INT, reinterpret_cast<GLvoid const*>(0x0));
-					else
-						glDrawArrays(geometry.drawing_mode, 0, geometry.vertices_nb);
+					glBindTexture(GL_TEXTURE_2D, resources.GetTexture(lighting_depth_buffer));
+					glUniform1i(accumulate_light_shader_locations.depth_texture, 0);
+					glBindSampler(0, samplers[toU(Sampler::Linear)]);
+
+					glActiveTexture(GL_TEXTURE1);
+					glBindTexture(GL_TEXTURE_2D, resources.GetTexture(lighting_normal));
+					glUniform1i(accumulate_light_shader_locations.normal_texture, 1);
+					glBindSampler(1, samplers[toU(Sampler::Linear)]);
+
+					// Shadow and regular samplers have to use different
+					// units, even when only one of them is sampled.
+					glUniform1i(accumulate_light_shader_locations.shadow_texture, 2);
+					glUniform1i(accumulate_light_shader_locations.shadow_moments_texture, 3);
+					glActiveTexture(GL_TEXTURE2);
+					glBindTexture(GL_TEXTURE_2D, use_shadow_moments ? 0u : resources.GetTexture(shadow_maps[i]));
+					glBindSampler(2, samplers[toU(Sampler::ShadowComparison)]);
+					glActiveTexture(GL_TEXTURE3);
+					glBindTexture(GL_TEXTURE_2D, use_shadow_moments ? resources.GetTexture(shadow_moments[i]) : 0u);
+					glBindSampler(3, samplers[toU(Sampler::Mipmaps)]);
+
+					glBeginQuery(GL_SAMPLES_PASSED, light_queries[i].shaded_pixels);
+					glBindVertexArray(cone_geometry.vao);
+					glDrawArrays(cone_geometry.drawing_mode, 0, cone_geometry.vertices_nb);
+					glEndQuery(GL_SAMPLES_PASSED);
+
+					glBindVertexArray(0u);
+					glUseProgram(0u);
+					glBindTexture(GL_TEXTURE_2D, 0u);
+					glActiveTexture(GL_TEXTURE2);
+					glBindTexture(GL_TEXTURE_2D, 0u);
+					glBindSampler(3u, 0u);
+					glBindSampler(2u, 0u);
+					glBindSampler(1u, 0u);
+					glBindSampler(0u, 0u);
+
+					glEndQuery(GL_TIME_ELAPSED);
+
+					if (light_volume_mode == LightVolumeMode::Stencil) {
+						glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+						glStencilFunc(GL_ALWAYS, 0, 0xFF);
+						glDisable(GL_STENCIL_TEST);
+						glEnable(GL_DEPTH_TEST);
+					}
+					glDepthMask(GL_TRUE);
+					glDepthFunc(GL_LESS);
+					glDisable(GL_BLEND);
+					glCullFace(GL_BACK);
+				});
+			}
 
 
-					utils::opengl::debug::endDebugGroup();
+			//
+			// Pass 3: Compute final image using both the g-buffer and  the light accumulation buffer
+			//
+			frame_graph.AddPass(pass_name::resolve, [&](FrameGraph::PassBuilder& builder){
+				builder.Read(gbuffer_diffuse);
+				if (!use_compact_gbuffer)
+					builder.Read(gbuffer_specular);
+				builder.Read(light_diffuse_contribution);
+				builder.Read(light_specular_contribution);
+				if (lighting_downscale > 1) {
+					builder.Read(depth_buffer);
+					builder.Read(gbuffer_normal);
+					builder.Read(low_res_depth_buffer);
+					builder.Read(low_res_normal);
 				}
-				glBindTexture(GL_TEXTURE_2D, 0);
-				glBindVertexArray(0u);
-				glUseProgram(0u);
-
-				glEndQuery(GL_TIME_ELAPSED);
-				utils::opengl::debug::endDebugGroup();
-
-
-				glCullFace(GL_FRONT);
-				glEnable(GL_BLEND);
-				glDepthFunc(GL_GREATER);
-				glDepthMask(GL_FALSE);
-				glBlendEquationSeparate(GL_FUNC_ADD, GL_MIN);
-				glBlendFuncSeparate(GL_ONE, GL_ONE, GL_ONE, GL_ONE);
-				//
-				// Pass 2.2: Accumulate light i contribution
-				utils::opengl::debug::beginDebugGroup("Accumulate light " + std::to_string(i));
-				glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::Light0Accumulation) + i]);
-
-				glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbos[toU(FBO::LightAccumulation)]);
-				glUseProgram(accumulate_lights_shader);
-				glViewport(0, 0, framebuffer_width, framebuffer_height);
+				builder.Write(resolved_image, GL_COLOR_ATTACHMENT0);
+			}, [&](FrameGraph::PassResources const& resources){
+				glUseProgram(resolve_deferred_shader);
+				glViewport(0, 0, render_size.x, render_size.y);
 				// XXX: Is any clearing needed?
 
-				glUniform1i(accumulate_light_shader_locations.light_index, static_cast<int>(i));
-				glUniformMatrix4fv(accumulate_light_shader_locations.vertex_model_to_world, 1, GL_FALSE, glm::value_ptr(light_world_matrix));
-				glUniform3fv(accumulate_light_shader_locations.camera_position, 1, glm::value_ptr(mCamera.mWorld.GetTranslation()));
-				glUniform2f(accumulate_light_shader_locations.inverse_screen_resolution,
-				            1.0f / static_cast<float>(framebuffer_width),
-				            1.0f / static_cast<float>(framebuffer_height));
-				glUniform3fv(accumulate_light_shader_locations.light_color, 1, glm::value_ptr(lightColors[i]));
-				glUniform3fv(accumulate_light_shader_locations.light_position, 1, glm::value_ptr(lightTransform.GetTranslation()));
-				glUniform3fv(accumulate_light_shader_locations.light_direction, 1, glm::value_ptr(lightTransform.GetFront()));
-				glUniform1f(accumulate_light_shader_locations.light_intensity, constant::light_intensity);
-				glUniform1f(accumulate_light_shader_locations.light_angle_falloff, constant::light_angle_falloff);
-
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::DepthBuffer)]);
-				glUniform1i(accumulate_light_shader_locations.depth_texture, 0);
-				glBindSampler(0, samplers[toU(Sampler::Linear)]);
-
-				glActiveTexture(GL_TEXTURE1);
-				glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::GBufferWorldSpaceNormal)]);
-				glUniform1i(accumulate_light_shader_locations.normal_texture, 1);
-				glBindSampler(1, samplers[toU(Sampler::Linear)]);
-
-				glActiveTexture(GL_TEXTURE2);
-				glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::ShadowMap)]);
-				glUniform1i(accumulate_light_shader_locations.shadow_texture, 2);
-				glBindSampler(2, samplers[toU(Sampler::Linear)]);
-
-				glBindVertexArray(cone_geometry.vao);
-				glDrawArrays(cone_geometry.drawing_mode, 0, cone_geometry.vertices_nb);
+				bind_texture_with_sampler(GL_TEXTURE_2D, 0, resolve_deferred_shader, "diffuse_texture", resources.GetTexture(gbuffer_diffuse), samplers[toU(Sampler::Nearest)]);
+				// The specular texture has no storage in the compact layout, and
+				// the shader reads the intensity from the diffuse alpha instead.
+				if (!use_compact_gbuffer)
+					bind_texture_with_sampler(GL_TEXTURE_2D, 1, resolve_deferred_shader, "specular_texture", resources.GetTexture(gbuffer_specular), samplers[toU(Sampler::Nearest)]);
+				bind_texture_with_sampler(GL_TEXTURE_2D, 2, resolve_deferred_shader, "light_d_texture", resources.GetTexture(light_diffuse_contribution), samplers[toU(Sampler::Nearest)]);
+				bind_texture_with_sampler(GL_TEXTURE_2D, 3, resolve_deferred_shader, "light_s_texture", resources.GetTexture(light_specular_contribution), samplers[toU(Sampler::Nearest)]);
+				glUniform1i(glGetUniformLocation(resolve_deferred_shader, "use_compact_gbuffer"), use_compact_gbuffer ? 1 : 0);
+				glUniform1i(glGetUniformLocation(resolve_deferred_shader, "lighting_downscale"), lighting_downscale);
+				if (lighting_downscale > 1) {
+					bind_texture_with_sampler(GL_TEXTURE_2D, 4, resolve_deferred_shader, "depth_texture", resources.GetTexture(depth_buffer), samplers[toU(Sampler::Nearest)]);
+					bind_texture_with_sampler(GL_TEXTURE_2D, 5, resolve_deferred_shader, "normal_texture", resources.GetTexture(gbuffer_normal), samplers[toU(Sampler::Nearest)]);
+					bind_texture_with_sampler(GL_TEXTURE_2D, 6, resolve_deferred_shader, "low_res_depth_texture", resources.GetTexture(low_res_depth_buffer), samplers[toU(Sampler::Nearest)]);
+					bind_texture_with_sampler(GL_TEXTURE_2D, 7, resolve_deferred_shader, "low_res_normal_texture", resources.GetTexture(low_res_normal), samplers[toU(Sampler::Nearest)]);
+					glUniform2i(glGetUniformLocation(resolve_deferred_shader, "low_res_max_coord"), lighting_render_size.x - 1, lighting_render_size.y - 1);
+					glUniform1f(glGetUniformLocation(resolve_deferred_shader, "camera_near"), mCamera.mNear);
+					glUniform1f(glGetUniformLocation(resolve_deferred_shader, "camera_far"), mCamera.mFar);
+				}
+
+				bonobo::drawFullscreen();
 
-				glBindVertexArray(0u);
+				if (lighting_downscale > 1) {
+					glBindSampler(7, 0u);
+					glBindSampler(6, 0u);
+					glBindSampler(5, 0u);
+					glBindSampler(4, 0u);
+				}
+				glBindSampler(3, 0u);
+				glBindSampler(2, 0u);
+				glBindSampler(1, 0u);
+				glBindSampler(0, 0u);
 				glUseProgram(0u);
-				glBindSampler(2u, 0u);
-				glBindSampler(1u, 0u);
-				glBindSampler(0u, 0u);
+			});
 
-				glEndQuery(GL_TIME_ELAPSED);
-				utils::opengl::debug::endDebugGroup();
 
-				glDepthMask(GL_TRUE);
-				glDepthFunc(GL_LESS);
-				glDisable(GL_BLEND);
-				glCullFace(GL_BACK);
+			//
+			// Pass 4: Blend the jittered image into the TAA history
+			//
+			if (taa.enabled) {
+				frame_graph.AddPass(pass_name::temporal_antialiasing, [&](FrameGraph::PassBuilder& builder){
+					builder.Read(resolved_image);
+					builder.Read(depth_buffer);
+					if (taa.has_history)
+						builder.Read(previous_taa_history);
+					builder.Write(result, GL_COLOR_ATTACHMENT0);
+					builder.Write(taa_history, GL_COLOR_ATTACHMENT1);
+				}, [&](FrameGraph::PassResources const& resources){
+					glViewport(0, 0, render_size.x, render_size.y);
+					glDisable(GL_DEPTH_TEST);
+					glUseProgram(temporal_antialiasing_shader);
+					bind_texture_with_sampler(GL_TEXTURE_2D, 0, temporal_antialiasing_shader, "current_texture", resources.GetTexture(resolved_image), samplers[toU(Sampler::Nearest)]);
+					bind_texture_with_sampler(GL_TEXTURE_2D, 1, temporal_antialiasing_shader, "depth_texture", resources.GetTexture(depth_buffer), samplers[toU(Sampler::Nearest)]);
+					bind_texture_with_sampler(GL_TEXTURE_2D, 2, temporal_antialiasing_shader, "history_texture", taa.has_history ? resources.GetTexture(previous_taa_history) : 0u, samplers[toU(Sampler::Linear)]);
+					glUniformMatrix4fv(glGetUniformLocation(temporal_antialiasing_shader, "clip_to_world"), 1, GL_FALSE, glm::value_ptr(camera_view_proj_transforms.view_projection_inverse));
+					glUniformMatrix4fv(glGetUniformLocation(temporal_antialiasing_shader, "previous_world_to_clip"), 1, GL_FALSE, glm::value_ptr(taa.previous_world_to_clip));
+					glUniform2fv(glGetUniformLocation(temporal_antialiasing_shader, "jitter"), 1, glm::value_ptr(taa_jitter));
+					glUniform2i(glGetUniformLocation(temporal_antialiasing_shader, "render_size"), render_size.x, render_size.y);
+					glUniform2f(glGetUniformLocation(temporal_antialiasing_shader, "render_scale"),
+					            static_cast<float>(render_size.x) / static_cast<float>(framebuffer_width),
+					            static_cast<float>(render_size.y) / static_cast<float>(framebuffer_height));
+					glUniform1i(glGetUniformLocation(temporal_antialiasing_shader, "has_history"), taa.has_history ? 1 : 0);
+					glUniform1f(glGetUniformLocation(temporal_antialiasing_shader, "history_weight"), taa.history_weight);
+
+					bonobo::drawFullscreen();
+
+					glBindSampler(2, 0u);
+					glBindSampler(1, 0u);
+					glBindSampler(0, 0u);
+					glUseProgram(0u);
+					glEnable(GL_DEPTH_TEST);
+				});
 			}
 
+			//
+			// Replace the final image with the overdraw heat map, if requested
+			//
+			if (show_overdraw) {
+				frame_graph.AddPass("Overdraw heat map", [&](FrameGraph::PassBuilder& builder){
+					builder.Read(overdraw);
+					builder.Write(result, GL_COLOR_ATTACHMENT0);
+				}, [&](FrameGraph::PassResources const& resources){
+					glViewport(0, 0, render_size.x, render_size.y);
+					glDisable(GL_DEPTH_TEST);
+					glUseProgram(overdraw_heatmap_shader);
+					bind_texture_with_sampler(GL_TEXTURE_2D, 0, overdraw_heatmap_shader, "overdraw_texture", resources.GetTexture(overdraw), samplers[toU(Sampler::Nearest)]);
+					glUniform1f(glGetUniformLocation(overdraw_heatmap_shader, "max_overdraw"), overdraw_heatmap_max);
+
+					bonobo::drawFullscreen();
+
+					glBindSampler(0, 0u);
+					glUseProgram(0u);
+					glEnable(GL_DEPTH_TEST);
+				});
+			}
 
 			//
-			// Pass 3: Compute final image using both the g-buffer and  the light accumulation buffer
+			// Build the Hi-Z pyramid the next frame will be culled against.
 			//
-			utils::opengl::debug::beginDebugGroup("Resolve");
-			glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::Resolve)]);
+			if (is_hiz_culling_enabled) {
+				frame_graph.AddPass(pass_name::hiz_pyramid, [&](FrameGraph::PassBuilder& builder){
+					builder.Read(depth_buffer);
+					// The pyramid is kept by the culler for the next frame.
+					builder.SetSideEffects();
+				}, [&](FrameGraph::PassResources const& resources){
+					hiz_culler->BuildPyramid(hiz_copy_depth_shader, hiz_downsample_shader, resources.GetTexture(depth_buffer), render_size, view_projection);
+				});
+			}
+
+			frame_graph.Compile();
+			frame_graph.Execute();
 
+			if (taa.enabled) {
+				taa.history_index = 1u - taa.history_index;
+				taa.history_render_size = render_size;
+				taa.has_history = true;
+			}
+
+			if (show_textures) {
+				displayed_shadow_map = shadow_maps.empty() ? 0u : frame_graph.GetTexture(shadow_maps.back());
+				displayed_light_diffuse_contribution = frame_graph.GetTexture(light_diffuse_contribution);
+				displayed_light_specular_contribution = frame_graph.GetTexture(light_specular_contribution);
+			}
+
+			// The commands following the graph expect FBO::Resolve to be
+			// the one being rendered to.
 			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbos[toU(FBO::Resolve)]);
-			glUseProgram(resolve_deferred_shader);
-			glViewport(0, 0, framebuffer_width, framebuffer_height);
-			// XXX: Is any clearing needed?
+		}
 
-			bind_texture_with_sampler(GL_TEXTURE_2D, 0, resolve_deferred_shader, "diffuse_texture", textures[toU(Texture::GBufferDiffuse)], samplers[toU(Sampler::Nearest)]);
-			bind_texture_with_sampler(GL_TEXTURE_2D, 1, resolve_deferred_shader, "specular_texture", textures[toU(Texture::GBufferSpecular)], samplers[toU(Sampler::Nearest)]);
-			bind_texture_with_sampler(GL_TEXTURE_2D, 2, resolve_deferred_shader, "light_d_texture", textures[toU(Texture::LightDiffuseContribution)], samplers[toU(Sampler::Nearest)]);
-			bind_texture_with_sampler(GL_TEXTURE_2D, 3, resolve_deferred_shader, "light_s_texture", textures[toU(Texture::LightSpecularContribution)], samplers[toU(Sampler::Nearest)]);
+
+		//
+		// Compare the final image against the reference one, if any
+		//
+		if (readBackImageDifference(image_comparison) && image_comparison.readback_shadow_filtering != ShadowFiltering::Count) {
+			auto& filtering_stats = shadow_filtering_stats[toU(image_comparison.readback_shadow_filtering)];
+			filtering_stats.has_error = true;
+			filtering_stats.mean_absolute_error = image_comparison.mean_absolute_error;
+		}
+		glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::ImageDifference)]);
+		if (image_comparison.is_enabled && image_comparison.has_reference && image_comparison.readback_fence == nullptr && !shader_reload_failed) {
+			utils::opengl::debug::beginDebugGroup("Image difference");
+
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, image_comparison.difference_fbo);
+			glViewport(0, 0, image_comparison.tiles_nb.x, image_comparison.tiles_nb.y);
+			glDisable(GL_DEPTH_TEST);
+
+			glUseProgram(image_difference_shader);
+			bind_texture_with_sampler(GL_TEXTURE_2D, 0, image_difference_shader, "result_texture", textures[toU(Texture::Result)], samplers[toU(Sampler::Linear)]);
+			bind_texture_with_sampler(GL_TEXTURE_2D, 1, image_difference_shader, "reference_texture", image_comparison.reference_texture, samplers[toU(Sampler::Linear)]);
+			glUniform2f(glGetUniformLocation(image_difference_shader, "result_scale"),
+			            static_cast<float>(render_size.x) / static_cast<float>(framebuffer_width),
+			            static_cast<float>(render_size.y) / static_cast<float>(framebuffer_height));
+			glUniform2fv(glGetUniformLocation(image_difference_shader, "reference_scale"), 1, glm::value_ptr(image_comparison.reference_scale));
+			glUniform2f(glGetUniformLocation(image_difference_shader, "inverse_resolution"),
+			            1.0f / static_cast<float>(framebuffer_width),
+			            1.0f / static_cast<float>(framebuffer_height));
+			glUniform2i(glGetUniformLocation(image_difference_shader, "resolution"), framebuffer_width, framebuffer_height);
+			glUniform1i(glGetUniformLocation(image_difference_shader, "tile_size"), image_difference_tile_size);
 
 			bonobo::drawFullscreen();
 
-			glBindSampler(3, 0u);
-			glBindSampler(2, 0u);
 			glBindSampler(1, 0u);
 			glBindSampler(0, 0u);
 			glUseProgram(0u);
+			glEnable(GL_DEPTH_TEST);
+
+			// Copy the per-tile sums into the pixel buffer without waiting
+			// for them; readBackImageDifference() picks them up once the
+			// fence is signalled.
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, image_comparison.readback_buffer);
+			glBindTexture(GL_TEXTURE_2D, image_comparison.difference_texture);
+			glGetTexImage(GL_TEXTURE_2D, 0, GL_RG, GL_FLOAT, nullptr);
+			glBindTexture(GL_TEXTURE_2D, 0u);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+			image_comparison.readback_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			image_comparison.readback_shadow_filtering = show_shadow_visibility ? shadow_filtering : ShadowFiltering::Count;
+
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbos[toU(FBO::Resolve)]);
+			glViewport(0, 0, render_size.x, render_size.y);
 
-			glEndQuery(GL_TIME_ELAPSED);
 			utils::opengl::debug::endDebugGroup();
 		}
+		glEndQuery(GL_TIME_ELAPSED);
 
 
 		auto const show_debug_elements = show_cone_wireframe || show_basis;
@@ -687,9 +2108,9 @@ edan35::Assignment2::run()
 
 			glDisable(GL_CULL_FACE);
 			glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-			for (size_t i = 0; i < lights_nb; ++i) {
+			for (size_t i = 0; i < light_system.GetLightsNb(); ++i) {
 				cone.render(view_projection,
-				            lightTransforms[i].GetMatrix() * lightOffsetTransform.GetMatrix() * coneScaleTransform.GetMatrix(),
+				            light_system.GetVolumeWorldMatrix(i),
 				            render_light_cones_shader, set_uniforms);
 			}
 			glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
@@ -699,9 +2120,6 @@ edan35::Assignment2::run()
 		glEndQuery(GL_TIME_ELAPSED);
 
 
-		utils::opengl::debug::beginDebugGroup("Draw GUI");
-		glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::GUI)]);
-
 		//
 		// Display 3D helpers
 		//
@@ -709,23 +2127,44 @@ edan35::Assignment2::run()
 			bonobo::renderBasis(basis_thickness_scale, basis_length_scale, mCamera.GetWorldToClipMatrix());
 		}
 
-		// If the basis and cone wireframe were not shown, FBO::Resolve
-		// is still bound so there is no need to rebind it.
-		if (show_debug_elements) {
-			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbos[toU(FBO::Resolve)]);
-		}
+
+		//
+		// Upscale the rendered sub-rectangle to the default framebuffer.
+		//
+		utils::opengl::debug::beginDebugGroup("Copy to default framebuffer");
+		glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::CopyToFramebuffer)]);
+
+		// FBO::Resolve has already been bound to GL_READ_FRAMEBUFFER before rendering the first frame,
+		// as no other frame buffer gets bound to it.
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0u);
+		auto const is_upscaling = render_size.x != framebuffer_width || render_size.y != framebuffer_height;
+		glBlitFramebuffer(0, 0, render_size.x, render_size.y, 0, 0, framebuffer_width, framebuffer_height, GL_COLOR_BUFFER_BIT, is_upscaling ? GL_LINEAR : GL_NEAREST);
+
+		glEndQuery(GL_TIME_ELAPSED);
+		utils::opengl::debug::endDebugGroup();
+
+
+		// The GUI and the debug textures are drawn directly at the window
+		// resolution, so that they are not affected by the resolution scale.
+		utils::opengl::debug::beginDebugGroup("Draw GUI");
+		glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::GUI)]);
 
 		//
 		// Output content of the g-buffer as well as of the shadowmap, for debugging purposes
 		//
 		if (show_textures) {
 			bonobo::displayTexture({-0.95f, -0.95f}, {-0.55f, -0.55f}, textures[toU(Texture::GBufferDiffuse)],            samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
-			bonobo::displayTexture({-0.45f, -0.95f}, {-0.05f, -0.55f}, textures[toU(Texture::GBufferSpecular)],           samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
-			bonobo::displayTexture({ 0.05f, -0.95f}, { 0.45f, -0.55f}, textures[toU(Texture::GBufferWorldSpaceNormal)],   samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
+			if (use_compact_gbuffer) {
+				bonobo::displayTexture({-0.45f, -0.95f}, {-0.05f, -0.55f}, textures[toU(Texture::GBufferDiffuse)],            samplers[toU(Sampler::Linear)], {3, 3, 3, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
+				bonobo::displayTexture({ 0.05f, -0.95f}, { 0.45f, -0.55f}, textures[toU(Texture::GBufferWorldSpaceNormal)],   samplers[toU(Sampler::Linear)], {0, 1, -1, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
+			} else {
+				bonobo::displayTexture({-0.45f, -0.95f}, {-0.05f, -0.55f}, textures[toU(Texture::GBufferSpecular)],           samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
+				bonobo::displayTexture({ 0.05f, -0.95f}, { 0.45f, -0.55f}, textures[toU(Texture::GBufferWorldSpaceNormal)],   samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
+			}
 			bonobo::displayTexture({ 0.55f, -0.95f}, { 0.95f, -0.55f}, textures[toU(Texture::DepthBuffer)],               samplers[toU(Sampler::Linear)], {0, 0, 0, -1}, glm::uvec2(framebuffer_width, framebuffer_height), true, mCamera.mNear, mCamera.mFar);
-			bonobo::displayTexture({-0.95f,  0.55f}, {-0.55f,  0.95f}, textures[toU(Texture::ShadowMap)],                 samplers[toU(Sampler::Linear)], {0, 0, 0, -1}, glm::uvec2(framebuffer_width, framebuffer_height), true, lightProjectionNearPlane, lightProjectionFarPlane);
-			bonobo::displayTexture({-0.45f,  0.55f}, {-0.05f,  0.95f}, textures[toU(Texture::LightDiffuseContribution)],  samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
-			bonobo::displayTexture({ 0.05f,  0.55f}, { 0.45f,  0.95f}, textures[toU(Texture::LightSpecularContribution)], samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
+			bonobo::displayTexture({-0.95f,  0.55f}, {-0.55f,  0.95f}, displayed_shadow_map,                              samplers[toU(Sampler::Linear)], {0, 0, 0, -1}, glm::uvec2(framebuffer_width, framebuffer_height), true, lightProjectionNearPlane, lightProjectionFarPlane);
+			bonobo::displayTexture({-0.45f,  0.55f}, {-0.05f,  0.95f}, displayed_light_diffuse_contribution,              samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
+			bonobo::displayTexture({ 0.05f,  0.55f}, { 0.45f,  0.95f}, displayed_light_specular_contribution,             samplers[toU(Sampler::Linear)], {0, 1, 2, -1}, glm::uvec2(framebuffer_width, framebuffer_height));
 		}
 
 		//
@@ -745,12 +2184,26 @@ edan35::Assignment2::run()
 				ImGui::TableSetupColumn("GPU time [ms]");
 				ImGui::TableHeadersRow();
 
+				ImGui::TableNextColumn();
+				ImGui::Text("Depth pre-pass");
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", frame_graph.GetPassGpuTime(pass_name::depth_prepass));
+
 				ImGui::TableNextColumn();
 				ImGui::Text("Gbuffer gen.");
 				ImGui::TableNextColumn();
-				ImGui::Text("%.3f", pass_elapsed_times[toU(ElapsedTimeQuery::GbufferGeneration)] / 1000000.0f);
+				ImGui::Text("%.3f", frame_graph.GetPassGpuTime(pass_name::gbuffer));
+
+				for (size_t i = 0; i < depth_prepass_timings.size(); ++i) {
+					auto const& prepass_timings = depth_prepass_timings[i];
 
-				for (std::size_t i = 0; i < lights_nb; ++i) {
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(i == 1 ? "  Pre-pass + Gbuffer, with pre-pass" : "  Pre-pass + Gbuffer, without pre-pass");
+					ImGui::TableNextColumn();
+					showTiming(prepass_timings.is_valid, prepass_timings.prepass_ms + prepass_timings.gbuffer_ms);
+				}
+
+				for (std::size_t i = 0; i < light_timings.size(); ++i) {
 					ImGui::TableNextColumn();
 					ImGui::Text("Light %zu", i);
 					ImGui::TableNextColumn();
@@ -759,18 +2212,33 @@ edan35::Assignment2::run()
 					ImGui::TableNextColumn();
 					ImGui::Text("  Shadow map");
 					ImGui::TableNextColumn();
-					ImGui::Text("%.3f", pass_elapsed_times[toU(ElapsedTimeQuery::ShadowMap0Generation) + i] / 1000000.0f);
+					ImGui::Text("%.3f", light_timings[i].shadow_map_generation / 1000000.0f);
 
 					ImGui::TableNextColumn();
 					ImGui::Text("  Light accumulation");
 					ImGui::TableNextColumn();
-					ImGui::Text("%.3f", pass_elapsed_times[toU(ElapsedTimeQuery::Light0Accumulation) + i] / 1000000.0f);
+					ImGui::Text("%.3f", light_timings[i].accumulation / 1000000.0f);
+
+					ImGui::TableNextColumn();
+					ImGui::Text("  Shaded pixels");
+					ImGui::TableNextColumn();
+					ImGui::Text("%llu", static_cast<unsigned long long>(light_timings[i].shaded_pixels));
 				}
 
+				ImGui::TableNextColumn();
+				ImGui::Text("Downsample");
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", frame_graph.GetPassGpuTime(pass_name::downsample));
+
 				ImGui::TableNextColumn();
 				ImGui::Text("Resolve");
 				ImGui::TableNextColumn();
-				ImGui::Text("%.3f", pass_elapsed_times[toU(ElapsedTimeQuery::Resolve)] / 1000000.0f);
+				ImGui::Text("%.3f", frame_graph.GetPassGpuTime(pass_name::resolve));
+
+				ImGui::TableNextColumn();
+				ImGui::Text("Image difference");
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", pass_elapsed_times[toU(ElapsedTimeQuery::ImageDifference)] / 1000000.0f);
 
 				ImGui::TableNextColumn();
 				ImGui::Text("Cone wireframe");
@@ -789,16 +2257,272 @@ edan35::Assignment2::run()
 
 				ImGui::EndTable();
 			}
+
+			ImGui::Separator();
+			auto const& frame_graph_memory = frame_graph.GetMemoryReport();
+			auto const to_mib = [](size_t bytes){ return static_cast<float>(bytes) / (1024.0f * 1024.0f); };
+			ImGui::Text("Frame graph: %zu transient targets (%.1f MiB) in %zu textures (%.1f MiB)",
+			            frame_graph_memory.transient_textures_nb, to_mib(frame_graph_memory.transient_bytes),
+			            frame_graph_memory.physical_textures_nb, to_mib(frame_graph_memory.physical_bytes));
+			ImGui::Text("Memory saved by aliasing: %.1f MiB", to_mib(frame_graph_memory.transient_bytes - frame_graph_memory.physical_bytes));
+			if (ImGui::CollapsingHeader("Frame graph passes")
+			    && ImGui::BeginTable("Frame graph passes", 3, ImGuiTableFlags_SizingFixedFit))
+			{
+				ImGui::TableSetupColumn("Pass");
+				ImGui::TableSetupColumn("GPU time [ms]");
+				ImGui::TableSetupColumn("Details");
+				ImGui::TableHeadersRow();
+
+				for (auto const& pass : frame_graph.GetPassReports()) {
+					ImGui::TableNextColumn();
+					ImGui::Text("%s", pass.name.c_str());
+					ImGui::TableNextColumn();
+					if (pass.is_culled)
+						ImGui::Text("culled");
+					else
+						ImGui::Text("%.3f", pass.gpu_time_ms);
+					ImGui::TableNextColumn();
+					if (pass.name == pass_name::hiz_culling) {
+						auto const& stats = hiz_culler->GetStats();
+						ImGui::Text("%u/%u meshes culled", stats.culled_commands_nb, stats.tested_commands_nb);
+					}
+				}
+
+				ImGui::EndTable();
+			}
+
+			ImGui::Separator();
+			ImGui::Text("G-buffer layouts (light accumulation summed over all lights)");
+			if (ImGui::BeginTable("Layout comparison", 8, ImGuiTableFlags_SizingFixedFit))
+			{
+				ImGui::TableSetupColumn("Layout");
+				ImGui::TableSetupColumn("G-buffer [B/px]");
+				ImGui::TableSetupColumn("Accum. [B/px]");
+				ImGui::TableSetupColumn("Per-light reads [B/px]");
+				ImGui::TableSetupColumn("Resolve reads [B/px]");
+				ImGui::TableSetupColumn("G-buffer [ms]");
+				ImGui::TableSetupColumn("Accum. [ms]");
+				ImGui::TableSetupColumn("Resolve [ms]");
+				ImGui::TableHeadersRow();
+
+				for (uint32_t i = 0u; i < toU(GBufferLayout::Count); ++i) {
+					auto const footprint = computeLayoutFootprint(static_cast<GBufferLayout>(i));
+					auto const& timings = layout_timings[i];
+
+					ImGui::TableNextColumn();
+					ImGui::Text("%s%s", gbuffer_layout_labels[i], i == toU(gbuffer_layout) ? " (current)" : "");
+					ImGui::TableNextColumn();
+					ImGui::Text("%u", footprint.gbuffer);
+					ImGui::TableNextColumn();
+					ImGui::Text("%u", footprint.light_accumulation);
+					ImGui::TableNextColumn();
+					ImGui::Text("%u", footprint.per_light_reads);
+					ImGui::TableNextColumn();
+					ImGui::Text("%u", footprint.resolve_reads);
+					ImGui::TableNextColumn();
+					showTiming(timings.is_valid, timings.gbuffer_ms);
+					ImGui::TableNextColumn();
+					showTiming(timings.is_valid, timings.accumulation_ms);
+					ImGui::TableNextColumn();
+					showTiming(timings.is_valid, timings.resolve_ms);
+				}
+
+				ImGui::EndTable();
+			}
+
+			ImGui::Separator();
+			ImGui::Text("Lighting resolutions (light accumulation summed over all lights)");
+			if (ImGui::BeginTable("Lighting resolution comparison", 4, ImGuiTableFlags_SizingFixedFit))
+			{
+				ImGui::TableSetupColumn("Resolution");
+				ImGui::TableSetupColumn("Downsample [ms]");
+				ImGui::TableSetupColumn("Accum. [ms]");
+				ImGui::TableSetupColumn("Resolve [ms]");
+				ImGui::TableHeadersRow();
+
+				for (uint32_t i = 0u; i < toU(LightingResolution::Count); ++i) {
+					auto const& stats = lighting_resolution_stats[i];
+
+					ImGui::TableNextColumn();
+					ImGui::Text("%s%s", lighting_resolution_labels[i], i == toU(render_targets_config.lighting_resolution) ? " (current)" : "");
+					ImGui::TableNextColumn();
+					showTiming(stats.is_valid, stats.downsample_ms);
+					ImGui::TableNextColumn();
+					showTiming(stats.is_valid, stats.accumulation_ms);
+					ImGui::TableNextColumn();
+					showTiming(stats.is_valid, stats.resolve_ms);
+				}
+
+				ImGui::EndTable();
+			}
+
+			ImGui::Separator();
+			if (ImGui::Button("Capture reference image")) {
+				// FBO::Resolve is bound as the read framebuffer, so this
+				// copies the final image of the current frame.
+				glBindTexture(GL_TEXTURE_2D, image_comparison.reference_texture);
+				glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, framebuffer_width, framebuffer_height);
+				glBindTexture(GL_TEXTURE_2D, 0u);
+				image_comparison.reference_scale = glm::vec2(render_size) / glm::vec2(framebuffer_width, framebuffer_height);
+				image_comparison.has_reference = true;
+			}
+			ImGui::SameLine();
+			ImGui::Checkbox("Compare with reference", &image_comparison.is_enabled);
+			if (image_comparison.is_enabled && image_comparison.has_reference) {
+				auto const psnr = image_comparison.mean_squared_error > 0.0f
+				                ? -10.0f * std::log10(image_comparison.mean_squared_error)
+				                : std::numeric_limits<float>::infinity();
+				ImGui::Text("Mean absolute error: %.5f", image_comparison.mean_absolute_error);
+				ImGui::Text("PSNR: %.2f dB", psnr);
+			} else if (image_comparison.is_enabled) {
+				ImGui::Text("No reference image captured yet.");
+			}
+
+			ImGui::Separator();
+			ImGui::Text("Light volume modes (summed over all lights)");
+			if (ImGui::BeginTable("Light volume comparison", 3, ImGuiTableFlags_SizingFixedFit))
+			{
+				ImGui::TableSetupColumn("Mode");
+				ImGui::TableSetupColumn("Accum. [ms]");
+				ImGui::TableSetupColumn("Shaded pixels");
+				ImGui::TableHeadersRow();
+
+				for (uint32_t i = 0u; i < toU(LightVolumeMode::Count); ++i) {
+					auto const& stats = light_volume_stats[i];
+
+					ImGui::TableNextColumn();
+					ImGui::Text("%s%s", light_volume_mode_labels[i], i == toU(light_volume_mode) ? " (current)" : "");
+					ImGui::TableNextColumn();
+					showTiming(stats.is_valid, stats.accumulation_ms);
+					ImGui::TableNextColumn();
+					if (stats.is_valid)
+						ImGui::Text("%llu", static_cast<unsigned long long>(stats.shaded_pixels));
+					else
+						ImGui::Text("-");
+				}
+
+				ImGui::EndTable();
+			}
+
+			ImGui::Separator();
+			ImGui::Text("Shadow filterings (summed over all lights)");
+			if (ImGui::IsItemHovered())
+				ImGui::SetTooltip("Errors are only measured while showing the shadow visibility,\nagainst a reference captured the same way.");
+			if (ImGui::BeginTable("Shadow filtering comparison", 4, ImGuiTableFlags_SizingFixedFit))
+			{
+				ImGui::TableSetupColumn("Filtering");
+				ImGui::TableSetupColumn("Shadow maps [ms]");
+				ImGui::TableSetupColumn("Accum. [ms]");
+				ImGui::TableSetupColumn("Error vs. reference");
+				ImGui::TableHeadersRow();
+
+				for (uint32_t i = 0u; i < toU(ShadowFiltering::Count); ++i) {
+					auto const& stats = shadow_filtering_stats[i];
+
+					ImGui::TableNextColumn();
+					ImGui::Text("%s%s", shadow_filtering_labels[i], i == toU(shadow_filtering) ? " (current)" : "");
+					ImGui::TableNextColumn();
+					showTiming(stats.is_valid, stats.shadow_maps_ms);
+					ImGui::TableNextColumn();
+					showTiming(stats.is_valid, stats.accumulation_ms);
+					ImGui::TableNextColumn();
+					if (stats.has_error)
+						ImGui::Text("%.5f", stats.mean_absolute_error);
+					else
+						ImGui::TextUnformatted("-");
+				}
+
+				ImGui::EndTable();
+			}
 		}
 		ImGui::End();
 
 		opened = ImGui::Begin("Scene Controls", nullptr, ImGuiWindowFlags_None);
 		if (opened) {
 			ImGui::Checkbox("Pause lights", &are_lights_paused);
-			ImGui::SliderInt("Number of lights", &lights_nb, 1, static_cast<int>(constant::lights_nb));
+			ImGui::SliderInt("Number of lights", &lights_nb, 1, static_cast<int>(edan35::LightSystem::max_lights_nb));
+			ImGui::Text("Light transforms uploaded: %zu", light_system.GetLastUploadedLightsNb());
+			ImGui::Checkbox("Stream per-frame uniforms", &use_streaming_uniforms);
+			if (use_streaming_uniforms) {
+				ImGui::Text("Streamed: %.1f KiB/frame (%s)", static_cast<float>(streaming_uniforms.GetLastFrameUploadedBytesNb()) / 1024.0f,
+				            streaming_uniforms.IsPersistentlyMapped() ? "persistently mapped" : "unsynchronised maps");
+				ImGui::Text("Stalls: %llu, avoided: %llu", static_cast<unsigned long long>(streaming_uniforms.GetStallsNb()),
+				            static_cast<unsigned long long>(streaming_uniforms.GetStallsAvoidedNb()));
+			}
+			auto gbuffer_layout_index = static_cast<int>(toU(selected_render_targets_config.gbuffer_layout));
+			if (ImGui::Combo("G-buffer layout", &gbuffer_layout_index, gbuffer_layout_labels.data(), static_cast<int>(gbuffer_layout_labels.size())))
+				selected_render_targets_config.gbuffer_layout = static_cast<GBufferLayout>(gbuffer_layout_index);
+			if (ImGui::IsItemHovered())
+				ImGui::SetTooltip("The compact layout only keeps the luminance of the specular color:\ncoloured specular highlights come out grey.");
+			auto lighting_resolution_index = static_cast<int>(toU(selected_render_targets_config.lighting_resolution));
+			if (ImGui::Combo("Lighting resolution", &lighting_resolution_index, lighting_resolution_labels.data(), static_cast<int>(lighting_resolution_labels.size())))
+				selected_render_targets_config.lighting_resolution = static_cast<LightingResolution>(lighting_resolution_index);
+			auto light_volume_mode_index = static_cast<int>(toU(light_volume_mode));
+			if (ImGui::Combo("Light volumes", &light_volume_mode_index, light_volume_mode_labels.data(), static_cast<int>(light_volume_mode_labels.size())))
+				light_volume_mode = static_cast<LightVolumeMode>(light_volume_mode_index);
+			auto shadow_filtering_index = static_cast<int>(toU(shadow_filtering));
+			if (ImGui::Combo("Shadow filtering", &shadow_filtering_index, shadow_filtering_labels.data(), static_cast<int>(shadow_filtering_labels.size())))
+				shadow_filtering = static_cast<ShadowFiltering>(shadow_filtering_index);
+			if (shadow_filtering == ShadowFiltering::PCF) {
+				ImGui::SliderInt("PCF kernel radius", &pcf_kernel_radius, 0, 4);
+				if (ImGui::IsItemHovered())
+					ImGui::SetTooltip("%d taps per pixel", (2 * pcf_kernel_radius + 1) * (2 * pcf_kernel_radius + 1));
+			} else {
+				ImGui::SliderInt("Shadow blur radius", &shadow_blur_radius, 0, 8);
+				ImGui::SliderFloat("Light bleeding reduction", &light_bleeding_reduction, 0.0f, 0.9f);
+			}
+			ImGui::Checkbox("Show shadow visibility", &show_shadow_visibility);
+			if (ImGui::IsItemHovered())
+				ImGui::SetTooltip("Accumulate each light's visibility instead of its shading,\nto compare the shadow filterings.");
+			if (sponza_batch != nullptr)
+				ImGui::Checkbox("Multi-draw indirect", &use_indirect_draws);
+			if (sponza_material_atlas.IsValid()) {
+				ImGui::Checkbox("Material atlas", &use_material_atlas);
+				if (ImGui::IsItemHovered())
+					ImGui::SetTooltip("%zu materials packed into %zu texture arrays", sponza_material_atlas.GetMaterialsNb(), sponza_material_atlas.GetTextureArraysNb());
+			}
+			ImGui::Checkbox("Depth pre-pass", &use_depth_prepass);
+			ImGui::Checkbox("Occlusion culling", &use_occlusion_culling);
+			if (use_occlusion_culling) {
+				ImGui::Checkbox("Cull shadow casters", &cull_shadow_casters);
+				ImGui::Text("Camera: %zu/%zu meshes culled, %.2f ms (%zu/%zu occluder triangles)",
+				            camera_occlusion_stats.culled_boxes_nb, camera_occlusion_stats.tested_boxes_nb,
+				            camera_occlusion_stats.rasterization_ms,
+				            camera_occlusion_stats.rasterized_triangles_nb, camera_occlusion_stats.occluder_triangles_nb);
+				if (cull_shadow_casters)
+					ImGui::Text("Lights: %zu/%zu shadow casters culled, %.2f ms",
+					            lights_occlusion_stats.culled_boxes_nb, lights_occlusion_stats.tested_boxes_nb,
+					            lights_occlusion_stats.rasterization_ms);
+			}
+			if (hiz_culler != nullptr) {
+				ImGui::Checkbox("Hi-Z occlusion culling", &use_hiz_culling);
+				if (ImGui::IsItemHovered())
+					ImGui::SetTooltip("Only applies to multi-draw indirect; see the frame graph passes for its statistics");
+			}
+			ImGui::Checkbox("Show overdraw heat map", &show_overdraw);
+			if (show_overdraw)
+				ImGui::SliderFloat("Overdraw heat map maximum", &overdraw_heatmap_max, 1.0f, 32.0f, "%.0f");
 			ImGui::Checkbox("Show textures", &show_textures);
 			ImGui::Checkbox("Show light cones wireframe", &show_cone_wireframe);
 			ImGui::Separator();
+			ImGui::Checkbox("Temporal anti-aliasing", &taa.enabled);
+			if (taa.enabled)
+				ImGui::SliderFloat("TAA history weight", &taa.history_weight, 0.5f, 0.98f);
+			ImGui::Checkbox("Dynamic resolution", &dynamic_resolution.enabled);
+			if (dynamic_resolution.enabled) {
+				ImGui::SliderFloat("Target GPU time (ms)", &dynamic_resolution.target_gpu_time_ms, 1.0f, 50.0f, "%.1f");
+				ImGui::SliderFloat("Minimum scale", &dynamic_resolution.min_scale, 0.25f, dynamic_resolution.max_scale, "%.2f");
+				ImGui::Text("Current scale: %.2f", dynamic_resolution.scale);
+			} else {
+				ImGui::SliderFloat("Resolution scale", &dynamic_resolution.scale, dynamic_resolution.min_scale, dynamic_resolution.max_scale, "%.2f");
+			}
+			ImGui::Text("Render size: %dx%d (%.0f%% of the pixels)", render_size.x, render_size.y,
+			            100.0f * static_cast<float>(render_size.x * render_size.y) / static_cast<float>(framebuffer_width * framebuffer_height));
+			ImGui::Separator();
+			ImGui::Checkbox("Show frame profiler", &show_frame_profiler);
+			if (ImGui::IsItemHovered())
+				ImGui::SetTooltip("CPU scopes and GPU passes on a single timeline, a few frames behind");
+			ImGui::Checkbox("Show GPU memory", &show_gpu_memory);
 			ImGui::Checkbox("Show basis", &show_basis);
 			ImGui::SliderFloat("Basis thickness scale", &basis_thickness_scale, 0.0f, 100.0f);
 			ImGui::SliderFloat("Basis length scale", &basis_length_scale, 0.0f, 100.0f);
@@ -807,105 +2531,288 @@ edan35::Assignment2::run()
 
 		if (show_logs)
 			Log::View::Render();
+		if (show_frame_profiler)
+			Profiler::RenderWindow();
+		if (show_gpu_memory)
+			GpuMemory::RenderWindow();
 		mWindowManager.RenderImGuiFrame(show_gui);
 
 		glEndQuery(GL_TIME_ELAPSED);
 		utils::opengl::debug::endDebugGroup();
 
-		//
-		// Blit the result back to the default framebuffer.
-		//
-		utils::opengl::debug::beginDebugGroup("Copy to default framebuffer");
-		glBeginQuery(GL_TIME_ELAPSED, elapsed_time_queries[toU(ElapsedTimeQuery::CopyToFramebuffer)]);
-
-		// FBO::Resolve has already been bound to GL_READ_FRAMEBUFFER before rendering the first frame,
-		// as no other frame buffer gets bound to it.
-		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0u);
-		glBlitFramebuffer(0, 0, framebuffer_width, framebuffer_height, 0, 0, framebuffer_width, framebuffer_height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
-
-		glEndQuery(GL_TIME_ELAPSED);
-		utils::opengl::debug::endDebugGroup();
+		streaming_uniforms.EndFrame();
+		auto const cpu_time_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - nowTime).count();
+		{
+			PROFILE_SCOPE("Swap buffers");
+			mWindowManager.SwapBuffers(window);
+		}
 
-		glfwSwapBuffers(window);
+		if (benchmark != nullptr) {
+			benchmark->EndFrame(cpu_time_ms, std::chrono::duration<float, std::milli>(deltaTimeUs).count(),
+			                    frame_graph.GetExecutedFramesNb(), frame_graph.GetLatestFrameGpuTimes());
+			if (benchmark->IsDone())
+				glfwSetWindowShouldClose(window, GLFW_TRUE);
+		}
 
+		taa.previous_world_to_clip = mCamera.GetUnjitteredWorldToClipMatrix();
 		first_frame = false;
 	}
 
 	glDeleteBuffers(static_cast<GLsizei>(ubos.size()), ubos.data());
+	resizeLightQueries(light_queries, 0u);
 	glDeleteQueries(static_cast<GLsizei>(elapsed_time_queries.size()), elapsed_time_queries.data());
 	glDeleteSamplers(static_cast<GLsizei>(samplers.size()), samplers.data());
+	deleteImageComparison(image_comparison);
 	glDeleteFramebuffers(static_cast<GLsizei>(fbos.size()), fbos.data());
 	glDeleteTextures(static_cast<GLsizei>(textures.size()), textures.data());
 
+	glDeleteProgram(overdraw_heatmap_shader);
+	overdraw_heatmap_shader = 0u;
+	glDeleteProgram(depth_prepass_shader);
+	depth_prepass_shader = 0u;
+	glDeleteProgram(image_difference_shader);
+	image_difference_shader = 0u;
+	glDeleteProgram(downsample_gbuffer_shader);
+	downsample_gbuffer_shader = 0u;
+	glDeleteProgram(blur_shadow_moments_shader);
+	blur_shadow_moments_shader = 0u;
+	glDeleteProgram(temporal_antialiasing_shader);
+	temporal_antialiasing_shader = 0u;
 	glDeleteProgram(resolve_deferred_shader);
 	resolve_deferred_shader = 0u;
 	glDeleteProgram(accumulate_lights_shader);
 	accumulate_lights_shader = 0u;
 	glDeleteProgram(fill_shadowmap_shader);
 	fill_shadowmap_shader = 0u;
+	glDeleteProgram(fill_shadowmap_indirect_shader);
+	fill_shadowmap_indirect_shader = 0u;
+	glDeleteProgram(depth_prepass_indirect_shader);
+	depth_prepass_indirect_shader = 0u;
+	glDeleteProgram(fill_gbuffer_indirect_shader);
+	fill_gbuffer_indirect_shader = 0u;
 	glDeleteProgram(fill_gbuffer_shader);
 	fill_gbuffer_shader = 0u;
 	glDeleteProgram(fallback_shader);
 	fallback_shader = 0u;
+
+	if (benchmark != nullptr && !benchmark->WriteResults(framebuffer_width, framebuffer_height))
+		throw std::runtime_error("Failed to write the benchmark results.");
 }
 
-int main()
+int main(int argc, char* argv[])
 {
 	std::setlocale(LC_ALL, "");
 
-	Bonobo framework;
+	Bonobo framework(argc, argv);
 
 	try {
-		edan35::Assignment2 assignment2(framework.GetWindowManager());
+		auto const benchmark_settings = edan35::parseBenchmarkSettings(argc, argv);
+		edan35::Assignment2 assignment2(framework.GetWindowManager(), benchmark_settings);
 		assignment2.run();
 	} catch (std::runtime_error const& e) {
 		LogError(e.what());
+		return EXIT_FAILURE;
 	}
+
+	return framework.GetWindowManager().GetExitStatus();
 }
 
 namespace
 {
-Textures createTextures(GLsizei framebuffer_width, GLsizei framebuffer_height)
+LayoutFootprint computeLayoutFootprint(GBufferLayout layout)
+{
+	LayoutFootprint footprint;
+	switch (layout) {
+	case GBufferLayout::Reference:
+		footprint.gbuffer = 4u /* depth */ + 4u /* diffuse */ + 4u /* specular */ + 4u /* normal */;
+		footprint.light_accumulation = 4u + 4u;
+		footprint.resolve_reads = 4u + 4u + footprint.light_accumulation;
+		break;
+	case GBufferLayout::Compact:
+		footprint.gbuffer = 4u /* depth */ + 4u /* diffuse & specular */ + 4u /* normal */;
+		footprint.light_accumulation = 4u + 4u;
+		footprint.resolve_reads = 4u + footprint.light_accumulation;
+		break;
+	default:
+		break;
+	}
+	// Each light reads back the depth and the normal, and blends into
+	// both accumulation targets.
+	footprint.per_light_reads = 4u + 4u + footprint.light_accumulation;
+
+	return footprint;
+}
+
+void showTiming(bool is_valid, float timing_ms)
+{
+	if (is_valid)
+		ImGui::Text("%.3f", timing_ms);
+	else
+		ImGui::TextUnformatted("-");
+}
+
+void updateDynamicResolution(DynamicResolution& controller, float measured_scale, float scalable_gpu_time_ms, float fixed_gpu_time_ms)
+{
+	// Smooth out the measurements, to avoid reacting to every single
+	// spike and oscillating between two scales.
+	float const smoothing_factor = 0.1f;
+	if (controller.smoothed_scalable_ms <= 0.0f) {
+		controller.smoothed_scalable_ms = scalable_gpu_time_ms;
+		controller.smoothed_fixed_ms = fixed_gpu_time_ms;
+	} else {
+		controller.smoothed_scalable_ms += smoothing_factor * (scalable_gpu_time_ms - controller.smoothed_scalable_ms);
+		controller.smoothed_fixed_ms += smoothing_factor * (fixed_gpu_time_ms - controller.smoothed_fixed_ms);
+	}
+	if (controller.smoothed_scalable_ms <= 0.0f)
+		return;
+
+	// Only the scalable passes can be sped up by lowering the resolution,
+	// and their cost is roughly proportional to the number of pixels,
+	// i.e. to the square of the scale the timings were measured at.
+	auto const budget_ms = controller.target_gpu_time_ms - controller.smoothed_fixed_ms;
+	auto desired_scale = controller.min_scale;
+	if (budget_ms > 0.0f)
+		desired_scale = measured_scale * std::sqrt(budget_ms / controller.smoothed_scalable_ms);
+	desired_scale = glm::clamp(desired_scale, controller.min_scale, controller.max_scale);
+
+	// Ignore tiny adjustments, and only move part of the way towards
+	// the desired scale as the new timings are not known yet.
+	if (std::abs(desired_scale - controller.scale) > 0.02f)
+		controller.scale += 0.5f * (desired_scale - controller.scale);
+}
+
+bool isScalablePass(std::string const& name)
+{
+	// Shadow maps and their blurs, and the Hi-Z passes, do not depend on
+	// the render size.
+	return name == pass_name::depth_prepass
+	    || name == pass_name::gbuffer
+	    || name == pass_name::downsample
+	    || name == pass_name::begin_light_accumulation
+	    || name.compare(0u, 17u, "Accumulate light ") == 0
+	    || name == pass_name::resolve
+	    || name == pass_name::temporal_antialiasing;
+}
+
+glm::vec2 getTaaJitter(std::uint32_t frame_index)
+{
+	auto const halton = [](std::uint32_t index, std::uint32_t base){
+		auto result = 0.0f;
+		auto fraction = 1.0f;
+		for (; index > 0u; index /= base) {
+			fraction /= static_cast<float>(base);
+			result += fraction * static_cast<float>(index % base);
+		}
+		return result;
+	};
+
+	// The sequence starts at 1, as its first element is 0 in all bases.
+	auto const index = frame_index % taa_jitter_samples_nb + 1u;
+	return glm::vec2(halton(index, 2u), halton(index, 3u)) - 0.5f;
+}
+
+glm::ivec2 computeRenderSize(float scale, GLsizei framebuffer_width, GLsizei framebuffer_height)
+{
+	return glm::ivec2(glm::clamp(static_cast<GLsizei>(std::lround(scale * static_cast<float>(framebuffer_width))), 1, framebuffer_width),
+	                  glm::clamp(static_cast<GLsizei>(std::lround(scale * static_cast<float>(framebuffer_height))), 1, framebuffer_height));
+}
+
+GLsizei getLightingDownscale(LightingResolution resolution)
+{
+	switch (resolution) {
+	case LightingResolution::Half:
+		return 2;
+	case LightingResolution::Quarter:
+		return 4;
+	default:
+		return 1;
+	}
+}
+
+Textures createTextures(GLsizei framebuffer_width, GLsizei framebuffer_height, RenderTargetsConfig const& config)
 {
+	bool const is_compact = config.gbuffer_layout == GBufferLayout::Compact;
+
+	GpuMemory::OwnerScope owner("EDAN35 render targets");
 	Textures textures;
 	glGenTextures(static_cast<GLsizei>(textures.size()), textures.data());
 
 	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::DepthBuffer)]);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, framebuffer_width, framebuffer_height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, framebuffer_width, framebuffer_height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
 	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::DepthBuffer)], "Depth buffer");
 
-	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::ShadowMap)]);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32F, constant::shadowmap_res_x, constant::shadowmap_res_y, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
-	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::ShadowMap)], "Shadow map");
-
 	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::GBufferDiffuse)]);
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::GBufferDiffuse)], "GBuffer diffuse");
 
-	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::GBufferSpecular)]);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::GBufferSpecular)], "GBuffer specular");
+	// The compact layout stores the specular intensity in the alpha
+	// channel of the diffuse texture, so no storage is allocated for the
+	// specular texture.
+	if (!is_compact) {
+		glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::GBufferSpecular)]);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::GBufferSpecular)], "GBuffer specular");
+	}
 
 	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::GBufferWorldSpaceNormal)]);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	if (is_compact)
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16, framebuffer_width, framebuffer_height, 0, GL_RG, GL_UNSIGNED_SHORT, nullptr);
+	else
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::GBufferWorldSpaceNormal)], "GBuffer normals");
 
-	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::LightDiffuseContribution)]);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::LightDiffuseContribution)], "Light diffuse contribution");
-
-	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::LightSpecularContribution)]);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::LightSpecularContribution)], "Light specular contribution");
-
 	glBindTexture(GL_TEXTURE_2D, textures[toU(Texture::Result)]);
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 	utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(Texture::Result)], "Final result");
 
+	// The history is kept at a higher precision than the final image, so
+	// that small contributions of each new frame do not get rounded away.
+	for (auto const history : { Texture::TaaHistory0, Texture::TaaHistory1 }) {
+		glBindTexture(GL_TEXTURE_2D, textures[toU(history)]);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_HALF_FLOAT, nullptr);
+		utils::opengl::debug::nameObject(GL_TEXTURE, textures[toU(history)], history == Texture::TaaHistory0 ? "TAA history 0" : "TAA history 1");
+	}
+
 	glBindTexture(GL_TEXTURE_2D, 0u);
 	return textures;
 }
 
+TransientTextureDescriptions createTransientTextureDescriptions(GLsizei framebuffer_width, GLsizei framebuffer_height, RenderTargetsConfig const& config)
+{
+	bool const is_compact = config.gbuffer_layout == GBufferLayout::Compact;
+	GLsizei const lighting_downscale = getLightingDownscale(config.lighting_resolution);
+	GLsizei const lighting_width = (framebuffer_width + lighting_downscale - 1) / lighting_downscale;
+	GLsizei const lighting_height = (framebuffer_height + lighting_downscale - 1) / lighting_downscale;
+
+	auto const describe = [](GLsizei width, GLsizei height, GLint internal_format, GLenum format, GLenum type){
+		FrameGraph::TextureDescription description;
+		description.width = width;
+		description.height = height;
+		description.internal_format = internal_format;
+		description.format = format;
+		description.type = type;
+		return description;
+	};
+
+	TransientTextureDescriptions descriptions;
+	descriptions.shadow_map = describe(constant::shadowmap_res_x, constant::shadowmap_res_y, GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT);
+	// The moments are mipmapped so that distant receivers get a filtered
+	// lookup too; exponential warps need the full 32-bit range.
+	descriptions.variance_shadow_moments = describe(constant::shadowmap_res_x, constant::shadowmap_res_y, GL_RG32F, GL_RG, GL_FLOAT);
+	descriptions.variance_shadow_moments.has_mipmaps = true;
+	descriptions.exponential_shadow_moments = describe(constant::shadowmap_res_x, constant::shadowmap_res_y, GL_RGBA32F, GL_RGBA, GL_FLOAT);
+	descriptions.exponential_shadow_moments.has_mipmaps = true;
+	descriptions.low_res_depth = describe(lighting_width, lighting_height, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8);
+	descriptions.low_res_normal = is_compact ? describe(lighting_width, lighting_height, GL_RG16, GL_RG, GL_UNSIGNED_SHORT)
+	                                         : describe(lighting_width, lighting_height, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE);
+	descriptions.light_contribution = is_compact ? describe(lighting_width, lighting_height, GL_R11F_G11F_B10F, GL_RGB, GL_FLOAT)
+	                                             : describe(lighting_width, lighting_height, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE);
+	descriptions.overdraw = describe(framebuffer_width, framebuffer_height, GL_R32F, GL_RED, GL_FLOAT);
+	descriptions.jittered_result = describe(framebuffer_width, framebuffer_height, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE);
+
+	return descriptions;
+}
+
 Samplers createSamplers()
 {
 	Samplers samplers;
@@ -926,6 +2833,15 @@ Samplers createSamplers()
 	glSamplerParameteri(samplers[toU(Sampler::Mipmaps)], GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	utils::opengl::debug::nameObject(GL_SAMPLER, samplers[toU(Sampler::Mipmaps)], "Mimaps");
 
+	// For percentage-closer filtering of depth textures.
+	glSamplerParameteri(samplers[toU(Sampler::ShadowComparison)], GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glSamplerParameteri(samplers[toU(Sampler::ShadowComparison)], GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glSamplerParameteri(samplers[toU(Sampler::ShadowComparison)], GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glSamplerParameteri(samplers[toU(Sampler::ShadowComparison)], GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	glSamplerParameteri(samplers[toU(Sampler::ShadowComparison)], GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glSamplerParameteri(samplers[toU(Sampler::ShadowComparison)], GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	utils::opengl::debug::nameObject(GL_SAMPLER, samplers[toU(Sampler::ShadowComparison)], "Shadow comparison");
+
 	return samplers;
 }
 
@@ -942,41 +2858,6 @@ FBOs createFramebufferObjects(Textures const& textures)
 	FBOs fbos;
 	glGenFramebuffers(static_cast<GLsizei>(fbos.size()), fbos.data());
 
-	glBindFramebuffer(GL_FRAMEBUFFER, fbos[toU(FBO::GBuffer)]);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[toU(Texture::GBufferDiffuse)], 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, textures[toU(Texture::GBufferSpecular)], 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT2, GL_TEXTURE_2D, textures[toU(Texture::GBufferWorldSpaceNormal)], 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, textures[toU(Texture::DepthBuffer)], 0);
-	glReadBuffer(GL_NONE); // Disable reading back from the colour attachments, as unnecessary in this assignment.
-	// Configure the mapping from fragment shader outputs to colour attachments.
-	std::array<GLenum, 3> const gbuffer_draws = {
-		GL_COLOR_ATTACHMENT0, // The fragment shader output at location 0 will be written to colour attachment 0 (i.e. the diffuse texture).
-		GL_COLOR_ATTACHMENT1, // The fragment shader output at location 1 will be written to colour attachment 1 (i.e. the specular texture).
-		GL_COLOR_ATTACHMENT2  // The fragment shader output at location 2 will be written to colour attachment 2 (i.e. the normal texture).
-	};
-	glDrawBuffers(static_cast<GLsizei>(gbuffer_draws.size()), gbuffer_draws.data());
-	validate_fbo("GBuffer");
-	utils::opengl::debug::nameObject(GL_FRAMEBUFFER, fbos[toU(FBO::GBuffer)], "GBuffer");
-
-	glBindFramebuffer(GL_FRAMEBUFFER, fbos[toU(FBO::ShadowMap)]);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, textures[toU(Texture::ShadowMap)], 0);
-	validate_fbo("Shadow map generation");
-	utils::opengl::debug::nameObject(GL_FRAMEBUFFER, fbos[toU(FBO::ShadowMap)], "Shadow map generation");
-
-	glBindFramebuffer(GL_FRAMEBUFFER, fbos[toU(FBO::LightAccumulation)]);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[toU(Texture::LightDiffuseContribution)], 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, textures[toU(Texture::LightSpecularContribution)], 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, textures[toU(Texture::DepthBuffer)], 0);
-	glReadBuffer(GL_NONE); // Disable reading back from the colour attachments, as unnecessary in this assignment.
-	// Configure the mapping from fragment shader outputs to colour attachments.
-	std::array<GLenum, 2> const light_accumulation_draws = {
-		GL_COLOR_ATTACHMENT0, // The fragment shader output at location 0 will be written to colour attachment 0 (i.e. the light diffuse contribution texture).
-		GL_COLOR_ATTACHMENT1  // The fragment shader output at location 1 will be written to colour attachment 1 (i.e. the light specular contribution texture).
-	};
-	glDrawBuffers(static_cast<GLsizei>(light_accumulation_draws.size()), light_accumulation_draws.data());
-	validate_fbo("Light accumulation");
-	utils::opengl::debug::nameObject(GL_FRAMEBUFFER, fbos[toU(FBO::LightAccumulation)], "Light acccumulation");
-
 	glBindFramebuffer(GL_FRAMEBUFFER, fbos[toU(FBO::Resolve)]);
 	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[toU(Texture::Result)], 0);
 	glReadBuffer(GL_COLOR_ATTACHMENT0); // Colour attachment result 0 (i.e. the rendering result texture) will be blitted to the screen.
@@ -986,7 +2867,7 @@ FBOs createFramebufferObjects(Textures const& textures)
 
 	glBindFramebuffer(GL_FRAMEBUFFER, fbos[toU(FBO::FinalWithDepth)]);
 	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[toU(Texture::Result)], 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, textures[toU(Texture::DepthBuffer)], 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, textures[toU(Texture::DepthBuffer)], 0);
 	glReadBuffer(GL_NONE); // Disable reading back from the colour attachments, as unnecessary in this assignment.
 	glDrawBuffer(GL_COLOR_ATTACHMENT0); // The fragment shader output at location 0 will be written to colour attachment 0 (i.e. the rendering result texture).
 	validate_fbo("Final with depth");
@@ -996,6 +2877,96 @@ FBOs createFramebufferObjects(Textures const& textures)
 	return fbos;
 }
 
+ImageComparison createImageComparison(GLsizei framebuffer_width, GLsizei framebuffer_height)
+{
+	ImageComparison comparison;
+
+	glGenTextures(1, &comparison.reference_texture);
+	glBindTexture(GL_TEXTURE_2D, comparison.reference_texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, framebuffer_width, framebuffer_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	utils::opengl::debug::nameObject(GL_TEXTURE, comparison.reference_texture, "Reference image");
+
+	// Each texel holds the sums over a tile of the absolute errors, in
+	// the red channel, and of the squared errors, in the green one.
+	comparison.resolution = glm::ivec2(framebuffer_width, framebuffer_height);
+	comparison.tiles_nb = (comparison.resolution + (image_difference_tile_size - 1)) / image_difference_tile_size;
+	glGenTextures(1, &comparison.difference_texture);
+	glBindTexture(GL_TEXTURE_2D, comparison.difference_texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RG32F, comparison.tiles_nb.x, comparison.tiles_nb.y, 0, GL_RG, GL_FLOAT, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+	utils::opengl::debug::nameObject(GL_TEXTURE, comparison.difference_texture, "Image difference");
+	glBindTexture(GL_TEXTURE_2D, 0u);
+
+	glGenBuffers(1, &comparison.readback_buffer);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, comparison.readback_buffer);
+	glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(comparison.tiles_nb.x) * comparison.tiles_nb.y * 2 * sizeof(GLfloat), nullptr, GL_STREAM_READ);
+	utils::opengl::debug::nameObject(GL_BUFFER, comparison.readback_buffer, "Image difference read back");
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+
+	glGenFramebuffers(1, &comparison.difference_fbo);
+	glBindFramebuffer(GL_FRAMEBUFFER, comparison.difference_fbo);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, comparison.difference_texture, 0);
+	glReadBuffer(GL_NONE);
+	glDrawBuffer(GL_COLOR_ATTACHMENT0);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		LogError("Framebuffer \"Image difference\" is not complete: check the logs for additional information.");
+	utils::opengl::debug::nameObject(GL_FRAMEBUFFER, comparison.difference_fbo, "Image difference");
+	glBindFramebuffer(GL_FRAMEBUFFER, 0u);
+
+	return comparison;
+}
+
+void deleteImageComparison(ImageComparison& comparison)
+{
+	glDeleteSync(comparison.readback_fence);
+	comparison.readback_fence = nullptr;
+	glDeleteBuffers(1, &comparison.readback_buffer);
+	comparison.readback_buffer = 0u;
+	glDeleteFramebuffers(1, &comparison.difference_fbo);
+	comparison.difference_fbo = 0u;
+	glDeleteTextures(1, &comparison.difference_texture);
+	comparison.difference_texture = 0u;
+	glDeleteTextures(1, &comparison.reference_texture);
+	comparison.reference_texture = 0u;
+	comparison.has_reference = false;
+}
+
+bool readBackImageDifference(ImageComparison& comparison)
+{
+	if (comparison.readback_fence == nullptr)
+		return false;
+	auto const status = glClientWaitSync(comparison.readback_fence, 0, 0);
+	if (status == GL_TIMEOUT_EXPIRED)
+		return false;
+	glDeleteSync(comparison.readback_fence);
+	comparison.readback_fence = nullptr;
+	if (status == GL_WAIT_FAILED)
+		return false;
+
+	auto const texels_nb = static_cast<size_t>(comparison.tiles_nb.x) * static_cast<size_t>(comparison.tiles_nb.y);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, comparison.readback_buffer);
+	auto const* const sums = static_cast<GLfloat const*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(texels_nb * 2u * sizeof(GLfloat)), GL_MAP_READ_BIT));
+	if (sums == nullptr) {
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+		return false;
+	}
+	// Summing in double precision keeps the mean exact enough whatever
+	// the resolution.
+	double absolute_error_sum = 0.0;
+	double squared_error_sum = 0.0;
+	for (size_t i = 0; i < texels_nb; ++i) {
+		absolute_error_sum += static_cast<double>(sums[2u * i]);
+		squared_error_sum += static_cast<double>(sums[2u * i + 1u]);
+	}
+	glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+
+	auto const pixels_nb = static_cast<double>(comparison.resolution.x) * static_cast<double>(comparison.resolution.y);
+	comparison.mean_absolute_error = static_cast<float>(absolute_error_sum / pixels_nb);
+	comparison.mean_squared_error = static_cast<float>(squared_error_sum / pixels_nb);
+	return true;
+}
+
 ElapsedTimeQueries createElapsedTimeQueries()
 {
 	ElapsedTimeQueries queries;
@@ -1011,20 +2982,8 @@ ElapsedTimeQueries createElapsedTimeQueries()
 			glEndQuery(GL_TIME_ELAPSED);
 		};
 
-		register_query(queries[toU(ElapsedTimeQuery::GbufferGeneration)]);
-		utils::opengl::debug::nameObject(GL_QUERY, queries[toU(ElapsedTimeQuery::GbufferGeneration)], "GBuffer generation");
-
-		for (size_t i = 0; i < constant::lights_nb; ++i)
-		{
-			register_query(queries[toU(ElapsedTimeQuery::ShadowMap0Generation) + i]);
-			utils::opengl::debug::nameObject(GL_QUERY, queries[toU(ElapsedTimeQuery::ShadowMap0Generation) + i], "Shadow map " + std::to_string(i) + " generation");
-
-			register_query(queries[toU(ElapsedTimeQuery::Light0Accumulation) + i]);
-			utils::opengl::debug::nameObject(GL_QUERY, queries[toU(ElapsedTimeQuery::Light0Accumulation) + i], "Light" + std::to_string(i) + " accumulation");
-		}
-
-		register_query(queries[toU(ElapsedTimeQuery::Resolve)]);
-		utils::opengl::debug::nameObject(GL_QUERY, queries[toU(ElapsedTimeQuery::Resolve)], "Resolve");
+		register_query(queries[toU(ElapsedTimeQuery::ImageDifference)]);
+		utils::opengl::debug::nameObject(GL_QUERY, queries[toU(ElapsedTimeQuery::ImageDifference)], "Image difference");
 
 		register_query(queries[toU(ElapsedTimeQuery::ConeWireframe)]);
 		utils::opengl::debug::nameObject(GL_QUERY, queries[toU(ElapsedTimeQuery::ConeWireframe)], "Cone wireframe");
@@ -1036,25 +2995,122 @@ ElapsedTimeQueries createElapsedTimeQueries()
 	return queries;
 }
 
+void resizeLightQueries(std::vector<LightQueries>& queries, size_t lights_nb)
+{
+	while (queries.size() > lights_nb) {
+		auto const& light_queries = queries.back();
+		glDeleteQueries(1, &light_queries.shaded_pixels);
+		glDeleteQueries(1, &light_queries.accumulation);
+		glDeleteQueries(1, &light_queries.shadow_map_generation);
+		queries.pop_back();
+	}
+
+	// Run every new query once: this allocates their resources so that
+	// they can be labelled, and makes their results available even before
+	// they are used for rendering.
+	auto const create_query = [](GLenum target, std::string const& label) {
+		GLuint query = 0u;
+		glGenQueries(1, &query);
+		glBeginQuery(target, query);
+		glEndQuery(target);
+		utils::opengl::debug::nameObject(GL_QUERY, query, label);
+		return query;
+	};
+	while (queries.size() < lights_nb) {
+		auto const i = std::to_string(queries.size());
+
+		LightQueries light_queries;
+		light_queries.shadow_map_generation = create_query(GL_TIME_ELAPSED, "Shadow map " + i + " generation");
+		light_queries.accumulation = create_query(GL_TIME_ELAPSED, "Light" + i + " accumulation");
+		light_queries.shaded_pixels = create_query(GL_SAMPLES_PASSED, "Light" + i + " shaded pixels");
+		queries.push_back(light_queries);
+	}
+}
+
 UBOs createUniformBufferObjects()
 {
 	UBOs ubos;
 	glGenBuffers(static_cast<GLsizei>(ubos.size()), ubos.data());
 
 	glBindBuffer(GL_UNIFORM_BUFFER, ubos[toU(UBO::CameraViewProjTransforms)]);
-	glBufferData(GL_UNIFORM_BUFFER, sizeof(ViewProjTransforms), nullptr, GL_STREAM_DRAW);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(edan35::ViewProjTransforms), nullptr, GL_STREAM_DRAW);
 	glBindBufferBase(GL_UNIFORM_BUFFER, toU(UBO::CameraViewProjTransforms), ubos[toU(UBO::CameraViewProjTransforms)]);
 	utils::opengl::debug::nameObject(GL_BUFFER, ubos[toU(UBO::CameraViewProjTransforms)], "Camera view-projection transforms");
 
 	glBindBuffer(GL_UNIFORM_BUFFER, ubos[toU(UBO::LightViewProjTransforms)]);
-	glBufferData(GL_UNIFORM_BUFFER, constant::lights_nb * sizeof(ViewProjTransforms), nullptr, GL_STREAM_DRAW);
+	glBufferData(GL_UNIFORM_BUFFER, edan35::LightSystem::max_lights_nb * sizeof(edan35::ViewProjTransforms), nullptr, GL_DYNAMIC_DRAW);
 	glBindBufferBase(GL_UNIFORM_BUFFER, toU(UBO::LightViewProjTransforms), ubos[toU(UBO::LightViewProjTransforms)]);
 	utils::opengl::debug::nameObject(GL_BUFFER, ubos[toU(UBO::LightViewProjTransforms)], "Light view-projection transforms");
 
+	glBindBuffer(GL_UNIFORM_BUFFER, ubos[toU(UBO::Materials)]);
+	glBufferData(GL_UNIFORM_BUFFER, edan35::MaterialAtlas::max_materials_nb * sizeof(edan35::MaterialData), nullptr, GL_STATIC_DRAW);
+	glBindBufferBase(GL_UNIFORM_BUFFER, toU(UBO::Materials), ubos[toU(UBO::Materials)]);
+	utils::opengl::debug::nameObject(GL_BUFFER, ubos[toU(UBO::Materials)], "Materials");
+
 	glBindBuffer(GL_UNIFORM_BUFFER, 0u);
 	return ubos;
 }
 
+std::vector<BatchedDrawGroup> createBatchedDrawGroups(edan35::GeometryBatch& batch,
+                                                      std::vector<size_t> const& mesh_indices,
+                                                      std::vector<GeometryTextureData> const& meshes_texture_data)
+{
+	std::vector<BatchedDrawGroup> groups;
+	std::vector<std::vector<size_t>> groups_mesh_indices;
+	for (auto const mesh_index : mesh_indices) {
+		auto const& texture_data = meshes_texture_data[mesh_index];
+		auto const group = std::find_if(groups.begin(), groups.end(), [&texture_data](BatchedDrawGroup const& group){
+			return group.texture_data.diffuse_texture_id == texture_data.diffuse_texture_id
+			    && group.texture_data.specular_texture_id == texture_data.specular_texture_id
+			    && group.texture_data.normals_texture_id == texture_data.normals_texture_id
+			    && group.texture_data.opacity_texture_id == texture_data.opacity_texture_id;
+		});
+		if (group != groups.end()) {
+			groups_mesh_indices[static_cast<size_t>(group - groups.begin())].push_back(mesh_index);
+		} else {
+			groups.push_back({ texture_data, {} });
+			groups_mesh_indices.push_back({ mesh_index });
+		}
+	}
+
+	for (size_t i = 0; i < groups.size(); ++i)
+		groups[i].draw_list = batch.CreateDrawList(groups_mesh_indices[i]);
+
+	return groups;
+}
+
+std::vector<BatchedDrawGroup> createVisibleDrawGroups(edan35::GeometryBatch& batch,
+                                                      std::vector<BatchedDrawGroup> const& groups,
+                                                      std::vector<std::uint8_t> const& is_mesh_visible)
+{
+	std::vector<BatchedDrawGroup> visible_groups;
+	visible_groups.reserve(groups.size());
+	for (auto const& group : groups) {
+		auto const draw_list = batch.CreateTransientDrawList(group.draw_list, is_mesh_visible);
+		if (draw_list.commands_nb != 0)
+			visible_groups.push_back({ group.texture_data, draw_list });
+	}
+	return visible_groups;
+}
+
+MeshBounds computeMeshBounds(bonobo::mesh_data const& mesh)
+{
+	MeshBounds bounds;
+	if (mesh.drawing_mode != GL_TRIANGLES || mesh.positions.empty() || mesh.indices.empty())
+		return bounds;
+
+	// Sponza is drawn with an identity model-to-world transform, so the
+	// model-space positions are already in world space.
+	bounds.min = bounds.max = mesh.positions.front();
+	for (auto const& position : mesh.positions) {
+		bounds.min = glm::min(bounds.min, position);
+		bounds.max = glm::max(bounds.max, position);
+	}
+	bounds.is_bounded = true;
+
+	return bounds;
+}
+
 void fillGBufferShaderLocations(GLuint gbuffer_shader, GBufferShaderLocations& locations)
 {
 	locations.ubo_CameraViewProjTransforms = glGetUniformBlockIndex(gbuffer_shader, "CameraViewProjTransforms");
@@ -1068,8 +3124,16 @@ void fillGBufferShaderLocations(GLuint gbuffer_shader, GBufferShaderLocations& l
 	locations.has_specular_texture = glGetUniformLocation(gbuffer_shader, "has_specular_texture");
 	locations.has_normals_texture = glGetUniformLocation(gbuffer_shader, "has_normals_texture");
 	locations.has_opacity_texture = glGetUniformLocation(gbuffer_shader, "has_opacity_texture");
+	locations.use_compact_gbuffer = glGetUniformLocation(gbuffer_shader, "use_compact_gbuffer");
+	locations.ubo_Materials = glGetUniformBlockIndex(gbuffer_shader, "Materials");
+	locations.material_index = glGetUniformLocation(gbuffer_shader, "material_index");
+	locations.use_material_atlas = glGetUniformLocation(gbuffer_shader, "use_material_atlas");
+	locations.material_texture_arrays = glGetUniformLocation(gbuffer_shader, "material_texture_arrays");
 
 	glUniformBlockBinding(gbuffer_shader, locations.ubo_CameraViewProjTransforms, toU(UBO::CameraViewProjTransforms));
+	// The depth pre-pass shares those locations, but has no material.
+	if (locations.ubo_Materials != GL_INVALID_INDEX)
+		glUniformBlockBinding(gbuffer_shader, locations.ubo_Materials, toU(UBO::Materials));
 
 }
 
@@ -1080,8 +3144,16 @@ void fillShadowmapShaderLocations(GLuint shadowmap_shader, FillShadowmapShaderLo
 	locations.vertex_model_to_world = glGetUniformLocation(shadowmap_shader, "vertex_model_to_world");
 	locations.opacity_texture = glGetUniformLocation(shadowmap_shader, "opacity_texture");
 	locations.has_opacity_texture = glGetUniformLocation(shadowmap_shader, "has_opacity_texture");
+	locations.ubo_Materials = glGetUniformBlockIndex(shadowmap_shader, "Materials");
+	locations.material_index = glGetUniformLocation(shadowmap_shader, "material_index");
+	locations.use_material_atlas = glGetUniformLocation(shadowmap_shader, "use_material_atlas");
+	locations.material_texture_arrays = glGetUniformLocation(shadowmap_shader, "material_texture_arrays");
+	locations.shadow_filtering = glGetUniformLocation(shadowmap_shader, "shadow_filtering");
+	locations.shadow_depth_scale = glGetUniformLocation(shadowmap_shader, "shadow_depth_scale");
+	locations.evsm_exponents = glGetUniformLocation(shadowmap_shader, "evsm_exponents");
 
 	glUniformBlockBinding(shadowmap_shader, locations.ubo_LightViewProjTransforms, toU(UBO::LightViewProjTransforms));
+	glUniformBlockBinding(shadowmap_shader, locations.ubo_Materials, toU(UBO::Materials));
 }
 
 void fillAccumulateLightsShaderLocations(GLuint accumulate_lights_shader, AccumulateLightsShaderLocations& locations)
@@ -1095,13 +3167,23 @@ void fillAccumulateLightsShaderLocations(GLuint accumulate_lights_shader, Accumu
 	locations.depth_texture = glGetUniformLocation(accumulate_lights_shader, "depth_texture");
 	locations.normal_texture = glGetUniformLocation(accumulate_lights_shader, "normal_texture");
 	locations.shadow_texture = glGetUniformLocation(accumulate_lights_shader, "shadow_texture");
+	locations.shadow_moments_texture = glGetUniformLocation(accumulate_lights_shader, "shadow_moments_texture");
+	locations.shadow_filtering = glGetUniformLocation(accumulate_lights_shader, "shadow_filtering");
+	locations.pcf_kernel_radius = glGetUniformLocation(accumulate_lights_shader, "pcf_kernel_radius");
+	locations.shadow_depth_scale = glGetUniformLocation(accumulate_lights_shader, "shadow_depth_scale");
+	locations.shadow_receiver_offset = glGetUniformLocation(accumulate_lights_shader, "shadow_receiver_offset");
+	locations.evsm_exponents = glGetUniformLocation(accumulate_lights_shader, "evsm_exponents");
+	locations.light_bleeding_reduction = glGetUniformLocation(accumulate_lights_shader, "light_bleeding_reduction");
+	locations.show_shadow_visibility = glGetUniformLocation(accumulate_lights_shader, "show_shadow_visibility");
 	locations.camera_position = glGetUniformLocation(accumulate_lights_shader, "camera_position");
 	locations.inverse_screen_resolution = glGetUniformLocation(accumulate_lights_shader, "inverse_screen_resolution");
+	locations.render_scale = glGetUniformLocation(accumulate_lights_shader, "render_scale");
 	locations.light_color = glGetUniformLocation(accumulate_lights_shader, "light_color");
 	locations.light_position = glGetUniformLocation(accumulate_lights_shader, "light_position");
 	locations.light_direction = glGetUniformLocation(accumulate_lights_shader, "light_direction");
 	locations.light_intensity = glGetUniformLocation(accumulate_lights_shader, "light_intensity");
 	locations.light_angle_falloff = glGetUniformLocation(accumulate_lights_shader, "light_angle_falloff");
+	locations.use_compact_gbuffer = glGetUniformLocation(accumulate_lights_shader, "use_compact_gbuffer");
 
 	glUniformBlockBinding(accumulate_lights_shader, locations.ubo_CameraViewProjTransforms, toU(UBO::CameraViewProjTransforms));
 	glUniformBlockBinding(accumulate_lights_shader, locations.ubo_LightViewProjTransforms, toU(UBO::LightViewProjTransforms));
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Benchmark.hpp"
+
 #include "core/InputHandler.h"
 #include "core/FPSCamera.h"
 #include "core/WindowManager.hpp"
@@ -17,7 +19,11 @@ namespace edan35
 		//!
 		//! It will initialise various modules of bonobo and retrieve a
 		//! window to draw to.
-		Assignment2(WindowManager& windowManager);
+		//!
+		//! @param [in] benchmark_settings when a camera path is given,
+		//!             fly along it and measure the frame times instead
+		//!             of running interactively
+		Assignment2(WindowManager& windowManager, BenchmarkSettings const& benchmark_settings);
 
 		//! \brief Default destructor.
 		//!
@@ -34,5 +40,6 @@ namespace edan35
 		InputHandler   inputHandler;
 		WindowManager& mWindowManager;
 		GLFWwindow*    window;
+		BenchmarkSettings mBenchmarkSettings;
 	};
 }
@@ -0,0 +1,103 @@
+#include "config.hpp"
+#include "core/helpers.hpp"
+#include "EDAF80/parametric_shapes.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+	void releaseMeshes(std::vector<bonobo::mesh_data> const& meshes)
+	{
+		// Meshes loaded from the same file can share their textures.
+		std::unordered_set<GLuint> textures;
+		for (auto const& mesh : meshes) {
+			for (auto const& binding : mesh.bindings)
+				textures.insert(binding.second);
+			glDeleteBuffers(1, &mesh.ibo);
+			glDeleteBuffers(1, &mesh.bo);
+			glDeleteVertexArrays(1, &mesh.vao);
+		}
+		for (auto const texture : textures)
+			glDeleteTextures(1, &texture);
+	}
+
+	// Each iteration generates the vertices and uploads them; the upload
+	// is waited for, so that it is fully accounted for.
+	template<typename CreateShape>
+	void runShapeBenchmark(benchmark::State& state, CreateShape create_shape)
+	{
+		std::int64_t vertices_nb = 0;
+		for (auto _ : state) {
+			auto const shape = create_shape();
+			glFinish();
+
+			state.PauseTiming();
+			vertices_nb = shape.vertices_nb;
+			releaseMeshes({ shape });
+			state.ResumeTiming();
+		}
+
+		if (vertices_nb == 0) {
+			state.SkipWithError("No vertices were generated: is the shape implemented?");
+			return;
+		}
+		state.counters["vertices"] = static_cast<double>(vertices_nb);
+		state.SetItemsProcessed(state.iterations() * vertices_nb);
+	}
+
+	void BM_CreateSphere(benchmark::State& state)
+	{
+		auto const split_count = static_cast<unsigned int>(state.range(0));
+		runShapeBenchmark(state, [split_count](){
+			return parametric_shapes::createSphere(1.0f, split_count, split_count / 2u);
+		});
+	}
+
+	void BM_CreateTorus(benchmark::State& state)
+	{
+		auto const split_count = static_cast<unsigned int>(state.range(0));
+		runShapeBenchmark(state, [split_count](){
+			return parametric_shapes::createTorus(1.0f, 0.25f, split_count, split_count / 2u);
+		});
+	}
+
+	void BM_CreateCircleRing(benchmark::State& state)
+	{
+		auto const split_count = static_cast<unsigned int>(state.range(0));
+		runShapeBenchmark(state, [split_count](){
+			return parametric_shapes::createCircleRing(1.0f, 0.5f, split_count, split_count / 4u);
+		});
+	}
+
+	void BM_LoadObjects(benchmark::State& state, char const* scene)
+	{
+		auto const filename = config::resources_path(scene);
+		size_t meshes_nb = 0u;
+		for (auto _ : state) {
+			auto const meshes = bonobo::loadObjects(filename);
+			glFinish();
+
+			state.PauseTiming();
+			meshes_nb = meshes.size();
+			releaseMeshes(meshes);
+			state.ResumeTiming();
+		}
+
+		if (meshes_nb == 0u) {
+			state.SkipWithError("No meshes were loaded: is the resource archive available?");
+			return;
+		}
+		state.counters["meshes"] = static_cast<double>(meshes_nb);
+	}
+}
+
+BENCHMARK(BM_CreateSphere)->RangeMultiplier(4)->Range(8, 2048)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CreateTorus)->RangeMultiplier(4)->Range(8, 2048)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CreateCircleRing)->RangeMultiplier(4)->Range(8, 2048)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_LoadObjects, sphere, "scenes/sphere.obj")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadObjects, sponza, "sponza/sponza.obj")->Unit(benchmark::kMillisecond)->Iterations(3);
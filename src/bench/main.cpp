@@ -0,0 +1,57 @@
+#include "config.hpp"
+#include "core/Bonobo.h"
+#include "core/FPSCamera.h"
+#include "core/helpers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/gtc/constants.hpp>
+
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+	std::setlocale(LC_ALL, "");
+
+	// Creating meshes requires an OpenGL context, hence a window; pass
+	// `--headless` to run without a display.
+	Bonobo framework(argc, argv);
+	WindowManager& window_manager = framework.GetWindowManager();
+
+	InputHandler input_handler;
+	FPSCameraf camera(0.5f * glm::half_pi<float>(),
+	                  static_cast<float>(config::resolution_x) / static_cast<float>(config::resolution_y),
+	                  0.01f, 1000.0f);
+	WindowManager::WindowDatum window_datum{ input_handler, camera, config::resolution_x, config::resolution_y, 0, 0, 0, 0 };
+	GLFWwindow* window = window_manager.CreateGLFWWindow("CG_Labs microbenchmarks", window_datum, 1u, false, false,
+	                                                     WindowManager::SwapStrategy::disable_vsync);
+	if (window == nullptr) {
+		LogError("Failed to get a window: aborting!");
+		return EXIT_FAILURE;
+	}
+	bonobo::init();
+
+	// Results are always written as JSON, to be compared between runs with
+	// Google Benchmark's `compare.py`, unless another output was requested.
+	std::vector<char*> arguments(argv, argv + argc);
+	bool has_output = false;
+	for (auto const argument : arguments)
+		has_output |= std::strncmp(argument, "--benchmark_out=", 16) == 0;
+	char default_output[] = "--benchmark_out=microbenchmarks.json";
+	char default_output_format[] = "--benchmark_out_format=json";
+	if (!has_output) {
+		arguments.push_back(default_output);
+		arguments.push_back(default_output_format);
+	}
+	auto arguments_nb = static_cast<int>(arguments.size());
+
+	benchmark::Initialize(&arguments_nb, arguments.data());
+	benchmark::RunSpecifiedBenchmarks();
+
+	bonobo::deinit();
+	window_manager.DestroyWindow(window);
+
+	return EXIT_SUCCESS;
+}
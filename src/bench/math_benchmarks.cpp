@@ -0,0 +1,119 @@
+#include "core/FPSCamera.h"
+#include "core/TRSTransform.h"
+#include "EDAF80/interpolation.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+	// Samples are spread over a fixed set of control points, so that each
+	// evaluation reads different data.
+	constexpr size_t control_points_nb = 1024u;
+
+	std::vector<glm::vec3> createControlPoints()
+	{
+		std::srand(42u);
+		std::vector<glm::vec3> control_points(control_points_nb);
+		for (auto& control_point : control_points)
+			control_point = glm::vec3(static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX),
+			                          static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX),
+			                          static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX));
+		return control_points;
+	}
+
+	void BM_EvalLERP(benchmark::State& state)
+	{
+		auto const control_points = createControlPoints();
+		auto const samples_nb = static_cast<size_t>(state.range(0));
+		for (auto _ : state) {
+			for (size_t i = 0; i < samples_nb; ++i) {
+				auto const segment = i % (control_points_nb - 1u);
+				auto const x = static_cast<float>(i % 16u) / 16.0f;
+				benchmark::DoNotOptimize(interpolation::evalLERP(control_points[segment], control_points[segment + 1u], x));
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void BM_EvalCatmullRom(benchmark::State& state)
+	{
+		auto const control_points = createControlPoints();
+		auto const samples_nb = static_cast<size_t>(state.range(0));
+		for (auto _ : state) {
+			for (size_t i = 0; i < samples_nb; ++i) {
+				auto const segment = i % (control_points_nb - 3u);
+				auto const x = static_cast<float>(i % 16u) / 16.0f;
+				benchmark::DoNotOptimize(interpolation::evalCatmullRom(control_points[segment], control_points[segment + 1u],
+				                                                       control_points[segment + 2u], control_points[segment + 3u],
+				                                                       0.5f, x));
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	// Compose a chain of transforms, as done when traversing a scene graph
+	// such as the solar system of the first assignment.
+	void BM_TRSTransformComposition(benchmark::State& state)
+	{
+		auto const depth = static_cast<size_t>(state.range(0));
+		std::vector<TRSTransformf> transforms(depth);
+		for (size_t i = 0; i < depth; ++i) {
+			transforms[i].SetTranslate(glm::vec3(static_cast<float>(i), 0.0f, 1.0f));
+			transforms[i].SetScale(0.9f);
+		}
+
+		float angle = 0.0f;
+		for (auto _ : state) {
+			angle += 0.01f;
+			glm::mat4 world = glm::mat4(1.0f);
+			for (auto& transform : transforms) {
+				transform.SetRotateY(angle);
+				world = world * transform.GetMatrix();
+			}
+			benchmark::DoNotOptimize(world);
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void BM_TRSTransformInverse(benchmark::State& state)
+	{
+		TRSTransformf transform;
+		transform.SetTranslate(glm::vec3(1.0f, 2.0f, 3.0f));
+		transform.SetScale(2.0f);
+
+		float angle = 0.0f;
+		for (auto _ : state) {
+			angle += 0.01f;
+			transform.SetRotateX(angle);
+			benchmark::DoNotOptimize(transform.GetMatrixInverse());
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	void BM_FPSCameraMatrices(benchmark::State& state)
+	{
+		FPSCameraf camera(0.5f * glm::half_pi<float>(), 16.0f / 9.0f, 0.01f, 1000.0f);
+		camera.mWorld.SetTranslate(glm::vec3(0.0f, 1.0f, 2.0f));
+
+		float angle = 0.0f;
+		for (auto _ : state) {
+			angle += 0.01f;
+			camera.mWorld.SetRotateY(angle);
+			benchmark::DoNotOptimize(camera.GetWorldToClipMatrix());
+			benchmark::DoNotOptimize(camera.GetClipToWorldMatrix());
+			benchmark::DoNotOptimize(camera.GetWorldToViewMatrix());
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+}
+
+BENCHMARK(BM_EvalLERP)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK(BM_EvalCatmullRom)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK(BM_TRSTransformComposition)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_TRSTransformInverse);
+BENCHMARK(BM_FPSCameraMatrices);
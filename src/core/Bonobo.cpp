@@ -1,7 +1,27 @@
 #include "Bonobo.h"
 #include "Log.h"
 
-Bonobo::Bonobo() {
+Bonobo::Bonobo() : Bonobo(0, nullptr)
+{
+}
+
+Bonobo::Bonobo(int argc, char const* const argv[]) : windowManager(WindowManager::ParseHeadlessSettings(argc, argv))
+{
+	auto const input_replay_settings = WindowManager::ParseInputReplaySettings(argc, argv);
+	windowManager.SetInputReplaySettings(input_replay_settings);
+
+	// Replayed inputs only lead to the same session if the frames last as
+	// long as when they were recorded, so both use offline time.
+	auto frame_clock_settings = FrameClock::ParseSettings(argc, argv);
+	if (!input_replay_settings.replay_filename.empty() && !frame_clock_settings.is_offline) {
+		LogInfo("Replaying inputs: switching to offline time.");
+		frame_clock_settings.is_offline = true;
+	} else if (!input_replay_settings.record_filename.empty() && !frame_clock_settings.is_offline) {
+		LogInfo("Recording inputs: switching to offline time.");
+		frame_clock_settings.is_offline = true;
+	}
+	windowManager.SetFrameClockSettings(frame_clock_settings);
+	windowManager.SetFrameStatsSettings(FrameStats::ParseSettings(argc, argv));
 	LogInfo("Framework initialisation done.");
 }
 
@@ -7,6 +7,12 @@
 class Bonobo {
 public:
 	Bonobo();
+
+	//! \brief Initialise the framework from the command-line arguments;
+	//!        see `WindowManager::ParseHeadlessSettings()`,
+	//!        `WindowManager::ParseInputReplaySettings()` and
+	//!        `FrameClock::ParseSettings()` for the recognised ones.
+	Bonobo(int argc, char const* const argv[]);
 	~Bonobo();
 	WindowManager& GetWindowManager() noexcept;
 
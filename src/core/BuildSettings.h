@@ -26,6 +26,21 @@
 */
 #define ENABLE_PROFILING				1
 
+/*
+*	Enables (1) or disables (0) GPU memory tracking (found in GpuMemory.hpp)
+*	Every allocation queries the bound object, so only turn on when inspecting memory use.
+*/
+#define ENABLE_GPU_MEMORY_TRACKING		0
+
+/*
+*	Enables (1) or disables (0) counting and timing of all OpenGL calls (found in GLTrace.hpp)
+*	Wraps every call, so only turn on when measuring the driver overhead; it
+*	needs the debug GLAD, so it is set by configuring with LUGGCGL_TRACE_GL_CALLS=ON.
+*/
+#ifndef ENABLE_GL_CALL_TRACING
+#define ENABLE_GL_CALL_TRACING			0
+#endif
+
 /*
 *	Enables (1) or disables (0) GL render state inspection (found in GLStateInspection.h)
 *	Turn off for maximum performance.
@@ -25,6 +25,14 @@ public:
 	void SetAspect(T a);
 	T GetAspect();
 
+	//! \brief Offset the projection by a sub-pixel amount, e.g. for
+	//!        temporal anti-aliasing.
+	//!
+	//! @param [in] jitter offset in normalised device coordinates, i.e.
+	//!             twice the offset in pixels divided by the resolution
+	void SetJitter(glm::tvec2<T, P> const& jitter);
+	glm::tvec2<T, P> GetJitter();
+
 	glm::tmat4x4<T, P> GetViewToWorldMatrix();
 	glm::tmat4x4<T, P> GetWorldToViewMatrix();
 	glm::tmat4x4<T, P> GetClipToWorldMatrix();
@@ -32,6 +40,9 @@ public:
 	glm::tmat4x4<T, P> GetClipToViewMatrix();
 	glm::tmat4x4<T, P> GetViewToClipMatrix();
 
+	//! \brief Same as `GetWorldToClipMatrix()`, without the jitter.
+	glm::tmat4x4<T, P> GetUnjitteredWorldToClipMatrix();
+
 	glm::tvec3<T, P> GetClipToWorld(glm::tvec3<T, P> xyw);
 	glm::tvec3<T, P> GetClipToView(glm::tvec3<T, P> xyw);
 
@@ -45,6 +56,8 @@ public:
 	glm::tmat4x4<T, P> mProjection;
 	glm::tmat4x4<T, P> mProjectionInverse;
 	glm::tvec2<T, P> mMousePosition;
+	glm::tmat4x4<T, P> mUnjitteredProjection;
+	glm::tvec2<T, P> mJitter;
 
 public:
 	friend std::ostream &operator<<(std::ostream &os, FPSCamera<T, P> &v) {
@@ -1,5 +1,5 @@
 template<typename T, glm::precision P>
-FPSCamera<T, P>::FPSCamera(T fovy, T aspect, T nnear, T nfar) : mWorld(), mMovementSpeed(1), mMouseSensitivity(1), mFov(fovy), mAspect(aspect), mNear(nnear), mFar(nfar), mProjection(), mProjectionInverse(), mMousePosition(glm::tvec2<T, P>(0.0f))
+FPSCamera<T, P>::FPSCamera(T fovy, T aspect, T nnear, T nfar) : mWorld(), mMovementSpeed(1), mMouseSensitivity(1), mFov(fovy), mAspect(aspect), mNear(nnear), mFar(nfar), mProjection(), mProjectionInverse(), mMousePosition(glm::tvec2<T, P>(0.0f)), mUnjitteredProjection(), mJitter(glm::tvec2<T, P>(0.0f))
 {
 	SetProjection(fovy, aspect, nnear, nfar);
 }
@@ -16,10 +16,30 @@ void FPSCamera<T, P>::SetProjection(T fovy, T aspect, T nnear, T nfar)
 	mAspect = aspect;
 	mNear = nnear;
 	mFar = nfar;
-	mProjection = glm::perspective(fovy, aspect, nnear, nfar);
+	mUnjitteredProjection = glm::perspective(fovy, aspect, nnear, nfar);
+	SetJitter(mJitter);
+}
+
+template<typename T, glm::precision P>
+void FPSCamera<T, P>::SetJitter(glm::tvec2<T, P> const& jitter)
+{
+	mJitter = jitter;
+
+	// Clip-space w is -z_view, so the offset is applied through the
+	// coefficients of z_view to end up as a constant offset after the
+	// perspective division.
+	mProjection = mUnjitteredProjection;
+	mProjection[2][0] -= jitter.x;
+	mProjection[2][1] -= jitter.y;
 	mProjectionInverse = glm::inverse(mProjection);
 }
 
+template<typename T, glm::precision P>
+glm::tvec2<T, P> FPSCamera<T, P>::GetJitter()
+{
+	return mJitter;
+}
+
 template<typename T, glm::precision P>
 void FPSCamera<T, P>::SetFov(T fovy)
 {
@@ -114,6 +134,12 @@ glm::tmat4x4<T, P> FPSCamera<T, P>::GetViewToClipMatrix()
 	return mProjection;
 }
 
+template<typename T, glm::precision P>
+glm::tmat4x4<T, P> FPSCamera<T, P>::GetUnjitteredWorldToClipMatrix()
+{
+	return mUnjitteredProjection * GetWorldToViewMatrix();
+}
+
 template<typename T, glm::precision P>
 glm::tvec3<T, P> FPSCamera<T, P>::GetClipToWorld(glm::tvec3<T, P> xyw)
 {
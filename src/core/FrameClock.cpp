@@ -0,0 +1,126 @@
+#include "FrameClock.hpp"
+
+#include "core/Log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+constexpr unsigned int FrameClock::max_steps_per_frame;
+
+FrameClock::Settings FrameClock::ParseSettings(int argc, char const* const argv[])
+{
+	Settings settings;
+	for (int i = 1; i < argc; ++i) {
+		char const* const argument = argv[i];
+		if (std::strcmp(argument, "--offline-time") == 0) {
+			settings.is_offline = true;
+		} else if (std::strncmp(argument, "--simulation-rate=", 18) == 0) {
+			auto const rate = std::strtod(argument + 18, nullptr);
+			if (rate > 0.0 && rate <= 1000000.0)
+				settings.fixed_step = std::chrono::microseconds(static_cast<std::int64_t>(std::round(1000000.0 / rate)));
+			else
+				LogWarning("Invalid simulation rate “%s”: keeping a step of %lld µs.", argument + 18,
+				           static_cast<long long>(settings.fixed_step.count()));
+		}
+	}
+
+	return settings;
+}
+
+FrameClock::FrameClock() : FrameClock(Settings())
+{
+}
+
+FrameClock::FrameClock(Settings const& settings) :
+	mSettings(settings), mLastTime(std::chrono::high_resolution_clock::now())
+{
+}
+
+unsigned int FrameClock::Tick()
+{
+	auto const now = std::chrono::high_resolution_clock::now();
+	if (mSettings.is_offline)
+		mFrameDuration = mSettings.fixed_step;
+	else
+		mFrameDuration = std::min(std::chrono::duration_cast<std::chrono::microseconds>(now - mLastTime), mSettings.max_frame_duration);
+	mLastTime = now;
+
+	mStepsNb = 0u;
+	if (mIsPaused)
+		return mStepsNb;
+
+	// Only whole microseconds are accumulated; the fraction left by the
+	// time scale is carried over rather than truncated away every frame.
+	auto const scaled_duration = std::chrono::duration<double, std::micro>(mFrameDuration) * static_cast<double>(mTimeScale) + mScaledRemainder;
+	auto const whole_scaled_duration = std::chrono::duration_cast<std::chrono::microseconds>(scaled_duration);
+	mScaledRemainder = scaled_duration - whole_scaled_duration;
+	mAccumulator += whole_scaled_duration;
+	auto const steps_nb = static_cast<unsigned int>(mAccumulator / mSettings.fixed_step);
+	if (steps_nb > max_steps_per_frame) {
+		mStepsNb = max_steps_per_frame;
+		mAccumulator %= mSettings.fixed_step;
+	} else {
+		mStepsNb = steps_nb;
+		mAccumulator -= mSettings.fixed_step * steps_nb;
+	}
+	mSimulationTime += mSettings.fixed_step * mStepsNb;
+
+	return mStepsNb;
+}
+
+std::chrono::microseconds FrameClock::GetFrameDuration() const
+{
+	return mFrameDuration;
+}
+
+std::chrono::microseconds FrameClock::GetFixedStep() const
+{
+	return mSettings.fixed_step;
+}
+
+std::chrono::microseconds FrameClock::GetSimulationDelta() const
+{
+	return mSettings.fixed_step * mStepsNb;
+}
+
+std::chrono::microseconds FrameClock::GetSimulationTime() const
+{
+	return mSimulationTime;
+}
+
+float FrameClock::GetInterpolationFactor() const
+{
+	return std::chrono::duration<float>(mAccumulator).count() / std::chrono::duration<float>(mSettings.fixed_step).count();
+}
+
+float FrameClock::GetInterpolatedSimulationTime() const
+{
+	return std::chrono::duration<float>(mSimulationTime + mAccumulator).count();
+}
+
+void FrameClock::SetTimeScale(float time_scale)
+{
+	mTimeScale = std::max(time_scale, 0.0f);
+}
+
+float FrameClock::GetTimeScale() const
+{
+	return mTimeScale;
+}
+
+void FrameClock::SetPaused(bool is_paused)
+{
+	mIsPaused = is_paused;
+}
+
+bool FrameClock::IsPaused() const
+{
+	return mIsPaused;
+}
+
+bool FrameClock::IsOffline() const
+{
+	return mSettings.is_offline;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+//! \brief Clock driving the render loop, which advances the simulation by
+//!        fixed steps independently of the frame rate.
+//!
+//! The time elapsed since the previous frame is scaled, then accumulated;
+//! each whole fixed step contained in the accumulator is consumed by one
+//! simulation update, and the remainder carried over to the next frame.
+//! The rendering can use the interpolation factor to place objects between
+//! the last two simulation states. Long frames, e.g. when the window was
+//! being dragged, are clamped so that they do not trigger an avalanche of
+//! simulation steps.
+//!
+//! In offline mode, each frame lasts exactly one fixed step whatever the
+//! real time elapsed, so that runs (such as benchmarks or input replays)
+//! are deterministic.
+//!
+//! Usage, once per frame:
+//! 1. `Tick()`;
+//! 2. update the simulation once per step returned by `Tick()`, by
+//!    `GetFixedStep()` each time;
+//! 3. render, using `GetInterpolationFactor()` or
+//!    `GetInterpolatedSimulationTime()`.
+class FrameClock
+{
+public:
+	struct Settings {
+		std::chrono::microseconds fixed_step{ 16667 };          //!< 60 Hz
+		std::chrono::microseconds max_frame_duration{ 250000 }; //!< longer frames are clamped
+		bool is_offline{ false };
+	};
+
+	//! \brief Extract the clock settings from the command line.
+	//!
+	//! The recognised arguments are `--simulation-rate=HZ` and
+	//! `--offline-time`; other arguments are ignored.
+	static Settings ParseSettings(int argc, char const* const argv[]);
+
+	FrameClock();
+	explicit FrameClock(Settings const& settings);
+
+	//! \brief Start a new frame.
+	//!
+	//! @return number of fixed simulation steps to run during this frame
+	unsigned int Tick();
+
+	//! \brief Unscaled time since the previous frame, for things which do
+	//!        not belong to the simulation such as the camera; exactly one
+	//!        fixed step in offline mode.
+	std::chrono::microseconds GetFrameDuration() const;
+
+	std::chrono::microseconds GetFixedStep() const;
+
+	//! \brief Simulated time consumed during this frame, i.e. the number
+	//!        of steps returned by `Tick()` times the fixed step.
+	std::chrono::microseconds GetSimulationDelta() const;
+
+	//! \brief Total simulated time, up to the last step consumed.
+	std::chrono::microseconds GetSimulationTime() const;
+
+	//! \brief How far, in [0, 1), the current frame is between the last
+	//!        simulation step and the next one.
+	float GetInterpolationFactor() const;
+
+	//! \brief Simulated time in seconds, interpolated between the last
+	//!        step and the next one; convenient for analytic animations.
+	float GetInterpolatedSimulationTime() const;
+
+	void SetTimeScale(float time_scale);
+	float GetTimeScale() const;
+
+	//! \brief While paused, frames still advance but the simulation does
+	//!        not.
+	void SetPaused(bool is_paused);
+	bool IsPaused() const;
+
+	bool IsOffline() const;
+
+private:
+	// Beyond this, steps are dropped rather than simulated.
+	static constexpr unsigned int max_steps_per_frame = 8u;
+
+	Settings mSettings;
+	std::chrono::high_resolution_clock::time_point mLastTime;
+	std::chrono::microseconds mFrameDuration{ 0 };
+	std::chrono::microseconds mAccumulator{ 0 };
+	std::chrono::duration<double, std::micro> mScaledRemainder{ 0.0 }; //!< below a microsecond
+	std::chrono::microseconds mSimulationTime{ 0 };
+	unsigned int mStepsNb{ 0u };
+	float mTimeScale{ 1.0f };
+	bool mIsPaused{ false };
+};
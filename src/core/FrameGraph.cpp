@@ -0,0 +1,520 @@
+#include "FrameGraph.hpp"
+
+#include "core/GpuMemory.hpp"
+#include "core/Log.h"
+#include "core/opengl.hpp"
+#include "core/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace
+{
+	size_t getTextureBytes(FrameGraph::TextureDescription const& description)
+	{
+		auto const base_bytes = static_cast<size_t>(description.width) * static_cast<size_t>(description.height)
+		                      * GpuMemory::GetBytesPerPixel(description.internal_format);
+		// A full mip chain adds about a third to the base level.
+		return description.has_mipmaps ? base_bytes + base_bytes / 3u : base_bytes;
+	}
+}
+
+constexpr FrameGraph::Handle FrameGraph::invalid_handle;
+constexpr size_t FrameGraph::timing_latency;
+constexpr size_t FrameGraph::clock_calibration_interval;
+
+bool
+FrameGraph::TextureDescription::operator==(TextureDescription const& other) const
+{
+	return width == other.width && height == other.height
+	    && internal_format == other.internal_format
+	    && format == other.format && type == other.type
+	    && has_mipmaps == other.has_mipmaps;
+}
+
+GLuint
+FrameGraph::PassResources::GetTexture(Handle texture) const
+{
+	return mGraph->GetPhysicalTexture(texture);
+}
+
+GLuint
+FrameGraph::PassResources::GetFramebuffer() const
+{
+	return mGraph->mPasses[mPass].framebuffer;
+}
+
+void
+FrameGraph::PassBuilder::Read(Handle texture)
+{
+	assert(texture < mGraph->mTextures.size());
+	mGraph->mPasses[mPass].reads.push_back(texture);
+}
+
+void
+FrameGraph::PassBuilder::Write(Handle texture, GLenum attachment)
+{
+	assert(texture < mGraph->mTextures.size());
+	mGraph->mPasses[mPass].writes.emplace_back(texture, attachment);
+}
+
+void
+FrameGraph::PassBuilder::SetSideEffects()
+{
+	mGraph->mPasses[mPass].has_side_effects = true;
+}
+
+FrameGraph::FrameGraph() = default;
+
+FrameGraph::~FrameGraph()
+{
+	ReleaseResources();
+	for (auto& timing_queries : mTimingQueries) {
+		glDeleteQueries(static_cast<GLsizei>(timing_queries.queries.size()), timing_queries.queries.data());
+		timing_queries.queries.clear();
+	}
+}
+
+void
+FrameGraph::Reset()
+{
+	mTextures.clear();
+	mPasses.clear();
+	mIsCompiled = false;
+}
+
+void
+FrameGraph::ReleaseResources()
+{
+	for (auto const& framebuffer : mFramebuffers)
+		glDeleteFramebuffers(1, &framebuffer.second);
+	mFramebuffers.clear();
+
+	for (auto const& physical_texture : mPhysicalTextures)
+		glDeleteTextures(1, &physical_texture.texture);
+	mPhysicalTextures.clear();
+
+	for (auto& texture : mTextures)
+		texture.physical_texture = SIZE_MAX;
+	for (auto& pass : mPasses)
+		pass.framebuffer = 0u;
+	mIsCompiled = false;
+}
+
+FrameGraph::Handle
+FrameGraph::CreateTexture(std::string const& name, TextureDescription const& description)
+{
+	TextureNode node;
+	node.name = name;
+	node.description = description;
+	mTextures.push_back(node);
+	return mTextures.size() - 1u;
+}
+
+FrameGraph::Handle
+FrameGraph::ImportTexture(std::string const& name, GLuint texture)
+{
+	TextureNode node;
+	node.name = name;
+	node.imported_texture = texture;
+	node.is_imported = true;
+	mTextures.push_back(node);
+	return mTextures.size() - 1u;
+}
+
+void
+FrameGraph::MarkAsOutput(Handle texture)
+{
+	assert(texture < mTextures.size());
+	mTextures[texture].is_output = true;
+}
+
+void
+FrameGraph::AddPass(std::string const& name, SetupFunction const& setup, ExecuteFunction const& execute)
+{
+	PassNode node;
+	node.name = name;
+	node.execute = execute;
+	mPasses.push_back(node);
+
+	PassBuilder builder;
+	builder.mGraph = this;
+	builder.mPass = mPasses.size() - 1u;
+	setup(builder);
+}
+
+void
+FrameGraph::Compile()
+{
+	PROFILE_FUNCTION();
+	CullPasses();
+	AssignPhysicalTextures();
+	AssignFramebuffers();
+
+	mPassReports.clear();
+	mPassReports.reserve(mPasses.size());
+	for (auto const& pass : mPasses) {
+		PassReport report;
+		report.name = pass.name;
+		report.is_culled = pass.is_culled;
+		report.gpu_time_ms = GetPassGpuTime(pass.name);
+		mPassReports.push_back(report);
+	}
+
+	mIsCompiled = true;
+}
+
+void
+FrameGraph::Execute()
+{
+	PROFILE_FUNCTION();
+	assert(mIsCompiled);
+
+	ReadBackTimings();
+	if (!mIsClockCalibrated || mFrameIndex % clock_calibration_interval == 0u)
+		CalibrateClocks();
+
+	auto& timing_queries = mTimingQueries[mFrameIndex % timing_latency];
+	timing_queries.pass_names.clear();
+	timing_queries.gpu_to_cpu_offset = mGpuToCpuOffset;
+	size_t query_index = 0u;
+
+	PassResources resources;
+	resources.mGraph = this;
+	for (size_t i = 0; i < mPasses.size(); ++i) {
+		auto const& pass = mPasses[i];
+		if (pass.is_culled)
+			continue;
+		PROFILE_SCOPE_DYNAMIC(pass.name);
+
+		if (query_index + 2u > timing_queries.queries.size()) {
+			auto const previous_size = timing_queries.queries.size();
+			timing_queries.queries.resize(query_index + 2u, 0u);
+			glGenQueries(static_cast<GLsizei>(timing_queries.queries.size() - previous_size), timing_queries.queries.data() + previous_size);
+		}
+
+		utils::opengl::debug::beginDebugGroup(pass.name);
+		glQueryCounter(timing_queries.queries[query_index++], GL_TIMESTAMP);
+
+		if (pass.framebuffer != 0u)
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, pass.framebuffer);
+		resources.mPass = i;
+		pass.execute(resources);
+
+		glQueryCounter(timing_queries.queries[query_index++], GL_TIMESTAMP);
+		utils::opengl::debug::endDebugGroup();
+
+		timing_queries.pass_names.push_back(pass.name);
+	}
+	timing_queries.is_pending = true;
+
+	++mFrameIndex;
+}
+
+GLuint
+FrameGraph::GetTexture(Handle texture) const
+{
+	return GetPhysicalTexture(texture);
+}
+
+std::vector<FrameGraph::PassReport> const&
+FrameGraph::GetPassReports() const
+{
+	return mPassReports;
+}
+
+FrameGraph::MemoryReport const&
+FrameGraph::GetMemoryReport() const
+{
+	return mMemoryReport;
+}
+
+float
+FrameGraph::GetPassGpuTime(std::string const& name) const
+{
+	auto const gpu_time = mPassGpuTimes.find(name);
+	return gpu_time != mPassGpuTimes.end() ? gpu_time->second : 0.0f;
+}
+
+FrameGraph::FrameGpuTimes const&
+FrameGraph::GetLatestFrameGpuTimes() const
+{
+	return mLatestFrameGpuTimes;
+}
+
+size_t
+FrameGraph::GetExecutedFramesNb() const
+{
+	return mFrameIndex;
+}
+
+void
+FrameGraph::CullPasses()
+{
+	// Walk the passes backwards: a pass is needed if it writes to a
+	// texture needed by a later pass, in which case all the textures it
+	// reads from are needed as well. Writes are assumed to only partially
+	// overwrite their targets, so all writers of a needed texture are kept.
+	std::vector<bool> is_texture_needed(mTextures.size(), false);
+	for (size_t t = 0; t < mTextures.size(); ++t)
+		is_texture_needed[t] = mTextures[t].is_imported || mTextures[t].is_output;
+
+	for (auto pass = mPasses.rbegin(); pass != mPasses.rend(); ++pass) {
+		bool is_needed = pass->has_side_effects;
+		for (auto const& write : pass->writes)
+			is_needed = is_needed || is_texture_needed[write.first];
+
+		pass->is_culled = !is_needed;
+		if (!is_needed)
+			continue;
+
+		for (auto const read : pass->reads)
+			is_texture_needed[read] = true;
+		for (auto const& write : pass->writes)
+			is_texture_needed[write.first] = true;
+	}
+
+	for (size_t i = 0; i < mPasses.size(); ++i) {
+		auto const& pass = mPasses[i];
+		if (pass.is_culled)
+			continue;
+
+		auto const extend_lifetime = [this, i](Handle texture){
+			auto& node = mTextures[texture];
+			node.first_use = std::min(node.first_use, i);
+			node.last_use = std::max(node.last_use, i);
+		};
+		for (auto const read : pass.reads)
+			extend_lifetime(read);
+		for (auto const& write : pass.writes)
+			extend_lifetime(write.first);
+	}
+}
+
+void
+FrameGraph::AssignPhysicalTextures()
+{
+	for (auto& physical_texture : mPhysicalTextures) {
+		physical_texture.available_from = 0u;
+		physical_texture.is_used = false;
+	}
+
+	std::vector<Handle> transient_textures;
+	for (Handle t = 0; t < mTextures.size(); ++t)
+		if (!mTextures[t].is_imported && mTextures[t].first_use != SIZE_MAX)
+			transient_textures.push_back(t);
+	std::stable_sort(transient_textures.begin(), transient_textures.end(), [this](Handle lhs, Handle rhs){
+		return mTextures[lhs].first_use < mTextures[rhs].first_use;
+	});
+
+	mMemoryReport = MemoryReport();
+	mMemoryReport.transient_textures_nb = transient_textures.size();
+	for (auto const t : transient_textures) {
+		auto& node = mTextures[t];
+		mMemoryReport.transient_bytes += getTextureBytes(node.description);
+
+		// A physical texture can only be shared by textures used in
+		// different passes: a pass reading from one texture and writing
+		// to another cannot have both backed by the same storage.
+		auto physical_texture = std::find_if(mPhysicalTextures.begin(), mPhysicalTextures.end(), [&node](PhysicalTexture const& candidate){
+			return candidate.description == node.description && candidate.available_from <= node.first_use;
+		});
+		if (physical_texture == mPhysicalTextures.end()) {
+			GpuMemory::OwnerScope owner("Frame graph");
+			PhysicalTexture new_texture;
+			new_texture.description = node.description;
+			glGenTextures(1, &new_texture.texture);
+			glBindTexture(GL_TEXTURE_2D, new_texture.texture);
+			GLint level = 0;
+			for (auto width = node.description.width, height = node.description.height; ;
+			     width = std::max(width / 2, 1), height = std::max(height / 2, 1), ++level) {
+				glTexImage2D(GL_TEXTURE_2D, level, node.description.internal_format, width, height, 0,
+				             node.description.format, node.description.type, nullptr);
+				if (!node.description.has_mipmaps || (width == 1 && height == 1))
+					break;
+			}
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level);
+			glBindTexture(GL_TEXTURE_2D, 0u);
+			utils::opengl::debug::nameObject(GL_TEXTURE, new_texture.texture, "Frame graph: " + node.name);
+
+			mPhysicalTextures.push_back(new_texture);
+			physical_texture = std::prev(mPhysicalTextures.end());
+		}
+
+		physical_texture->available_from = node.is_output ? SIZE_MAX : node.last_use + 1u;
+		physical_texture->is_used = true;
+		node.physical_texture = static_cast<size_t>(physical_texture - mPhysicalTextures.begin());
+	}
+
+	// Release the physical textures which were not needed this frame,
+	// along with the framebuffer objects they were attached to.
+	std::vector<GLuint> released_textures;
+	for (auto const& physical_texture : mPhysicalTextures)
+		if (!physical_texture.is_used)
+			released_textures.push_back(physical_texture.texture);
+	if (released_textures.empty()) {
+		for (auto const& physical_texture : mPhysicalTextures)
+			mMemoryReport.physical_bytes += getTextureBytes(physical_texture.description);
+		mMemoryReport.physical_textures_nb = mPhysicalTextures.size();
+		return;
+	}
+
+	for (auto framebuffer = mFramebuffers.begin(); framebuffer != mFramebuffers.end();) {
+		bool const uses_released_texture = std::any_of(framebuffer->first.begin(), framebuffer->first.end(), [&released_textures](std::pair<GLenum, GLuint> const& attachment){
+			return std::find(released_textures.begin(), released_textures.end(), attachment.second) != released_textures.end();
+		});
+		if (uses_released_texture) {
+			glDeleteFramebuffers(1, &framebuffer->second);
+			framebuffer = mFramebuffers.erase(framebuffer);
+		} else {
+			++framebuffer;
+		}
+	}
+	glDeleteTextures(static_cast<GLsizei>(released_textures.size()), released_textures.data());
+
+	// Compact the pool, and remap the textures pointing into it.
+	std::vector<size_t> remapping(mPhysicalTextures.size(), SIZE_MAX);
+	std::vector<PhysicalTexture> kept_textures;
+	for (size_t p = 0; p < mPhysicalTextures.size(); ++p) {
+		if (!mPhysicalTextures[p].is_used)
+			continue;
+		remapping[p] = kept_textures.size();
+		kept_textures.push_back(mPhysicalTextures[p]);
+	}
+	mPhysicalTextures.swap(kept_textures);
+	for (auto& node : mTextures)
+		if (node.physical_texture != SIZE_MAX)
+			node.physical_texture = remapping[node.physical_texture];
+
+	for (auto const& physical_texture : mPhysicalTextures)
+		mMemoryReport.physical_bytes += getTextureBytes(physical_texture.description);
+	mMemoryReport.physical_textures_nb = mPhysicalTextures.size();
+}
+
+void
+FrameGraph::AssignFramebuffers()
+{
+	for (auto& pass : mPasses) {
+		pass.framebuffer = 0u;
+		if (pass.is_culled || pass.writes.empty())
+			continue;
+
+		FramebufferKey key;
+		key.reserve(pass.writes.size());
+		for (auto const& write : pass.writes)
+			key.emplace_back(write.second, GetPhysicalTexture(write.first));
+		std::sort(key.begin(), key.end());
+
+		auto const cached_framebuffer = mFramebuffers.find(key);
+		if (cached_framebuffer != mFramebuffers.end()) {
+			pass.framebuffer = cached_framebuffer->second;
+			continue;
+		}
+
+		// Only the draw binding is touched, so that the framebuffer bound
+		// for reading by the application stays as is.
+		GLuint framebuffer = 0u;
+		glGenFramebuffers(1, &framebuffer);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+
+		std::vector<GLenum> draw_buffers;
+		for (auto const& attachment : key) {
+			glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, attachment.first, GL_TEXTURE_2D, attachment.second, 0);
+
+			if (attachment.first < GL_COLOR_ATTACHMENT0 || attachment.first > GL_COLOR_ATTACHMENT15)
+				continue;
+			// Map the fragment shader output at location i to colour
+			// attachment i, leaving gaps for the missing attachments.
+			auto const index = static_cast<size_t>(attachment.first - GL_COLOR_ATTACHMENT0);
+			if (draw_buffers.size() <= index)
+				draw_buffers.resize(index + 1u, GL_NONE);
+			draw_buffers[index] = attachment.first;
+		}
+		if (draw_buffers.empty())
+			glDrawBuffer(GL_NONE);
+		else
+			glDrawBuffers(static_cast<GLsizei>(draw_buffers.size()), draw_buffers.data());
+
+		if (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			LogError("Framebuffer of pass \"%s\" is not complete: check the logs for additional information.", pass.name.c_str());
+		utils::opengl::debug::nameObject(GL_FRAMEBUFFER, framebuffer, "Frame graph: " + pass.name);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0u);
+
+		mFramebuffers.emplace(key, framebuffer);
+		pass.framebuffer = framebuffer;
+	}
+}
+
+void
+FrameGraph::ReadBackTimings()
+{
+	// The queries about to be reused were issued `timing_latency` frames
+	// ago; if the GPU is lagging even further behind, skip that frame's
+	// timings rather than waiting for them.
+	auto& timing_queries = mTimingQueries[mFrameIndex % timing_latency];
+	if (!timing_queries.is_pending)
+		return;
+	timing_queries.is_pending = false;
+
+	auto const queries_nb = timing_queries.pass_names.size() * 2u;
+	if (queries_nb == 0u)
+		return;
+
+	GLuint is_available = GL_FALSE;
+	glGetQueryObjectuiv(timing_queries.queries[queries_nb - 1u], GL_QUERY_RESULT_AVAILABLE, &is_available);
+	if (is_available == GL_FALSE)
+		return;
+
+	mPassGpuTimes.clear();
+	mLatestFrameGpuTimes.is_valid = true;
+	mLatestFrameGpuTimes.frame_index = mFrameIndex - timing_latency;
+	mLatestFrameGpuTimes.pass_times_ms.clear();
+	std::vector<GLuint64> timestamps(queries_nb, 0u);
+	for (size_t i = 0; i < timing_queries.pass_names.size(); ++i) {
+		auto const begin = timestamps.data() + 2u * i;
+		auto const end = begin + 1u;
+		glGetQueryObjectui64v(timing_queries.queries[2u * i], GL_QUERY_RESULT, begin);
+		glGetQueryObjectui64v(timing_queries.queries[2u * i + 1u], GL_QUERY_RESULT, end);
+		auto const gpu_time_ms = static_cast<float>(*end - *begin) / 1000000.0f;
+		mPassGpuTimes[timing_queries.pass_names[i]] = gpu_time_ms;
+		mLatestFrameGpuTimes.pass_times_ms.emplace_back(timing_queries.pass_names[i], gpu_time_ms);
+	}
+
+#if defined ENABLE_PROFILING && ENABLE_PROFILING != 0
+	// The passes are nested under a span covering the whole frame graph;
+	// both are written in increasing order of end times.
+	auto const to_cpu_time = [&timing_queries](GLuint64 timestamp){
+		return static_cast<std::int64_t>(timestamp) + timing_queries.gpu_to_cpu_offset;
+	};
+	for (size_t i = 0; i < timing_queries.pass_names.size(); ++i)
+		Profiler::AddGpuScope(Profiler::InternName(timing_queries.pass_names[i]),
+		                      to_cpu_time(timestamps[2u * i]), to_cpu_time(timestamps[2u * i + 1u]), 1u);
+	Profiler::AddGpuScope("Frame graph", to_cpu_time(timestamps.front()), to_cpu_time(timestamps.back()), 0u);
+#endif
+}
+
+void
+FrameGraph::CalibrateClocks()
+{
+#if defined ENABLE_PROFILING && ENABLE_PROFILING != 0
+	// Reading the GPU time does not wait for the GPU to be idle, only for
+	// the driver; the CPU time is taken on both sides of that wait.
+	auto const cpu_time_before = Profiler::GetTime();
+	GLint64 gpu_time = 0;
+	glGetInteger64v(GL_TIMESTAMP, &gpu_time);
+	auto const cpu_time_after = Profiler::GetTime();
+	mGpuToCpuOffset = cpu_time_before + (cpu_time_after - cpu_time_before) / 2 - static_cast<std::int64_t>(gpu_time);
+#endif
+	mIsClockCalibrated = true;
+}
+
+GLuint
+FrameGraph::GetPhysicalTexture(Handle texture) const
+{
+	assert(texture < mTextures.size());
+	auto const& node = mTextures[texture];
+	if (node.is_imported)
+		return node.imported_texture;
+	return node.physical_texture != SIZE_MAX ? mPhysicalTextures[node.physical_texture].texture : 0u;
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! \brief Declarative description of the render passes of a frame.
+//!
+//! Every frame, the passes are declared along with the textures they read
+//! from and write to; the graph then:
+//! 1. culls the passes whose results are never used, i.e. which do not
+//!    contribute to an imported texture, a texture marked as output, or
+//!    which are not flagged as having side effects;
+//! 2. computes the lifetime of each transient texture, and assigns it a
+//!    physical texture from a pool; transient textures with the same
+//!    description and non-overlapping lifetimes share the same physical
+//!    texture;
+//! 3. creates (and caches) the framebuffer objects needed by each pass;
+//! 4. runs the remaining passes in declaration order, each within its own
+//!    debug group, and measures their GPU time with timestamp queries;
+//!    when profiling is enabled, those are also converted to the CPU
+//!    clock and added to the profiler's timeline.
+//!
+//! Passes can only read textures declared before them, so the declaration
+//! order is always a valid execution order.
+//!
+//! Usage, once per frame:
+//! 1. `Reset()`;
+//! 2. `CreateTexture()` or `ImportTexture()` all textures, and
+//!    `AddPass()` all passes;
+//! 3. `Compile()`, then `Execute()`;
+//! 4. `GetTexture()` can be used to access the textures marked as outputs
+//!    until the next call to `Reset()`.
+class FrameGraph
+{
+public:
+	using Handle = size_t;
+	static constexpr Handle invalid_handle = SIZE_MAX;
+
+	//! \brief Number of frames after which the timestamp queries of a
+	//!        frame are read back, so that reading them does not stall.
+	static constexpr size_t timing_latency = 3u;
+
+	//! \brief Number of frames between two measurements of the offset
+	//!        between the GPU and CPU clocks, to follow their drift.
+	static constexpr size_t clock_calibration_interval = 64u;
+
+	struct TextureDescription {
+		GLsizei width{ 0 };
+		GLsizei height{ 0 };
+		GLint internal_format{ GL_RGBA8 };
+		GLenum format{ GL_RGBA };   //!< only used for allocating the storage
+		GLenum type{ GL_UNSIGNED_BYTE }; //!< only used for allocating the storage
+		bool has_mipmaps{ false }; //!< allocate the full mip chain, e.g. for glGenerateMipmap()
+
+		bool operator==(TextureDescription const& other) const;
+	};
+
+	//! \brief Resources available to a pass while it is executed.
+	class PassResources {
+	public:
+		//! \brief Physical texture backing a texture read or written by
+		//!        the pass.
+		GLuint GetTexture(Handle texture) const;
+
+		//! \brief Framebuffer object with all the textures written by the
+		//!        pass attached, or 0 if the pass has no attachment; it is
+		//!        already bound to GL_DRAW_FRAMEBUFFER.
+		GLuint GetFramebuffer() const;
+
+	private:
+		friend class FrameGraph;
+		FrameGraph const* mGraph{ nullptr };
+		size_t mPass{ 0u };
+	};
+
+	//! \brief Interface given to the setup function of a pass, for
+	//!        declaring its dependencies.
+	class PassBuilder {
+	public:
+		//! \brief Declare that the pass samples from a texture.
+		void Read(Handle texture);
+
+		//! \brief Declare that the pass renders into a texture.
+		//!
+		//! @param [in] texture texture to render into
+		//! @param [in] attachment attachment point of the texture in the
+		//!             framebuffer object of the pass, e.g.
+		//!             GL_COLOR_ATTACHMENT1 or GL_DEPTH_STENCIL_ATTACHMENT;
+		//!             colour attachment i is mapped to the fragment
+		//!             shader output at location i.
+		void Write(Handle texture, GLenum attachment);
+
+		//! \brief Keep the pass even if none of the textures it writes to
+		//!        are used afterwards.
+		void SetSideEffects();
+
+	private:
+		friend class FrameGraph;
+		FrameGraph* mGraph{ nullptr };
+		size_t mPass{ 0u };
+	};
+
+	using SetupFunction = std::function<void (PassBuilder&)>;
+	using ExecuteFunction = std::function<void (PassResources const&)>;
+
+	//! \brief Report about a pass of the latest compiled frame.
+	struct PassReport {
+		std::string name;
+		bool is_culled{ false };
+		float gpu_time_ms{ 0.0f }; //!< latest measurement available, 0 if none
+	};
+
+	//! \brief Memory taken by the transient textures of the latest
+	//!        compiled frame.
+	struct MemoryReport {
+		size_t transient_textures_nb{ 0u };
+		size_t physical_textures_nb{ 0u };
+		size_t transient_bytes{ 0u }; //!< had each transient texture been allocated separately
+		size_t physical_bytes{ 0u };  //!< actually allocated
+	};
+
+	//! \brief GPU times of all passes run during a single frame.
+	struct FrameGpuTimes {
+		bool is_valid{ false };
+		size_t frame_index{ 0u }; //!< frame the times belong to, counted in calls to `Execute()`
+		std::vector<std::pair<std::string, float>> pass_times_ms; //!< in execution order
+	};
+
+	FrameGraph();
+	~FrameGraph();
+
+	FrameGraph(FrameGraph const&) = delete;
+	FrameGraph& operator=(FrameGraph const&) = delete;
+
+	//! \brief Forget all textures and passes declared for the previous
+	//!        frame; the physical textures and framebuffer objects are
+	//!        kept around for reuse.
+	void Reset();
+
+	//! \brief Release all physical textures and framebuffer objects.
+	//!
+	//! This has to be called whenever an imported texture is deleted, as
+	//! the cached framebuffer objects might still reference it.
+	void ReleaseResources();
+
+	//! \brief Declare a texture whose storage is managed by the graph.
+	Handle CreateTexture(std::string const& name, TextureDescription const& description);
+
+	//! \brief Declare a texture managed outside of the graph; passes
+	//!        writing to it are never culled, and it is never aliased.
+	Handle ImportTexture(std::string const& name, GLuint texture);
+
+	//! \brief Keep a transient texture alive until the end of the frame,
+	//!        so that it can be accessed after `Execute()`.
+	void MarkAsOutput(Handle texture);
+
+	//! \brief Declare a pass.
+	//!
+	//! @param [in] name name of the pass, used for the debug group and
+	//!             the timings; it should be unique within a frame.
+	//! @param [in] setup called immediately, to declare the textures the
+	//!             pass reads from and writes to
+	//! @param [in] execute called by `Execute()` unless the pass got
+	//!             culled, to issue the commands of the pass
+	void AddPass(std::string const& name, SetupFunction const& setup, ExecuteFunction const& execute);
+
+	//! \brief Cull the unused passes, and assign the physical textures
+	//!        and framebuffer objects.
+	void Compile();
+
+	//! \brief Run all passes which were not culled.
+	void Execute();
+
+	//! \brief Physical texture backing a texture, or 0 if the texture
+	//!        was not used by any pass.
+	GLuint GetTexture(Handle texture) const;
+
+	std::vector<PassReport> const& GetPassReports() const;
+	MemoryReport const& GetMemoryReport() const;
+
+	//! \brief Latest GPU time measured for a pass, in milliseconds; 0 if
+	//!        the pass has not been run in the last frames.
+	float GetPassGpuTime(std::string const& name) const;
+
+	//! \brief GPU times of the latest frame whose timings were read
+	//!        back, usually `timing_latency` frames ago; frames whose
+	//!        timings were not ready in time are skipped.
+	FrameGpuTimes const& GetLatestFrameGpuTimes() const;
+
+	//! \brief Number of calls to `Execute()` so far.
+	size_t GetExecutedFramesNb() const;
+
+private:
+	struct TextureNode {
+		std::string name;
+		TextureDescription description;
+		GLuint imported_texture{ 0u };
+		bool is_imported{ false };
+		bool is_output{ false };
+		size_t first_use{ SIZE_MAX }; //!< index of the first pass using it, after culling
+		size_t last_use{ 0u };        //!< index of the last pass using it, after culling
+		size_t physical_texture{ SIZE_MAX };
+	};
+
+	struct PassNode {
+		std::string name;
+		ExecuteFunction execute;
+		std::vector<Handle> reads;
+		std::vector<std::pair<Handle, GLenum>> writes;
+		bool has_side_effects{ false };
+		bool is_culled{ false };
+		GLuint framebuffer{ 0u };
+	};
+
+	struct PhysicalTexture {
+		GLuint texture{ 0u };
+		TextureDescription description;
+		size_t available_from{ 0u }; //!< first pass index at which it can be reused, this frame
+		bool is_used{ false };       //!< whether any transient texture was assigned to it, this frame
+	};
+
+	// Attachment points and physical textures of a framebuffer object.
+	using FramebufferKey = std::vector<std::pair<GLenum, GLuint>>;
+
+	struct TimingQueries {
+		std::vector<std::string> pass_names;
+		std::vector<GLuint> queries; //!< two timestamps per pass
+		std::int64_t gpu_to_cpu_offset{ 0 }; //!< in ns, when the queries were issued
+		bool is_pending{ false };
+	};
+
+	void CullPasses();
+	void AssignPhysicalTextures();
+	void AssignFramebuffers();
+	void ReadBackTimings();
+	void CalibrateClocks();
+	GLuint GetPhysicalTexture(Handle texture) const;
+
+	std::vector<TextureNode> mTextures;
+	std::vector<PassNode> mPasses;
+	bool mIsCompiled{ false };
+
+	std::vector<PhysicalTexture> mPhysicalTextures;
+	std::map<FramebufferKey, GLuint> mFramebuffers;
+
+	std::array<TimingQueries, timing_latency> mTimingQueries;
+	size_t mFrameIndex{ 0u };
+	std::map<std::string, float> mPassGpuTimes;
+	FrameGpuTimes mLatestFrameGpuTimes;
+	std::int64_t mGpuToCpuOffset{ 0 };
+	bool mIsClockCalibrated{ false };
+
+	std::vector<PassReport> mPassReports;
+	MemoryReport mMemoryReport;
+};
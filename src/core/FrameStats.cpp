@@ -0,0 +1,206 @@
+#include "FrameStats.hpp"
+
+#include "core/Log.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+
+constexpr size_t FrameStats::history_size;
+constexpr size_t FrameStats::summary_interval;
+
+namespace
+{
+	// Percentiles use the nearest-rank method, as in the benchmarks.
+	float getPercentile(std::vector<float> const& sorted_values, float percentile)
+	{
+		auto const rank = static_cast<size_t>(std::ceil(percentile / 100.0f * static_cast<float>(sorted_values.size())));
+		return sorted_values[std::min(std::max(rank, static_cast<size_t>(1u)), sorted_values.size()) - 1u];
+	}
+
+	// Mean of the slowest `fraction` of the frames, and at least of the
+	// slowest one.
+	float getLow(std::vector<float> const& sorted_values, float fraction)
+	{
+		auto const count = std::max(static_cast<size_t>(static_cast<float>(sorted_values.size()) * fraction), static_cast<size_t>(1u));
+		auto const sum = std::accumulate(sorted_values.end() - static_cast<std::ptrdiff_t>(count), sorted_values.end(), 0.0);
+		return static_cast<float>(sum / static_cast<double>(count));
+	}
+
+	FrameStats::Summary summarise(std::vector<float> values, float budget_ms)
+	{
+		FrameStats::Summary summary;
+		if (values.empty())
+			return summary;
+
+		std::sort(values.begin(), values.end());
+		summary.p50_ms = getPercentile(values, 50.0f);
+		summary.p95_ms = getPercentile(values, 95.0f);
+		summary.p99_ms = getPercentile(values, 99.0f);
+		summary.low_1_percent_ms = getLow(values, 0.01f);
+		summary.low_0_1_percent_ms = getLow(values, 0.001f);
+		summary.max_ms = values.back();
+		summary.over_budget_nb = static_cast<size_t>(values.end() - std::upper_bound(values.begin(), values.end(), budget_ms));
+		return summary;
+	}
+
+	float toFps(float ms)
+	{
+		return ms > 0.0f ? 1000.0f / ms : 0.0f;
+	}
+}
+
+FrameStats::Settings FrameStats::ParseSettings(int argc, char const* const argv[])
+{
+	Settings settings;
+	for (int i = 1; i < argc; ++i) {
+		char const* const argument = argv[i];
+		if (std::strncmp(argument, "--frame-budget=", 15) == 0) {
+			auto const budget_ms = std::strtod(argument + 15, nullptr);
+			if (budget_ms > 0.0 && budget_ms <= 10000.0)
+				settings.budget = std::chrono::microseconds(static_cast<std::int64_t>(std::round(budget_ms * 1000.0)));
+			else
+				LogWarning("Invalid frame budget “%s”: keeping %.3f ms.", argument + 15,
+				           static_cast<double>(settings.budget.count()) / 1000.0);
+		}
+	}
+
+	return settings;
+}
+
+FrameStats::FrameStats() : FrameStats(Settings())
+{
+}
+
+FrameStats::FrameStats(Settings const& settings) : mSettings(settings), mCpuTimesMs(history_size, 0.0f), mPresentIntervalsMs(history_size, 0.0f)
+{
+}
+
+void FrameStats::AddFrame(std::chrono::nanoseconds cpu_time, std::chrono::nanoseconds present_interval)
+{
+	auto const present_interval_ms = std::chrono::duration<float, std::milli>(present_interval).count();
+	mCpuTimesMs[mNextIndex] = std::chrono::duration<float, std::milli>(cpu_time).count();
+	mPresentIntervalsMs[mNextIndex] = present_interval_ms;
+	mNextIndex = (mNextIndex + 1u) % history_size;
+	mFramesNb = std::min(mFramesNb + 1u, history_size);
+
+	if (present_interval > mSettings.budget)
+		++mStuttersNb;
+
+	if (++mFramesSinceSummaryNb >= summary_interval)
+		UpdateSummaries();
+}
+
+void FrameStats::Reset()
+{
+	mNextIndex = 0u;
+	mFramesNb = 0u;
+	mStuttersNb = 0u;
+	UpdateSummaries();
+}
+
+size_t FrameStats::GetFramesNb() const noexcept
+{
+	return mFramesNb;
+}
+
+std::uint64_t FrameStats::GetStuttersNb() const noexcept
+{
+	return mStuttersNb;
+}
+
+FrameStats::Summary const& FrameStats::GetCpuSummary() const noexcept
+{
+	return mCpuSummary;
+}
+
+FrameStats::Summary const& FrameStats::GetPresentSummary() const noexcept
+{
+	return mPresentSummary;
+}
+
+std::chrono::microseconds FrameStats::GetBudget() const noexcept
+{
+	return mSettings.budget;
+}
+
+void FrameStats::SetBudget(std::chrono::microseconds budget)
+{
+	mSettings.budget = budget;
+	UpdateSummaries();
+}
+
+void FrameStats::UpdateSummaries()
+{
+	mFramesSinceSummaryNb = 0u;
+
+	// Until the history is full, its valid frames are at the start.
+	auto const budget_ms = std::chrono::duration<float, std::milli>(mSettings.budget).count();
+	auto const frames_end = static_cast<std::ptrdiff_t>(mFramesNb);
+	mCpuSummary = summarise(std::vector<float>(mCpuTimesMs.begin(), mCpuTimesMs.begin() + frames_end), budget_ms);
+	mPresentSummary = summarise(std::vector<float>(mPresentIntervalsMs.begin(), mPresentIntervalsMs.begin() + frames_end), budget_ms);
+}
+
+void FrameStats::RenderWindow()
+{
+	ImGui::SetNextWindowCollapsed(true, ImGuiCond_FirstUseEver);
+	bool const opened = ImGui::Begin("Frame pacing", nullptr, ImGuiWindowFlags_None);
+	if (!opened) {
+		ImGui::End();
+		return;
+	}
+
+	auto const show_summary = [](char const* label, Summary const& summary){
+		ImGui::Text("%s: p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms", label,
+		            summary.p50_ms, summary.p95_ms, summary.p99_ms, summary.max_ms);
+		ImGui::Text("    1%% low %.2f ms (%.0f fps)  0.1%% low %.2f ms (%.0f fps)",
+		            summary.low_1_percent_ms, toFps(summary.low_1_percent_ms),
+		            summary.low_0_1_percent_ms, toFps(summary.low_0_1_percent_ms));
+	};
+	show_summary("Present interval", mPresentSummary);
+	show_summary("CPU frame time", mCpuSummary);
+	ImGui::Text("Stutters: %llu since reset, %zu in the last %zu frames",
+	            static_cast<unsigned long long>(mStuttersNb), mPresentSummary.over_budget_nb, mFramesNb);
+
+	auto budget_ms = std::chrono::duration<float, std::milli>(mSettings.budget).count();
+	if (ImGui::SliderFloat("Budget (ms)", &budget_ms, 1.0f, 100.0f, "%.2f"))
+		SetBudget(std::chrono::microseconds(static_cast<std::int64_t>(std::round(budget_ms * 1000.0f))));
+	ImGui::SameLine();
+	if (ImGui::Button("Reset"))
+		Reset();
+
+	// Both series, newest on the right, with the budget as a red line;
+	// the scale leaves room for hitches of twice the budget.
+	auto const size = ImVec2(std::max(ImGui::GetContentRegionAvail().x, 1.0f), 100.0f);
+	auto const origin = ImGui::GetCursorScreenPos();
+	auto* const draw_list = ImGui::GetWindowDrawList();
+	draw_list->AddRectFilled(origin, ImVec2(origin.x + size.x, origin.y + size.y), IM_COL32(20, 20, 20, 255));
+	auto const scale_ms = std::max(2.0f * budget_ms, 1.0f);
+	auto const to_y = [&origin, &size, scale_ms](float ms){
+		return origin.y + size.y * (1.0f - std::min(ms / scale_ms, 1.0f));
+	};
+	auto const displayed_frames_nb = std::min(mFramesNb, static_cast<size_t>(size.x));
+	auto const draw_series = [&](std::vector<float> const& series, ImU32 color){
+		for (size_t i = 1u; i < displayed_frames_nb; ++i) {
+			auto const previous = (mNextIndex + history_size - displayed_frames_nb + i - 1u) % history_size;
+			auto const current = (previous + 1u) % history_size;
+			auto const x = origin.x + size.x - static_cast<float>(displayed_frames_nb - i);
+			draw_list->AddLine(ImVec2(x - 1.0f, to_y(series[previous])), ImVec2(x, to_y(series[current])), color);
+		}
+	};
+	draw_series(mCpuTimesMs, IM_COL32(255, 160, 0, 255));
+	draw_series(mPresentIntervalsMs, IM_COL32(220, 220, 220, 255));
+	draw_list->AddLine(ImVec2(origin.x, to_y(budget_ms)), ImVec2(origin.x + size.x, to_y(budget_ms)), IM_COL32(255, 60, 60, 255));
+	ImGui::Dummy(size);
+	ImGui::TextColored(ImVec4(0.86f, 0.86f, 0.86f, 1.0f), "Present interval");
+	ImGui::SameLine();
+	ImGui::TextColored(ImVec4(1.0f, 0.63f, 0.0f, 1.0f), "CPU frame time");
+	ImGui::SameLine();
+	ImGui::TextColored(ImVec4(1.0f, 0.24f, 0.24f, 1.0f), "Budget");
+
+	ImGui::End();
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//! \brief Frame pacing statistics over the last frames.
+//!
+//! Two series are kept in ring buffers: the present interval, i.e. the
+//! time between two consecutive presents, and the CPU frame time, i.e.
+//! the part of that interval the CPU was not waiting for the swap. An
+//! average hides single hitches, such as a shader reload or a blocking
+//! query read back, so both series are summarised with percentiles and
+//! lows, the latter being the mean of the slowest frames.
+//!
+//! A stutter is a frame whose present interval exceeds the budget.
+class FrameStats
+{
+public:
+	struct Settings {
+		//! Leaves some slack over 60 Hz, so that vsync jitter does not
+		//! count as stutters while missing a vertical blank does.
+		std::chrono::microseconds budget{ 20000 };
+	};
+
+	//! \brief Extract the frame statistics settings from the command line.
+	//!
+	//! The recognised argument is `--frame-budget=MS`; other arguments are
+	//! ignored.
+	static Settings ParseSettings(int argc, char const* const argv[]);
+
+	struct Summary {
+		float p50_ms{ 0.0f };
+		float p95_ms{ 0.0f };
+		float p99_ms{ 0.0f };
+		float low_1_percent_ms{ 0.0f };   //!< mean of the slowest 1% of frames
+		float low_0_1_percent_ms{ 0.0f }; //!< mean of the slowest 0.1% of frames
+		float max_ms{ 0.0f };
+		size_t over_budget_nb{ 0u };
+	};
+
+	//! \brief Number of frames kept; over a minute at 60 Hz.
+	static constexpr size_t history_size = 4096u;
+
+	//! \brief Number of frames between two updates of the summaries, which
+	//!        require sorting the whole history.
+	static constexpr size_t summary_interval = 16u;
+
+	FrameStats();
+	explicit FrameStats(Settings const& settings);
+
+	//! \brief Record a presented frame.
+	//!
+	//! @param [in] cpu_time time the CPU spent on the frame, excluding the
+	//!             wait for the swap
+	//! @param [in] present_interval time since the previous present
+	void AddFrame(std::chrono::nanoseconds cpu_time, std::chrono::nanoseconds present_interval);
+
+	//! \brief Forget all frames and stutters recorded so far.
+	void Reset();
+
+	//! \brief Number of frames in the history.
+	size_t GetFramesNb() const noexcept;
+
+	//! \brief Number of stutters since the last reset.
+	std::uint64_t GetStuttersNb() const noexcept;
+
+	Summary const& GetCpuSummary() const noexcept;
+	Summary const& GetPresentSummary() const noexcept;
+
+	std::chrono::microseconds GetBudget() const noexcept;
+	void SetBudget(std::chrono::microseconds budget);
+
+	//! \brief Display the summaries, along with a graph of both series
+	//!        against the budget.
+	void RenderWindow();
+
+private:
+	void UpdateSummaries();
+
+	Settings mSettings;
+	std::vector<float> mCpuTimesMs;
+	std::vector<float> mPresentIntervalsMs;
+	size_t mNextIndex{ 0u };
+	size_t mFramesNb{ 0u };
+	size_t mFramesSinceSummaryNb{ 0u };
+	std::uint64_t mStuttersNb{ 0u };
+	Summary mCpuSummary;
+	Summary mPresentSummary;
+};
@@ -0,0 +1,337 @@
+#include "GLTrace.hpp"
+
+#include <glad/glad.h>
+#include <imgui.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+	enum class CallKind : unsigned int {
+		Other = 0u,
+		Draw,
+		StateBind,
+		Upload
+	};
+
+	// Reads the arguments of a call, in the order GLAD passes them.
+	using Observer = void (*)(std::va_list arguments);
+
+	struct EntryPoint {
+		char const* name{ nullptr };
+		CallKind kind{ CallKind::Other };
+		Observer observer{ nullptr };
+		std::uint64_t calls_nb{ 0u }; //!< during the current frame
+	};
+
+	// Counters of the current frame; all GL calls happen on the thread
+	// owning the context.
+	struct Counters {
+		std::uint64_t draw_calls_nb{ 0u };
+		std::uint64_t triangles_nb{ 0u };
+		std::uint64_t uploaded_bytes{ 0u };
+		std::chrono::steady_clock::duration driver_time{ 0 };
+	};
+
+	std::vector<EntryPoint> entry_points;
+	// GLAD passes the address of the entry point's debug wrapper along
+	// with its name, which is cheaper to look up than the latter.
+	std::unordered_map<void const*, size_t> entry_point_indices;
+	Counters current_counters;
+	GLTrace::FrameStats last_frame_stats;
+
+	// Calls made from within another call, e.g. by a hook forwarding to
+	// the driver, are only timed once.
+	unsigned int nesting_depth = 0u;
+	std::chrono::steady_clock::time_point call_start_time;
+
+	std::uint64_t getTrianglesNb(GLenum mode, GLsizei count)
+	{
+		if (count <= 0)
+			return 0u;
+		auto const vertices_nb = static_cast<std::uint64_t>(count);
+		switch (mode) {
+		case GL_TRIANGLES:
+			return vertices_nb / 3u;
+		case GL_TRIANGLE_STRIP:
+		case GL_TRIANGLE_FAN:
+			return vertices_nb > 2u ? vertices_nb - 2u : 0u;
+		case GL_TRIANGLES_ADJACENCY:
+			return vertices_nb / 6u;
+		case GL_TRIANGLE_STRIP_ADJACENCY:
+			return vertices_nb >= 6u ? (vertices_nb - 4u) / 2u : 0u;
+		default:
+			// Points, lines and patches.
+			return 0u;
+		}
+	}
+
+	void recordDraw(GLenum mode, GLsizei count, GLsizei instances_nb)
+	{
+		++current_counters.draw_calls_nb;
+		current_counters.triangles_nb += getTrianglesNb(mode, count) * static_cast<std::uint64_t>(std::max(instances_nb, 0));
+	}
+
+	void recordMultiDraw(GLenum mode, GLsizei const* counts, GLsizei draws_nb)
+	{
+		for (GLsizei i = 0; counts != nullptr && i < draws_nb; ++i)
+			recordDraw(mode, counts[i], 1);
+	}
+
+	void recordIndirectDraws(GLsizei draws_nb)
+	{
+		current_counters.draw_calls_nb += static_cast<std::uint64_t>(std::max(draws_nb, 0));
+	}
+
+	void recordUpload(GLsizeiptr size, void const* data)
+	{
+		if (data != nullptr && size > 0)
+			current_counters.uploaded_bytes += static_cast<std::uint64_t>(size);
+	}
+
+	// Entry points whose arguments are needed; variadic arguments smaller
+	// than an int are promoted, which no GL type used below is.
+	std::unordered_map<std::string, std::pair<CallKind, Observer>> const& getObservedEntryPoints()
+	{
+		static std::unordered_map<std::string, std::pair<CallKind, Observer>> const observed_entry_points = {
+			{ "glDrawArrays", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum); va_arg(args, GLint);
+				auto const count = va_arg(args, GLsizei);
+				recordDraw(mode, count, 1);
+			} } },
+			{ "glDrawArraysInstanced", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum); va_arg(args, GLint);
+				auto const count = va_arg(args, GLsizei);
+				auto const instances_nb = va_arg(args, GLsizei);
+				recordDraw(mode, count, instances_nb);
+			} } },
+			{ "glDrawArraysInstancedBaseInstance", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum); va_arg(args, GLint);
+				auto const count = va_arg(args, GLsizei);
+				auto const instances_nb = va_arg(args, GLsizei);
+				recordDraw(mode, count, instances_nb);
+			} } },
+			{ "glDrawElements", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const count = va_arg(args, GLsizei);
+				recordDraw(mode, count, 1);
+			} } },
+			{ "glDrawElementsBaseVertex", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const count = va_arg(args, GLsizei);
+				recordDraw(mode, count, 1);
+			} } },
+			{ "glDrawElementsInstanced", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const count = va_arg(args, GLsizei); va_arg(args, GLenum); va_arg(args, void const*);
+				auto const instances_nb = va_arg(args, GLsizei);
+				recordDraw(mode, count, instances_nb);
+			} } },
+			{ "glDrawElementsInstancedBaseVertex", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const count = va_arg(args, GLsizei); va_arg(args, GLenum); va_arg(args, void const*);
+				auto const instances_nb = va_arg(args, GLsizei);
+				recordDraw(mode, count, instances_nb);
+			} } },
+			{ "glDrawElementsInstancedBaseInstance", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const count = va_arg(args, GLsizei); va_arg(args, GLenum); va_arg(args, void const*);
+				auto const instances_nb = va_arg(args, GLsizei);
+				recordDraw(mode, count, instances_nb);
+			} } },
+			{ "glDrawElementsInstancedBaseVertexBaseInstance", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const count = va_arg(args, GLsizei); va_arg(args, GLenum); va_arg(args, void const*);
+				auto const instances_nb = va_arg(args, GLsizei);
+				recordDraw(mode, count, instances_nb);
+			} } },
+			{ "glDrawRangeElements", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum); va_arg(args, GLuint); va_arg(args, GLuint);
+				auto const count = va_arg(args, GLsizei);
+				recordDraw(mode, count, 1);
+			} } },
+			{ "glDrawRangeElementsBaseVertex", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum); va_arg(args, GLuint); va_arg(args, GLuint);
+				auto const count = va_arg(args, GLsizei);
+				recordDraw(mode, count, 1);
+			} } },
+			{ "glMultiDrawArrays", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum); va_arg(args, GLint const*);
+				auto const counts = va_arg(args, GLsizei const*);
+				auto const draws_nb = va_arg(args, GLsizei);
+				recordMultiDraw(mode, counts, draws_nb);
+			} } },
+			{ "glMultiDrawElements", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const counts = va_arg(args, GLsizei const*); va_arg(args, GLenum); va_arg(args, void const* const*);
+				auto const draws_nb = va_arg(args, GLsizei);
+				recordMultiDraw(mode, counts, draws_nb);
+			} } },
+			{ "glMultiDrawElementsBaseVertex", { CallKind::Draw, [](std::va_list args){
+				auto const mode = va_arg(args, GLenum);
+				auto const counts = va_arg(args, GLsizei const*); va_arg(args, GLenum); va_arg(args, void const* const*);
+				auto const draws_nb = va_arg(args, GLsizei);
+				recordMultiDraw(mode, counts, draws_nb);
+			} } },
+			{ "glMultiDrawArraysIndirect", { CallKind::Draw, [](std::va_list args){
+				va_arg(args, GLenum); va_arg(args, void const*);
+				recordIndirectDraws(va_arg(args, GLsizei));
+			} } },
+			{ "glMultiDrawElementsIndirect", { CallKind::Draw, [](std::va_list args){
+				va_arg(args, GLenum); va_arg(args, GLenum); va_arg(args, void const*);
+				recordIndirectDraws(va_arg(args, GLsizei));
+			} } },
+			{ "glBufferData", { CallKind::Upload, [](std::va_list args){
+				va_arg(args, GLenum);
+				auto const size = va_arg(args, GLsizeiptr);
+				auto const data = va_arg(args, void const*);
+				recordUpload(size, data);
+			} } },
+			{ "glBufferSubData", { CallKind::Upload, [](std::va_list args){
+				va_arg(args, GLenum); va_arg(args, GLintptr);
+				auto const size = va_arg(args, GLsizeiptr);
+				auto const data = va_arg(args, void const*);
+				recordUpload(size, data);
+			} } },
+			{ "glBufferStorage", { CallKind::Upload, [](std::va_list args){
+				va_arg(args, GLenum);
+				auto const size = va_arg(args, GLsizeiptr);
+				auto const data = va_arg(args, void const*);
+				recordUpload(size, data);
+			} } },
+		};
+		return observed_entry_points;
+	}
+
+	bool startsWith(char const* name, char const* prefix)
+	{
+		return std::strncmp(name, prefix, std::strlen(prefix)) == 0;
+	}
+
+	EntryPoint createEntryPoint(char const* name)
+	{
+		auto const& observed_entry_points = getObservedEntryPoints();
+		auto const observed_entry_point = observed_entry_points.find(name);
+		if (observed_entry_point != observed_entry_points.end())
+			return EntryPoint{ name, observed_entry_point->second.first, observed_entry_point->second.second, 0u };
+
+		auto kind = CallKind::Other;
+		if (startsWith(name, "glBind") || std::strcmp(name, "glUseProgram") == 0)
+			kind = CallKind::StateBind;
+		// The triangles they draw are unknown to the CPU.
+		else if (startsWith(name, "glDrawArraysIndirect") || startsWith(name, "glDrawElementsIndirect")
+		         || startsWith(name, "glDrawTransformFeedback"))
+			kind = CallKind::Draw;
+		return EntryPoint{ name, kind, nullptr, 0u };
+	}
+
+	void beforeCall(char const* name, void* function, int arguments_nb, ...)
+	{
+		auto const index_iter = entry_point_indices.find(function);
+		size_t index = 0u;
+		if (index_iter != entry_point_indices.end()) {
+			index = index_iter->second;
+		} else {
+			index = entry_points.size();
+			entry_points.push_back(createEntryPoint(name));
+			entry_point_indices.emplace(function, index);
+		}
+
+		auto& entry_point = entry_points[index];
+		++entry_point.calls_nb;
+		if (entry_point.observer != nullptr) {
+			std::va_list arguments;
+			va_start(arguments, arguments_nb);
+			entry_point.observer(arguments);
+			va_end(arguments);
+		} else if (entry_point.kind == CallKind::Draw) {
+			recordIndirectDraws(1);
+		}
+
+		if (nesting_depth++ == 0u)
+			call_start_time = std::chrono::steady_clock::now();
+	}
+
+	void afterCall(char const* /*name*/, void* /*function*/, int /*arguments_nb*/, ...)
+	{
+		if (nesting_depth > 0u && --nesting_depth == 0u)
+			current_counters.driver_time += std::chrono::steady_clock::now() - call_start_time;
+	}
+}
+
+void GLTrace::InstallHooks()
+{
+#if defined ENABLE_GL_CALL_TRACING && ENABLE_GL_CALL_TRACING != 0
+#	ifndef GLAD_DEBUG
+#		error "Tracing the OpenGL calls needs the debug GLAD: configure with LUGGCGL_TRACE_GL_CALLS=ON."
+#	endif
+	glad_set_pre_callback(&beforeCall);
+	glad_set_post_callback(&afterCall);
+#endif
+}
+
+void GLTrace::EndFrame()
+{
+	if (!IsEnabled())
+		return;
+
+	auto& stats = last_frame_stats;
+	stats.calls_nb = 0u;
+	stats.state_binds_nb = 0u;
+	stats.calls_per_entry_point.clear();
+	for (auto& entry_point : entry_points) {
+		if (entry_point.calls_nb == 0u)
+			continue;
+		stats.calls_nb += entry_point.calls_nb;
+		if (entry_point.kind == CallKind::StateBind)
+			stats.state_binds_nb += entry_point.calls_nb;
+		stats.calls_per_entry_point.emplace_back(entry_point.name, entry_point.calls_nb);
+		entry_point.calls_nb = 0u;
+	}
+	std::sort(stats.calls_per_entry_point.begin(), stats.calls_per_entry_point.end(),
+	          [](std::pair<char const*, std::uint64_t> const& a, std::pair<char const*, std::uint64_t> const& b){
+		return a.second > b.second;
+	});
+	stats.draw_calls_nb = current_counters.draw_calls_nb;
+	stats.triangles_nb = current_counters.triangles_nb;
+	stats.uploaded_bytes = current_counters.uploaded_bytes;
+	stats.driver_ms = std::chrono::duration<float, std::milli>(current_counters.driver_time).count();
+
+	current_counters = Counters();
+}
+
+GLTrace::FrameStats const& GLTrace::GetLastFrameStats()
+{
+	return last_frame_stats;
+}
+
+void GLTrace::RenderOverlay()
+{
+	if (!IsEnabled())
+		return;
+
+	ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+	bool const opened = ImGui::Begin("GL calls", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing);
+	if (opened) {
+		auto const& stats = last_frame_stats;
+		ImGui::Text("Calls: %llu", static_cast<unsigned long long>(stats.calls_nb));
+		ImGui::Text("Draw calls: %llu", static_cast<unsigned long long>(stats.draw_calls_nb));
+		ImGui::Text("Triangles: %llu", static_cast<unsigned long long>(stats.triangles_nb));
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Triangles drawn by indirect draws are not included");
+		ImGui::Text("State binds: %llu", static_cast<unsigned long long>(stats.state_binds_nb));
+		ImGui::Text("Uploaded to buffers: %.1f KiB", static_cast<double>(stats.uploaded_bytes) / 1024.0);
+		ImGui::Text("Time in driver: %.3f ms", stats.driver_ms);
+		if (ImGui::TreeNode("Calls per entry point")) {
+			for (auto const& entry_point : stats.calls_per_entry_point)
+				ImGui::Text("%6llu %s", static_cast<unsigned long long>(entry_point.second), entry_point.first);
+			ImGui::TreePop();
+		}
+	}
+	ImGui::End();
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "BuildSettings.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//! \brief Per-frame statistics about the OpenGL calls made.
+//!
+//! Configuring with LUGGCGL_TRACE_GL_CALLS=ON builds the debug variant of
+//! GLAD, which calls a callback before and after every OpenGL call, and
+//! sets ENABLE_GL_CALL_TRACING to 1. `InstallHooks()` then sets those
+//! callbacks to count each call and measure the CPU time spent inside the
+//! driver. Draw calls, triangles submitted,
+//! state binds and bytes uploaded to buffers are counted as well.
+//! Triangles drawn by indirect draws are unknown to the CPU, so only their
+//! draw calls are counted. With GPU memory tracking enabled, its
+//! bookkeeping is included in the driver time.
+//!
+//! Each call then goes through the wrappers and reads the clock twice, so
+//! tracing is opt-in and the default build uses the plain GLAD: the driver
+//! times include that overhead, and are best compared between runs of the
+//! same build rather than against untraced ones.
+namespace GLTrace {
+
+struct FrameStats {
+	std::uint64_t calls_nb{ 0u };
+	std::uint64_t draw_calls_nb{ 0u };
+	std::uint64_t triangles_nb{ 0u };
+	std::uint64_t state_binds_nb{ 0u };
+	std::uint64_t uploaded_bytes{ 0u }; //!< to buffers
+	float driver_ms{ 0.0f };            //!< CPU time spent inside GL calls
+	std::vector<std::pair<char const*, std::uint64_t>> calls_per_entry_point; //!< most called first; only called ones
+};
+
+//! \brief Whether the tracing was compiled in.
+constexpr bool IsEnabled()
+{
+	return ENABLE_GL_CALL_TRACING != 0;
+}
+
+//! \brief Start tracing the calls; to be called once the OpenGL functions
+//!        have been loaded. Does nothing when tracing is compiled out.
+void InstallHooks();
+
+//! \brief Close the current frame; called by `WindowManager::SwapBuffers()`
+//!        right before presenting.
+void EndFrame();
+
+//! \brief Statistics of the last frame closed by `EndFrame()`.
+FrameStats const& GetLastFrameStats();
+
+//! \brief Display the statistics of the last frame in a small window.
+void RenderOverlay();
+
+}
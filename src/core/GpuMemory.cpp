@@ -0,0 +1,661 @@
+#include "GpuMemory.hpp"
+
+#include "core/Log.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using ObjectKey = std::pair<GLenum, GLuint>; // GL_BUFFER, GL_TEXTURE or GL_RENDERBUFFER, and name
+
+	struct Image {
+		GLsizei width{ 0 };
+		GLsizei height{ 0 };
+		GLsizei depth{ 0 };
+		size_t bytes{ 0u };
+	};
+
+	struct Allocation {
+		GpuMemory::Category category{ GpuMemory::Category::Buffer };
+		bool is_attached{ false }; //!< to a framebuffer object, making it a render target
+		std::string owner;
+		GLenum target{ 0u };
+		GLint internal_format{ 0 };
+		GLsizei width{ 0 };
+		GLsizei height{ 0 };
+		GLsizei depth{ 0 };
+		GLsizei levels_nb{ 0 };
+		GLsizei samples_nb{ 1 };
+		size_t bytes{ 0u };
+
+		// Images of mutable textures, per level and face (or target).
+		std::map<std::pair<GLint, GLenum>, Image> images;
+	};
+
+	struct Tracker {
+		std::map<ObjectKey, Allocation> allocations;
+		std::map<ObjectKey, std::string> names;
+		std::vector<std::string> owners;
+	};
+
+	// All calls happen on the thread owning the OpenGL context.
+	Tracker& getTracker()
+	{
+		static Tracker tracker;
+		return tracker;
+	}
+
+	std::array<char const*, static_cast<size_t>(GpuMemory::Category::Count)> const category_names = {
+		"Buffers",
+		"Textures",
+		"Render targets"
+	};
+
+	char const* getFormatName(GLint internal_format)
+	{
+		switch (internal_format) {
+		case 0:                          return "-";
+		case GL_RED:                     return "RED";
+		case GL_RG:                      return "RG";
+		case GL_RGB:                     return "RGB";
+		case GL_RGBA:                    return "RGBA";
+		case GL_R8:                      return "R8";
+		case GL_RG8:                     return "RG8";
+		case GL_RGB8:                    return "RGB8";
+		case GL_RGBA8:                   return "RGBA8";
+		case GL_SRGB8:                   return "SRGB8";
+		case GL_SRGB8_ALPHA8:            return "SRGB8_ALPHA8";
+		case GL_R16:                     return "R16";
+		case GL_RG16:                    return "RG16";
+		case GL_RGBA16:                  return "RGBA16";
+		case GL_R16F:                    return "R16F";
+		case GL_RG16F:                   return "RG16F";
+		case GL_RGB16F:                  return "RGB16F";
+		case GL_RGBA16F:                 return "RGBA16F";
+		case GL_R32F:                    return "R32F";
+		case GL_RG32F:                   return "RG32F";
+		case GL_RGB32F:                  return "RGB32F";
+		case GL_RGBA32F:                 return "RGBA32F";
+		case GL_R32UI:                   return "R32UI";
+		case GL_R11F_G11F_B10F:          return "R11F_G11F_B10F";
+		case GL_RGB10_A2:                return "RGB10_A2";
+		case GL_DEPTH_COMPONENT:         return "DEPTH";
+		case GL_DEPTH_COMPONENT16:       return "DEPTH16";
+		case GL_DEPTH_COMPONENT24:       return "DEPTH24";
+		case GL_DEPTH_COMPONENT32F:      return "DEPTH32F";
+		case GL_DEPTH_STENCIL:           return "DEPTH_STENCIL";
+		case GL_DEPTH24_STENCIL8:        return "DEPTH24_STENCIL8";
+		case GL_DEPTH32F_STENCIL8:       return "DEPTH32F_STENCIL8";
+		default:                         return nullptr;
+		}
+	}
+
+	std::string formatBytes(size_t bytes)
+	{
+		char buffer[32];
+		if (bytes >= 1024u * 1024u)
+			std::snprintf(buffer, sizeof(buffer), "%.2f MiB", static_cast<double>(bytes) / (1024.0 * 1024.0));
+		else if (bytes >= 1024u)
+			std::snprintf(buffer, sizeof(buffer), "%.2f KiB", static_cast<double>(bytes) / 1024.0);
+		else
+			std::snprintf(buffer, sizeof(buffer), "%zu B", bytes);
+		return buffer;
+	}
+
+	std::string getFormatString(GLint internal_format)
+	{
+		auto const name = getFormatName(internal_format);
+		if (name != nullptr)
+			return name;
+		char buffer[16];
+		std::snprintf(buffer, sizeof(buffer), "0x%04x", static_cast<unsigned int>(internal_format));
+		return buffer;
+	}
+
+	std::string getName(Tracker const& tracker, ObjectKey const& key)
+	{
+		auto const name = tracker.names.find(key);
+		if (name != tracker.names.end())
+			return name->second;
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "#%u", key.second);
+		return buffer;
+	}
+
+	Allocation& getAllocation(ObjectKey const& key, GpuMemory::Category category)
+	{
+		auto& tracker = getTracker();
+		auto const inserted = tracker.allocations.emplace(key, Allocation());
+		auto& allocation = inserted.first->second;
+		if (inserted.second || allocation.bytes == 0u)
+			allocation.owner = tracker.owners.empty() ? std::string() : tracker.owners.back();
+		allocation.category = allocation.is_attached ? GpuMemory::Category::RenderTarget : category;
+		return allocation;
+	}
+
+	void forget(GLenum type, GLsizei n, GLuint const* ids)
+	{
+		auto& tracker = getTracker();
+		for (GLsizei i = 0; i < n; ++i) {
+			tracker.allocations.erase(ObjectKey(type, ids[i]));
+			tracker.names.erase(ObjectKey(type, ids[i]));
+		}
+	}
+
+	GLuint getBoundObject(GLenum binding)
+	{
+		// Bypasses GLAD's debug wrapper when tracing the calls, so that the
+		// query does not show up in the traced calls.
+		GLint object = 0;
+		glad_glGetIntegerv(binding, &object);
+		return static_cast<GLuint>(object);
+	}
+
+	GLuint getBoundBuffer(GLenum target)
+	{
+		switch (target) {
+		case GL_ARRAY_BUFFER:              return getBoundObject(GL_ARRAY_BUFFER_BINDING);
+		case GL_ELEMENT_ARRAY_BUFFER:      return getBoundObject(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+		case GL_UNIFORM_BUFFER:            return getBoundObject(GL_UNIFORM_BUFFER_BINDING);
+		case GL_SHADER_STORAGE_BUFFER:     return getBoundObject(GL_SHADER_STORAGE_BUFFER_BINDING);
+		case GL_DRAW_INDIRECT_BUFFER:      return getBoundObject(GL_DRAW_INDIRECT_BUFFER_BINDING);
+		case GL_DISPATCH_INDIRECT_BUFFER:  return getBoundObject(GL_DISPATCH_INDIRECT_BUFFER_BINDING);
+		case GL_COPY_READ_BUFFER:          return getBoundObject(GL_COPY_READ_BUFFER_BINDING);
+		case GL_COPY_WRITE_BUFFER:         return getBoundObject(GL_COPY_WRITE_BUFFER_BINDING);
+		case GL_PIXEL_PACK_BUFFER:         return getBoundObject(GL_PIXEL_PACK_BUFFER_BINDING);
+		case GL_PIXEL_UNPACK_BUFFER:       return getBoundObject(GL_PIXEL_UNPACK_BUFFER_BINDING);
+		case GL_ATOMIC_COUNTER_BUFFER:     return getBoundObject(GL_ATOMIC_COUNTER_BUFFER_BINDING);
+		case GL_TRANSFORM_FEEDBACK_BUFFER: return getBoundObject(GL_TRANSFORM_FEEDBACK_BUFFER_BINDING);
+		case GL_TEXTURE_BUFFER:            return getBoundObject(GL_TEXTURE_BUFFER);
+		default:
+			LogWarning("GPU memory: buffer target 0x%04x is not tracked.", target);
+			return 0u;
+		}
+	}
+
+	// Cube map faces are reported as the cube map target itself.
+	GLenum getTextureTarget(GLenum target)
+	{
+		if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+			return GL_TEXTURE_CUBE_MAP;
+		return target;
+	}
+
+	GLuint getBoundTexture(GLenum target)
+	{
+		switch (getTextureTarget(target)) {
+		case GL_TEXTURE_1D:                   return getBoundObject(GL_TEXTURE_BINDING_1D);
+		case GL_TEXTURE_1D_ARRAY:             return getBoundObject(GL_TEXTURE_BINDING_1D_ARRAY);
+		case GL_TEXTURE_2D:                   return getBoundObject(GL_TEXTURE_BINDING_2D);
+		case GL_TEXTURE_2D_ARRAY:             return getBoundObject(GL_TEXTURE_BINDING_2D_ARRAY);
+		case GL_TEXTURE_2D_MULTISAMPLE:       return getBoundObject(GL_TEXTURE_BINDING_2D_MULTISAMPLE);
+		case GL_TEXTURE_3D:                   return getBoundObject(GL_TEXTURE_BINDING_3D);
+		case GL_TEXTURE_RECTANGLE:            return getBoundObject(GL_TEXTURE_BINDING_RECTANGLE);
+		case GL_TEXTURE_CUBE_MAP:             return getBoundObject(GL_TEXTURE_BINDING_CUBE_MAP);
+		case GL_TEXTURE_CUBE_MAP_ARRAY:       return getBoundObject(GL_TEXTURE_BINDING_CUBE_MAP_ARRAY);
+		default:
+			// Proxy targets do not allocate anything.
+			return 0u;
+		}
+	}
+
+	size_t getImageBytes(GLint internal_format, GLsizei width, GLsizei height, GLsizei depth)
+	{
+		return static_cast<size_t>(std::max(width, 1)) * static_cast<size_t>(std::max(height, 1))
+		     * static_cast<size_t>(std::max(depth, 1)) * GpuMemory::GetBytesPerPixel(internal_format);
+	}
+
+	void recordTextureImage(GLenum target, GLint level, GLint internal_format, GLsizei width, GLsizei height, GLsizei depth, size_t bytes)
+	{
+		auto const texture = getBoundTexture(target);
+		if (texture == 0u)
+			return;
+
+		auto& allocation = getAllocation(ObjectKey(GL_TEXTURE, texture), GpuMemory::Category::Texture);
+		allocation.target = getTextureTarget(target);
+		allocation.images[std::make_pair(level, target)] = Image{ width, height, depth, bytes };
+		if (level == 0) {
+			allocation.internal_format = internal_format;
+			allocation.width = width;
+			allocation.height = height;
+			allocation.depth = depth;
+		}
+
+		allocation.bytes = 0u;
+		GLint max_level = 0;
+		for (auto const& image : allocation.images) {
+			allocation.bytes += image.second.bytes;
+			max_level = std::max(max_level, image.first.first);
+		}
+		allocation.levels_nb = max_level + 1;
+	}
+
+	void recordTextureStorage(GLenum target, GLsizei levels, GLint internal_format, GLsizei width, GLsizei height, GLsizei depth, GLsizei samples)
+	{
+		auto const texture = getBoundTexture(target);
+		if (texture == 0u)
+			return;
+
+		auto& allocation = getAllocation(ObjectKey(GL_TEXTURE, texture), GpuMemory::Category::Texture);
+		allocation.target = target;
+		allocation.internal_format = internal_format;
+		allocation.width = width;
+		allocation.height = height;
+		allocation.depth = depth;
+		allocation.levels_nb = levels;
+		allocation.samples_nb = samples;
+		allocation.images.clear();
+
+		// Arrays keep their number of layers at every level.
+		bool const is_volume = target == GL_TEXTURE_3D;
+		auto const faces_nb = target == GL_TEXTURE_CUBE_MAP ? 6u : 1u;
+		allocation.bytes = 0u;
+		for (GLsizei level = 0; level < levels; ++level) {
+			auto const level_width = std::max(width >> level, 1);
+			auto const level_height = target == GL_TEXTURE_1D_ARRAY ? height : std::max(height >> level, 1);
+			auto const level_depth = is_volume ? std::max(depth >> level, 1) : depth;
+			allocation.bytes += faces_nb * static_cast<size_t>(samples) * getImageBytes(internal_format, level_width, level_height, level_depth);
+		}
+	}
+
+	// Original entry points, called by the hooks.
+	PFNGLBUFFERDATAPROC original_buffer_data = nullptr;
+	PFNGLBUFFERSTORAGEPROC original_buffer_storage = nullptr;
+	PFNGLDELETEBUFFERSPROC original_delete_buffers = nullptr;
+	PFNGLTEXIMAGE1DPROC original_tex_image_1d = nullptr;
+	PFNGLTEXIMAGE2DPROC original_tex_image_2d = nullptr;
+	PFNGLTEXIMAGE3DPROC original_tex_image_3d = nullptr;
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC original_compressed_tex_image_2d = nullptr;
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC original_tex_image_2d_multisample = nullptr;
+	PFNGLTEXSTORAGE2DPROC original_tex_storage_2d = nullptr;
+	PFNGLTEXSTORAGE3DPROC original_tex_storage_3d = nullptr;
+	PFNGLGENERATEMIPMAPPROC original_generate_mipmap = nullptr;
+	PFNGLDELETETEXTURESPROC original_delete_textures = nullptr;
+	PFNGLRENDERBUFFERSTORAGEPROC original_renderbuffer_storage = nullptr;
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC original_renderbuffer_storage_multisample = nullptr;
+	PFNGLDELETERENDERBUFFERSPROC original_delete_renderbuffers = nullptr;
+	PFNGLFRAMEBUFFERTEXTUREPROC original_framebuffer_texture = nullptr;
+	PFNGLFRAMEBUFFERTEXTURE2DPROC original_framebuffer_texture_2d = nullptr;
+
+	void recordBuffer(GLenum target, GLsizeiptr size)
+	{
+		auto const buffer = getBoundBuffer(target);
+		if (buffer == 0u)
+			return;
+		auto& allocation = getAllocation(ObjectKey(GL_BUFFER, buffer), GpuMemory::Category::Buffer);
+		allocation.target = target;
+		allocation.bytes = static_cast<size_t>(size);
+	}
+
+	void APIENTRY hookBufferData(GLenum target, GLsizeiptr size, void const* data, GLenum usage)
+	{
+		recordBuffer(target, size);
+		original_buffer_data(target, size, data, usage);
+	}
+
+	void APIENTRY hookBufferStorage(GLenum target, GLsizeiptr size, void const* data, GLbitfield flags)
+	{
+		recordBuffer(target, size);
+		original_buffer_storage(target, size, data, flags);
+	}
+
+	void APIENTRY hookDeleteBuffers(GLsizei n, GLuint const* buffers)
+	{
+		forget(GL_BUFFER, n, buffers);
+		original_delete_buffers(n, buffers);
+	}
+
+	void APIENTRY hookTexImage1D(GLenum target, GLint level, GLint internal_format, GLsizei width, GLint border, GLenum format, GLenum type, void const* pixels)
+	{
+		recordTextureImage(target, level, internal_format, width, 1, 1, getImageBytes(internal_format, width, 1, 1));
+		original_tex_image_1d(target, level, internal_format, width, border, format, type, pixels);
+	}
+
+	void APIENTRY hookTexImage2D(GLenum target, GLint level, GLint internal_format, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, void const* pixels)
+	{
+		recordTextureImage(target, level, internal_format, width, height, 1, getImageBytes(internal_format, width, height, 1));
+		original_tex_image_2d(target, level, internal_format, width, height, border, format, type, pixels);
+	}
+
+	void APIENTRY hookTexImage3D(GLenum target, GLint level, GLint internal_format, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, void const* pixels)
+	{
+		recordTextureImage(target, level, internal_format, width, height, depth, getImageBytes(internal_format, width, height, depth));
+		original_tex_image_3d(target, level, internal_format, width, height, depth, border, format, type, pixels);
+	}
+
+	void APIENTRY hookCompressedTexImage2D(GLenum target, GLint level, GLenum internal_format, GLsizei width, GLsizei height, GLint border, GLsizei image_size, void const* data)
+	{
+		recordTextureImage(target, level, static_cast<GLint>(internal_format), width, height, 1, static_cast<size_t>(image_size));
+		original_compressed_tex_image_2d(target, level, internal_format, width, height, border, image_size, data);
+	}
+
+	void APIENTRY hookTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internal_format, GLsizei width, GLsizei height, GLboolean fixed_sample_locations)
+	{
+		recordTextureStorage(target, 1, static_cast<GLint>(internal_format), width, height, 1, samples);
+		original_tex_image_2d_multisample(target, samples, internal_format, width, height, fixed_sample_locations);
+	}
+
+	void APIENTRY hookTexStorage2D(GLenum target, GLsizei levels, GLenum internal_format, GLsizei width, GLsizei height)
+	{
+		recordTextureStorage(target, levels, static_cast<GLint>(internal_format), width, height, 1, 1);
+		original_tex_storage_2d(target, levels, internal_format, width, height);
+	}
+
+	void APIENTRY hookTexStorage3D(GLenum target, GLsizei levels, GLenum internal_format, GLsizei width, GLsizei height, GLsizei depth)
+	{
+		recordTextureStorage(target, levels, static_cast<GLint>(internal_format), width, height, depth, 1);
+		original_tex_storage_3d(target, levels, internal_format, width, height, depth);
+	}
+
+	void APIENTRY hookGenerateMipmap(GLenum target)
+	{
+		original_generate_mipmap(target);
+
+		auto const texture = getBoundTexture(target);
+		auto const allocation = getTracker().allocations.find(ObjectKey(GL_TEXTURE, texture));
+		if (texture == 0u || allocation == getTracker().allocations.end() || allocation->second.images.empty())
+			return;
+
+		// Fill in all levels below the base images, of every face.
+		std::vector<std::pair<GLenum, Image>> base_images;
+		for (auto const& image : allocation->second.images)
+			if (image.first.first == 0)
+				base_images.emplace_back(image.first.second, image.second);
+		auto const internal_format = allocation->second.internal_format;
+		bool const is_volume = target == GL_TEXTURE_3D;
+		for (auto const& base_image : base_images) {
+			auto const& image = base_image.second;
+			auto width = image.width, height = image.height, depth = image.depth;
+			for (GLint level = 1; width > 1 || height > 1 || (is_volume && depth > 1); ++level) {
+				width = std::max(width / 2, 1);
+				height = target == GL_TEXTURE_1D_ARRAY ? height : std::max(height / 2, 1);
+				depth = is_volume ? std::max(depth / 2, 1) : depth;
+				recordTextureImage(base_image.first, level, internal_format, width, height, depth,
+				                   getImageBytes(internal_format, width, height, depth));
+			}
+		}
+	}
+
+	void APIENTRY hookDeleteTextures(GLsizei n, GLuint const* textures)
+	{
+		forget(GL_TEXTURE, n, textures);
+		original_delete_textures(n, textures);
+	}
+
+	void recordRenderbuffer(GLenum internal_format, GLsizei samples, GLsizei width, GLsizei height)
+	{
+		auto const renderbuffer = getBoundObject(GL_RENDERBUFFER_BINDING);
+		if (renderbuffer == 0u)
+			return;
+		auto& allocation = getAllocation(ObjectKey(GL_RENDERBUFFER, renderbuffer), GpuMemory::Category::RenderTarget);
+		allocation.target = GL_RENDERBUFFER;
+		allocation.internal_format = static_cast<GLint>(internal_format);
+		allocation.width = width;
+		allocation.height = height;
+		allocation.depth = 1;
+		allocation.levels_nb = 1;
+		allocation.samples_nb = std::max(samples, 1);
+		allocation.bytes = static_cast<size_t>(allocation.samples_nb) * getImageBytes(allocation.internal_format, width, height, 1);
+	}
+
+	void APIENTRY hookRenderbufferStorage(GLenum target, GLenum internal_format, GLsizei width, GLsizei height)
+	{
+		recordRenderbuffer(internal_format, 1, width, height);
+		original_renderbuffer_storage(target, internal_format, width, height);
+	}
+
+	void APIENTRY hookRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internal_format, GLsizei width, GLsizei height)
+	{
+		recordRenderbuffer(internal_format, samples, width, height);
+		original_renderbuffer_storage_multisample(target, samples, internal_format, width, height);
+	}
+
+	void APIENTRY hookDeleteRenderbuffers(GLsizei n, GLuint const* renderbuffers)
+	{
+		forget(GL_RENDERBUFFER, n, renderbuffers);
+		original_delete_renderbuffers(n, renderbuffers);
+	}
+
+	void markAsRenderTarget(GLuint texture)
+	{
+		if (texture == 0u)
+			return;
+		auto& allocation = getTracker().allocations[ObjectKey(GL_TEXTURE, texture)];
+		allocation.is_attached = true;
+		allocation.category = GpuMemory::Category::RenderTarget;
+	}
+
+	void APIENTRY hookFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+	{
+		markAsRenderTarget(texture);
+		original_framebuffer_texture(target, attachment, texture, level);
+	}
+
+	void APIENTRY hookFramebufferTexture2D(GLenum target, GLenum attachment, GLenum texture_target, GLuint texture, GLint level)
+	{
+		markAsRenderTarget(texture);
+		original_framebuffer_texture_2d(target, attachment, texture_target, texture, level);
+	}
+
+	template<typename Function>
+	void hook(Function& entry_point, Function& original, Function replacement)
+	{
+		// Entry points missing from the current context stay missing.
+		if (entry_point == nullptr || original != nullptr)
+			return;
+		original = entry_point;
+		entry_point = replacement;
+	}
+
+	// Sorted by category, owner, then name, for reports to be stable
+	// across runs.
+	std::vector<std::pair<ObjectKey, Allocation const*>> getSortedAllocations()
+	{
+		auto const& tracker = getTracker();
+		std::vector<std::tuple<GpuMemory::Category, std::string, std::string, ObjectKey, Allocation const*>> entries;
+		for (auto const& allocation : tracker.allocations) {
+			if (allocation.second.bytes == 0u)
+				continue;
+			entries.emplace_back(allocation.second.category, allocation.second.owner,
+			                     getName(tracker, allocation.first), allocation.first, &allocation.second);
+		}
+		std::sort(entries.begin(), entries.end());
+
+		std::vector<std::pair<ObjectKey, Allocation const*>> sorted_allocations;
+		sorted_allocations.reserve(entries.size());
+		for (auto const& entry : entries)
+			sorted_allocations.emplace_back(std::get<3>(entry), std::get<4>(entry));
+		return sorted_allocations;
+	}
+
+	std::string getDimensions(Allocation const& allocation)
+	{
+		if (allocation.target == 0u || allocation.category == GpuMemory::Category::Buffer)
+			return "-";
+		char buffer[64];
+		std::snprintf(buffer, sizeof(buffer), "%dx%dx%d", allocation.width, allocation.height, allocation.depth);
+		return buffer;
+	}
+}
+
+GpuMemory::OwnerScope::OwnerScope(std::string owner)
+{
+	getTracker().owners.push_back(std::move(owner));
+}
+
+GpuMemory::OwnerScope::~OwnerScope()
+{
+	getTracker().owners.pop_back();
+}
+
+void GpuMemory::InstallHooks()
+{
+#if defined ENABLE_GPU_MEMORY_TRACKING && ENABLE_GPU_MEMORY_TRACKING != 0
+	hook(glad_glBufferData, original_buffer_data, hookBufferData);
+	hook(glad_glBufferStorage, original_buffer_storage, hookBufferStorage);
+	hook(glad_glDeleteBuffers, original_delete_buffers, hookDeleteBuffers);
+	hook(glad_glTexImage1D, original_tex_image_1d, hookTexImage1D);
+	hook(glad_glTexImage2D, original_tex_image_2d, hookTexImage2D);
+	hook(glad_glTexImage3D, original_tex_image_3d, hookTexImage3D);
+	hook(glad_glCompressedTexImage2D, original_compressed_tex_image_2d, hookCompressedTexImage2D);
+	hook(glad_glTexImage2DMultisample, original_tex_image_2d_multisample, hookTexImage2DMultisample);
+	hook(glad_glTexStorage2D, original_tex_storage_2d, hookTexStorage2D);
+	hook(glad_glTexStorage3D, original_tex_storage_3d, hookTexStorage3D);
+	hook(glad_glGenerateMipmap, original_generate_mipmap, hookGenerateMipmap);
+	hook(glad_glDeleteTextures, original_delete_textures, hookDeleteTextures);
+	hook(glad_glRenderbufferStorage, original_renderbuffer_storage, hookRenderbufferStorage);
+	hook(glad_glRenderbufferStorageMultisample, original_renderbuffer_storage_multisample, hookRenderbufferStorageMultisample);
+	hook(glad_glDeleteRenderbuffers, original_delete_renderbuffers, hookDeleteRenderbuffers);
+	hook(glad_glFramebufferTexture, original_framebuffer_texture, hookFramebufferTexture);
+	hook(glad_glFramebufferTexture2D, original_framebuffer_texture_2d, hookFramebufferTexture2D);
+#endif
+}
+
+void GpuMemory::SetName(GLenum type, GLuint id, std::string const& name)
+{
+#if defined ENABLE_GPU_MEMORY_TRACKING && ENABLE_GPU_MEMORY_TRACKING != 0
+	if (type != GL_BUFFER && type != GL_TEXTURE && type != GL_RENDERBUFFER)
+		return;
+	getTracker().names[ObjectKey(type, id)] = name;
+#endif
+}
+
+std::array<size_t, static_cast<size_t>(GpuMemory::Category::Count)> GpuMemory::GetTotalBytes()
+{
+	std::array<size_t, static_cast<size_t>(Category::Count)> total_bytes;
+	total_bytes.fill(0u);
+	for (auto const& allocation : getTracker().allocations)
+		total_bytes[static_cast<size_t>(allocation.second.category)] += allocation.second.bytes;
+	return total_bytes;
+}
+
+size_t GpuMemory::GetBytesPerPixel(GLint internal_format)
+{
+	switch (internal_format) {
+	case GL_RED:
+	case GL_R8:
+		return 1u;
+	case GL_RG:
+	case GL_RG8:
+	case GL_R16:
+	case GL_R16F:
+	case GL_DEPTH_COMPONENT16:
+		return 2u;
+	case GL_RGBA16:
+	case GL_RGB16F:
+	case GL_RGBA16F:
+	case GL_RG32F:
+	case GL_DEPTH32F_STENCIL8:
+		return 8u;
+	case GL_RGB32F:
+		return 12u;
+	case GL_RGBA32F:
+		return 16u;
+	default:
+		// GL_RGB, GL_RGBA, GL_RGB8 (padded by most drivers), GL_RGBA8,
+		// GL_SRGB8_ALPHA8, GL_RG16, GL_RG16F, GL_R32F, GL_R32UI,
+		// GL_R11F_G11F_B10F, GL_DEPTH24_STENCIL8, GL_DEPTH_COMPONENT32F, ...
+		return 4u;
+	}
+}
+
+bool GpuMemory::WriteReport(std::string const& filename)
+{
+	std::ofstream file(filename);
+	if (!file.is_open()) {
+		LogError("Failed to open “%s” for writing the GPU memory report.", filename.c_str());
+		return false;
+	}
+
+	auto const total_bytes = GetTotalBytes();
+	for (size_t i = 0; i < total_bytes.size(); ++i)
+		file << "# " << category_names[i] << ": " << total_bytes[i] << " bytes\n";
+	file << "# category\towner\tname\tbytes\tformat\tdimensions\tlevels\tsamples\n";
+
+	auto const& tracker = getTracker();
+	for (auto const& entry : getSortedAllocations()) {
+		auto const& allocation = *entry.second;
+		file << category_names[static_cast<size_t>(allocation.category)] << '\t'
+		     << (allocation.owner.empty() ? "-" : allocation.owner) << '\t'
+		     << getName(tracker, entry.first) << '\t'
+		     << allocation.bytes << '\t'
+		     << getFormatString(allocation.internal_format) << '\t'
+		     << getDimensions(allocation) << '\t'
+		     << allocation.levels_nb << '\t'
+		     << allocation.samples_nb << '\n';
+	}
+
+	if (!file) {
+		LogError("Failed to write the GPU memory report to “%s”.", filename.c_str());
+		return false;
+	}
+	LogInfo("GPU memory report written to “%s”.", filename.c_str());
+	return true;
+}
+
+void GpuMemory::RenderWindow()
+{
+	bool const opened = ImGui::Begin("GPU memory", nullptr, ImGuiWindowFlags_None);
+	if (!opened) {
+		ImGui::End();
+		return;
+	}
+
+#if !defined ENABLE_GPU_MEMORY_TRACKING || ENABLE_GPU_MEMORY_TRACKING == 0
+	ImGui::TextUnformatted("Tracking is disabled; see ENABLE_GPU_MEMORY_TRACKING in BuildSettings.h.");
+#else
+	if (ImGui::Button("Dump to file"))
+		WriteReport("gpu_memory.txt");
+
+	auto const total_bytes = GetTotalBytes();
+	size_t all_bytes = 0u;
+	for (auto const bytes : total_bytes)
+		all_bytes += bytes;
+	ImGui::Text("Total: %s", formatBytes(all_bytes).c_str());
+
+	auto const& tracker = getTracker();
+	auto const allocations = getSortedAllocations();
+	auto entry = allocations.begin();
+	for (size_t category = 0; category < total_bytes.size(); ++category) {
+		auto const category_end = std::find_if(entry, allocations.end(), [category](std::pair<ObjectKey, Allocation const*> const& allocation){
+			return static_cast<size_t>(allocation.second->category) != category;
+		});
+		auto const header = std::string(category_names[category]) + ": " + formatBytes(total_bytes[category]) + "###" + category_names[category];
+		if (ImGui::CollapsingHeader(header.c_str())) {
+			while (entry != category_end) {
+				auto const& owner = entry->second->owner;
+				auto const owner_end = std::find_if(entry, category_end, [&owner](std::pair<ObjectKey, Allocation const*> const& allocation){
+					return allocation.second->owner != owner;
+				});
+				size_t owner_bytes = 0u;
+				for (auto i = entry; i != owner_end; ++i)
+					owner_bytes += i->second->bytes;
+
+				ImGui::PushID(static_cast<int>(category));
+				if (ImGui::TreeNode(owner.empty() ? "(no owner)" : owner.c_str(), "%s: %s in %zu objects", owner.empty() ? "(no owner)" : owner.c_str(),
+				                    formatBytes(owner_bytes).c_str(), static_cast<size_t>(owner_end - entry))) {
+					for (auto i = entry; i != owner_end; ++i) {
+						auto const& allocation = *i->second;
+						ImGui::BulletText("%s: %s, %s %s, %d levels", getName(tracker, i->first).c_str(), formatBytes(allocation.bytes).c_str(),
+						                  getFormatString(allocation.internal_format).c_str(), getDimensions(allocation).c_str(), allocation.levels_nb);
+					}
+					ImGui::TreePop();
+				}
+				ImGui::PopID();
+				entry = owner_end;
+			}
+		}
+		entry = category_end;
+	}
+#endif
+
+	ImGui::End();
+}
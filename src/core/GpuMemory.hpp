@@ -0,0 +1,78 @@
+#pragma once
+
+#include "BuildSettings.h"
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+//! \brief Accounting of the GPU memory used by buffers, textures and
+//!        render targets.
+//!
+//! Once `InstallHooks()` has been called, the OpenGL functions allocating
+//! or freeing storage are intercepted, so that every allocation made
+//! through them is recorded along with its size, format and number of mip
+//! levels. Labels given with `utils::opengl::debug::nameObject()` are
+//! reused as names, and the allocations are attributed to the innermost
+//! `OwnerScope` alive when they are made.
+//! Dear ImGui's OpenGL backend loads its functions through GLAD as well
+//! (see imconfig.h), so its font atlas and vertex buffers are included.
+//!
+//! Textures attached to a framebuffer object, and renderbuffers, are
+//! counted as render targets. Sizes are estimates: drivers can pad or
+//! compress the storage in ways not visible to the application.
+//!
+//! Recording is compiled out when ENABLE_GPU_MEMORY_TRACKING is 0.
+namespace GpuMemory {
+
+enum class Category : unsigned int {
+	Buffer = 0u,
+	Texture,
+	RenderTarget,
+	Count
+};
+
+//! \brief Attribute the allocations made during its lifetime to an owner,
+//!        e.g. a loaded scene or an assignment's render targets.
+class OwnerScope {
+public:
+	explicit OwnerScope(std::string owner);
+	~OwnerScope();
+
+	OwnerScope(OwnerScope const&) = delete;
+	OwnerScope& operator=(OwnerScope const&) = delete;
+};
+
+//! \brief Start intercepting the allocations; to be called once the
+//!        OpenGL functions have been loaded.
+void InstallHooks();
+
+//! \brief Name an object in the reports; called by
+//!        `utils::opengl::debug::nameObject()`.
+//!
+//! @param [in] type one of GL_BUFFER, GL_TEXTURE or GL_RENDERBUFFER;
+//!                  other types are ignored, as are all calls when
+//!                  ENABLE_GPU_MEMORY_TRACKING is off
+//! @param [in] id OpenGL name of the object
+//! @param [in] name label of the object
+void SetName(GLenum type, GLuint id, std::string const& name);
+
+//! \brief Bytes currently allocated, per category.
+std::array<size_t, static_cast<size_t>(Category::Count)> GetTotalBytes();
+
+//! \brief Estimate of the bytes per pixel used by an internal format.
+size_t GetBytesPerPixel(GLint internal_format);
+
+//! \brief Write all current allocations to a text file, one per line and
+//!        sorted, so that two reports can be compared with `diff`.
+//!
+//! @param [in] filename file to write the report to
+//! @return whether the file could be written
+bool WriteReport(std::string const& filename);
+
+//! \brief Display the allocations, grouped by category then by owner.
+void RenderWindow();
+
+}
@@ -1,7 +1,96 @@
 #include "InputHandler.h"
 
+#include "Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
 /*----------------------------------------------------------------------------*/
 
+namespace
+{
+	// Recordings start with a magic string and a version, followed by the
+	// events. Each event is made of the number of ticks since the previous
+	// event, its type and its payload. Integers are stored as variable-length
+	// quantities (with a zigzag encoding for signed ones), so that most of
+	// them fit in a single byte; floats are stored as little-endian bit
+	// patterns, so that the replayed values are identical.
+	constexpr std::array<char, 4> recording_magic{ 'B', 'N', 'I', 'R' };
+	constexpr std::uint8_t recording_version = 1u;
+
+	void writeUnsigned(std::ostream& stream, std::uint64_t value)
+	{
+		do {
+			auto byte = static_cast<std::uint8_t>(value & 0x7Fu);
+			value >>= 7u;
+			if (value != 0u)
+				byte |= 0x80u;
+			stream.put(static_cast<char>(byte));
+		} while (value != 0u);
+	}
+
+	void writeSigned(std::ostream& stream, std::int32_t value)
+	{
+		auto const bits = static_cast<std::uint32_t>(value);
+		writeUnsigned(stream, (bits << 1u) ^ (value < 0 ? 0xFFFFFFFFu : 0u));
+	}
+
+	void writeFloat(std::ostream& stream, float value)
+	{
+		std::uint32_t bits = 0u;
+		std::memcpy(&bits, &value, sizeof(bits));
+		for (unsigned int i = 0u; i < 4u; ++i)
+			stream.put(static_cast<char>((bits >> (8u * i)) & 0xFFu));
+	}
+
+	bool readByte(std::vector<char> const& data, size_t& offset, std::uint8_t& value)
+	{
+		if (offset >= data.size())
+			return false;
+		value = static_cast<std::uint8_t>(data[offset++]);
+		return true;
+	}
+
+	bool readUnsigned(std::vector<char> const& data, size_t& offset, std::uint64_t& value)
+	{
+		value = 0u;
+		for (unsigned int shift = 0u; shift < 64u; shift += 7u) {
+			std::uint8_t byte = 0u;
+			if (!readByte(data, offset, byte))
+				return false;
+			value |= static_cast<std::uint64_t>(byte & 0x7Fu) << shift;
+			if ((byte & 0x80u) == 0u)
+				return true;
+		}
+		return false;
+	}
+
+	bool readSigned(std::vector<char> const& data, size_t& offset, std::int32_t& value)
+	{
+		std::uint64_t encoded = 0u;
+		if (!readUnsigned(data, offset, encoded) || encoded > 0xFFFFFFFFu)
+			return false;
+		auto const bits = static_cast<std::uint32_t>(encoded);
+		value = static_cast<std::int32_t>((bits >> 1u) ^ (0u - (bits & 1u)));
+		return true;
+	}
+
+	bool readFloat(std::vector<char> const& data, size_t& offset, float& value)
+	{
+		std::uint32_t bits = 0u;
+		for (unsigned int i = 0u; i < 4u; ++i) {
+			std::uint8_t byte = 0u;
+			if (!readByte(data, offset, byte))
+				return false;
+			bits |= static_cast<std::uint32_t>(byte) << (8u * i);
+		}
+		std::memcpy(&value, &bits, sizeof(value));
+		return true;
+	}
+}
+
 InputHandler::InputHandler()
 {
 	for (auto& mousePosition : mMousePositionSwitched)
@@ -10,8 +99,21 @@ InputHandler::InputHandler()
 	}
 }
 
+InputHandler::~InputHandler()
+{
+	StopRecording();
+}
+
 void InputHandler::Advance()
 {
+	// Replayed events are processed as if they had been fed since the
+	// previous call, just like live ones.
+	if (mIsReplaying) {
+		auto const replay_tick = mTick - mReplayStartTick;
+		while (mNextReplayEvent < mReplayEvents.size() && mReplayEvents[mNextReplayEvent].tick <= replay_tick)
+			ProcessEvent(mReplayEvents[mNextReplayEvent++]);
+	}
+
 	mTick++;
 }
 
@@ -37,40 +139,110 @@ void InputHandler::UpEvent(InputStateMap& map, size_t loc)
 
 void InputHandler::FeedKeyboard(int key, int scancode, int action)
 {
-	switch (action)
+	if (mIsReplaying)
+		return;
+
+	Event event;
+	event.tick = mTick;
+	event.type = EventType::Keyboard;
+	event.key = key;
+	event.scancode = scancode;
+	event.action = action;
+	RecordEvent(event);
+	ProcessEvent(event);
+}
+
+void InputHandler::FeedMouseMotion(glm::vec2 const& position)
+{
+	if (mIsReplaying)
+		return;
+
+	Event event;
+	event.tick = mTick;
+	event.type = EventType::MouseMotion;
+	event.position = position;
+	RecordEvent(event);
+	ProcessEvent(event);
+}
+
+void InputHandler::FeedMouseButtons(int button, int action)
+{
+	if (mIsReplaying)
+		return;
+
+	Event event;
+	event.tick = mTick;
+	event.type = EventType::MouseButtons;
+	event.key = button;
+	event.action = action;
+	RecordEvent(event);
+	ProcessEvent(event);
+}
+
+void InputHandler::ProcessEvent(Event const& event)
+{
+	switch (event.type)
 	{
-		case GLFW_PRESS:
-			DownEvent(mScancodeMap, static_cast<size_t>(scancode));
-			DownEvent(mKeycodeMap, static_cast<size_t>(key));
+		case EventType::Keyboard:
+			if (event.action == GLFW_PRESS) {
+				DownEvent(mScancodeMap, static_cast<size_t>(event.scancode));
+				DownEvent(mKeycodeMap, static_cast<size_t>(event.key));
+			} else if (event.action == GLFW_RELEASE) {
+				UpEvent(mScancodeMap, static_cast<size_t>(event.scancode));
+				UpEvent(mKeycodeMap, static_cast<size_t>(event.key));
+			}
 			break;
-		case GLFW_RELEASE:
-			UpEvent(mScancodeMap, static_cast<size_t>(scancode));
-			UpEvent(mKeycodeMap, static_cast<size_t>(key));
+		case EventType::MouseButtons:
+			if (event.action == GLFW_PRESS)
+				DownEvent(mMouseMap, static_cast<size_t>(event.key));
+			else if (event.action == GLFW_RELEASE)
+				UpEvent(mMouseMap, static_cast<size_t>(event.key));
+			if (event.key >= 0 && event.key < static_cast<std::int32_t>(mMousePositionSwitched.size()))
+				mMousePositionSwitched[event.key] = mMousePosition;
+			break;
+		case EventType::MouseMotion:
+			mMousePosition = event.position;
+			break;
+		case EventType::UICapture:
+			mMouseCapturedByUI = (event.action & 1) != 0;
+			mKeyboardCapturedByUI = (event.action & 2) != 0;
 			break;
 		default:
 			break;
 	}
 }
 
-void InputHandler::FeedMouseMotion(glm::vec2 const& position)
+void InputHandler::RecordEvent(Event const& event)
 {
-	mMousePosition = position;
-}
+	if (!mRecordingFile.is_open())
+		return;
 
-void InputHandler::FeedMouseButtons(int button, int action)
-{
-	switch (action)
+	auto const tick = event.tick - mRecordingStartTick;
+	writeUnsigned(mRecordingFile, tick - mLastRecordedTick);
+	mLastRecordedTick = tick;
+
+	mRecordingFile.put(static_cast<char>(event.type));
+	switch (event.type)
 	{
-		case GLFW_PRESS:
-			DownEvent(mMouseMap, static_cast<size_t>(button));
+		case EventType::Keyboard:
+			writeSigned(mRecordingFile, event.key);
+			writeSigned(mRecordingFile, event.scancode);
+			writeSigned(mRecordingFile, event.action);
+			break;
+		case EventType::MouseButtons:
+			writeSigned(mRecordingFile, event.key);
+			writeSigned(mRecordingFile, event.action);
+			break;
+		case EventType::MouseMotion:
+			writeFloat(mRecordingFile, event.position.x);
+			writeFloat(mRecordingFile, event.position.y);
 			break;
-		case GLFW_RELEASE:
-			UpEvent(mMouseMap, static_cast<size_t>(button));
+		case EventType::UICapture:
+			writeSigned(mRecordingFile, event.action);
 			break;
 		default:
 			break;
 	}
-	mMousePositionSwitched[button] = mMousePosition;
 }
 
 std::uint32_t InputHandler::GetState(InputStateMap const& map, size_t loc)
@@ -124,6 +296,161 @@ bool InputHandler::IsKeyboardCapturedByUI() const
 
 void InputHandler::SetUICapture(bool mouseCapture, bool keyboardCapture)
 {
-	mMouseCapturedByUI = mouseCapture;
-	mKeyboardCapturedByUI = keyboardCapture;
+	if (mIsReplaying)
+		return;
+
+	// Only changes are recorded, as this is called every frame.
+	if (mouseCapture == mMouseCapturedByUI && keyboardCapture == mKeyboardCapturedByUI)
+		return;
+
+	Event event;
+	event.tick = mTick;
+	event.type = EventType::UICapture;
+	event.action = (mouseCapture ? 1 : 0) | (keyboardCapture ? 2 : 0);
+	RecordEvent(event);
+	ProcessEvent(event);
+}
+
+bool InputHandler::StartRecording(std::string const& filename)
+{
+	StopRecording();
+
+	mRecordingFile.open(filename, std::ios::binary | std::ios::trunc);
+	if (!mRecordingFile.is_open()) {
+		LogError("Failed to open “%s” for recording the inputs.", filename.c_str());
+		return false;
+	}
+	mRecordingFile.write(recording_magic.data(), static_cast<std::streamsize>(recording_magic.size()));
+	mRecordingFile.put(static_cast<char>(recording_version));
+	mRecordingStartTick = mTick;
+	mLastRecordedTick = 0ULL;
+
+	// Start from the current state, rather than whatever the replaying
+	// handler will be in.
+	Event event;
+	event.tick = mTick;
+	event.type = EventType::MouseMotion;
+	event.position = mMousePosition;
+	RecordEvent(event);
+	event.type = EventType::UICapture;
+	event.action = (mMouseCapturedByUI ? 1 : 0) | (mKeyboardCapturedByUI ? 2 : 0);
+	RecordEvent(event);
+
+	LogInfo("Recording the inputs to “%s”.", filename.c_str());
+	return true;
+}
+
+void InputHandler::StopRecording()
+{
+	if (!mRecordingFile.is_open())
+		return;
+
+	Event event;
+	event.tick = mTick;
+	event.type = EventType::End;
+	RecordEvent(event);
+	mRecordingFile.close();
+}
+
+bool InputHandler::IsRecording() const
+{
+	return mRecordingFile.is_open();
+}
+
+bool InputHandler::StartReplay(std::string const& filename)
+{
+	std::ifstream file(filename, std::ios::binary);
+	if (!file.is_open()) {
+		LogError("Failed to open the input recording “%s”.", filename.c_str());
+		return false;
+	}
+	std::vector<char> const data{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+	size_t offset = recording_magic.size() + 1u;
+	if (data.size() < offset
+	    || !std::equal(recording_magic.begin(), recording_magic.end(), data.begin())
+	    || static_cast<std::uint8_t>(data[recording_magic.size()]) != recording_version) {
+		LogError("“%s” is not an input recording, or was made by an incompatible version.", filename.c_str());
+		return false;
+	}
+
+	std::vector<Event> events;
+	std::uint64_t tick = 0ULL;
+	std::int32_t ui_capture = 0;
+	bool has_gui_interactions = false;
+	while (offset < data.size()) {
+		Event event;
+		std::uint64_t tick_delta = 0ULL;
+		std::uint8_t type = 0u;
+		bool is_valid = readUnsigned(data, offset, tick_delta)
+		             && readByte(data, offset, type)
+		             && type < static_cast<std::uint8_t>(EventType::Count);
+		if (is_valid) {
+			tick += tick_delta;
+			event.tick = tick;
+			event.type = static_cast<EventType>(type);
+			switch (event.type)
+			{
+				case EventType::Keyboard:
+					is_valid = readSigned(data, offset, event.key)
+					        && readSigned(data, offset, event.scancode)
+					        && readSigned(data, offset, event.action);
+					break;
+				case EventType::MouseButtons:
+					is_valid = readSigned(data, offset, event.key)
+					        && readSigned(data, offset, event.action);
+					break;
+				case EventType::MouseMotion:
+					is_valid = readFloat(data, offset, event.position.x)
+					        && readFloat(data, offset, event.position.y);
+					break;
+				case EventType::UICapture:
+					is_valid = readSigned(data, offset, event.action);
+					break;
+				case EventType::End:
+					break;
+				default:
+					is_valid = false;
+					break;
+			}
+		}
+		if (!is_valid) {
+			LogError("The input recording “%s” is truncated or corrupted.", filename.c_str());
+			return false;
+		}
+
+		// A button or key pressed while Dear ImGui wanted that device went
+		// to the GUI, which only ever sees live inputs.
+		if (event.type == EventType::UICapture)
+			ui_capture = event.action;
+		else if (event.type == EventType::MouseButtons && event.action == GLFW_PRESS)
+			has_gui_interactions |= (ui_capture & 1) != 0;
+		else if (event.type == EventType::Keyboard && event.action == GLFW_PRESS)
+			has_gui_interactions |= (ui_capture & 2) != 0;
+
+		events.push_back(event);
+	}
+	if (has_gui_interactions) {
+		LogError("The input recording “%s” contains interactions with the GUI, which cannot be replayed.", filename.c_str());
+		return false;
+	}
+
+	mReplayEvents = std::move(events);
+	mNextReplayEvent = 0u;
+	mReplayStartTick = mTick;
+	mIsReplaying = true;
+
+	LogInfo("Replaying %zu input events over %llu ticks from “%s”.", mReplayEvents.size(),
+	        static_cast<unsigned long long>(tick + 1ULL), filename.c_str());
+	return true;
+}
+
+bool InputHandler::IsReplaying() const
+{
+	return mIsReplaying;
+}
+
+bool InputHandler::IsReplayFinished() const
+{
+	return mIsReplaying && mNextReplayEvent == mReplayEvents.size();
 }
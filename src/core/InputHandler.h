@@ -2,7 +2,11 @@
 
 #include <array>
 #include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
@@ -26,6 +30,7 @@ public:
 
 public:
 	InputHandler();
+	~InputHandler();
 
 public:
 	void FeedKeyboard(int key, int scancode, int action);
@@ -41,13 +46,63 @@ public:
 	bool IsKeyboardCapturedByUI() const;
 	void SetUICapture(bool mouseCapture, bool keyboardCapture);
 
+	//! \brief Write all events fed from now on to a file, tagged with the
+	//!        tick they were fed at.
+	//!
+	//! The UI capture state is recorded as well, as it changes how the
+	//! assignments react to the other events.
+	//!
+	//! @param [in] filename file to write the recording to
+	//! @return whether the file could be opened
+	bool StartRecording(std::string const& filename);
+	void StopRecording();
+	bool IsRecording() const;
+
+	//! \brief Feed back the events of a recording, on the same ticks
+	//!        (counted from the start of the replay) as they were
+	//!        recorded on; live events are ignored from then on.
+	//!
+	//! Combined with a fixed time step, this makes a session replay
+	//! identically. The events are not forwarded to Dear ImGui, so
+	//! recordings where a mouse button or a key was pressed while the GUI
+	//! had captured it are refused rather than replayed differently.
+	//!
+	//! @param [in] filename file to read the recording from
+	//! @return whether the file could be read and was valid
+	bool StartReplay(std::string const& filename);
+	bool IsReplaying() const;
+
+	//! \brief Whether all events of the replay have been fed back, and
+	//!        the tick the recording was stopped at has been reached.
+	bool IsReplayFinished() const;
+
 private:
 	using InputStateMap = std::unordered_map<size_t, IState>;
 
+	enum class EventType : std::uint8_t {
+		Keyboard = 0u,
+		MouseButtons,
+		MouseMotion,
+		UICapture,
+		End,       //!< tick the recording was stopped at
+		Count
+	};
+	struct Event {
+		std::uint64_t tick{ 0ULL };
+		EventType type{ EventType::Keyboard };
+		std::int32_t key{ 0 };      //!< key for keyboard events, button for mouse ones
+		std::int32_t scancode{ 0 };
+		std::int32_t action{ 0 };   //!< for UI capture events, bit 0 is the mouse and bit 1 the keyboard
+		glm::vec2 position{ 0.0f };
+	};
+
 	void DownEvent(InputStateMap& map, size_t loc);
 	void UpEvent(InputStateMap& map, size_t loc);
 	std::uint32_t GetState(InputStateMap const& map, size_t loc);
 
+	void ProcessEvent(Event const& event);
+	void RecordEvent(Event const& event);
+
 	InputStateMap mScancodeMap;
 	InputStateMap mKeycodeMap;
 	InputStateMap mMouseMap;
@@ -60,5 +115,14 @@ private:
 
 	std::uint64_t mTick{ 0ULL };
 
+	std::ofstream mRecordingFile;
+	std::uint64_t mRecordingStartTick{ 0ULL };
+	std::uint64_t mLastRecordedTick{ 0ULL };
+
+	bool mIsReplaying{ false };
+	std::vector<Event> mReplayEvents;
+	size_t mNextReplayEvent{ 0u };
+	std::uint64_t mReplayStartTick{ 0ULL };
+
 };
 
@@ -0,0 +1,137 @@
+#include "MaterialBuffer.hpp"
+
+#include "core/Log.h"
+#include "core/opengl.hpp"
+
+#include <cassert>
+#include <unordered_set>
+
+namespace
+{
+	constexpr size_t initial_capacity = 64u;
+
+	// Programs are relinked on reload, and their names can be reused once
+	// deleted, so each link overwrites what was known about a name.
+	std::unordered_set<GLuint> programs_using_material_block;
+
+	bool areEqual(bonobo::material_data const& lhs, bonobo::material_data const& rhs)
+	{
+		return lhs.diffuse == rhs.diffuse
+		    && lhs.specular == rhs.specular
+		    && lhs.ambient == rhs.ambient
+		    && lhs.emissive == rhs.emissive
+		    && lhs.shininess == rhs.shininess
+		    && lhs.indexOfRefraction == rhs.indexOfRefraction
+		    && lhs.opacity == rhs.opacity;
+	}
+}
+
+constexpr GLuint MaterialBuffer::binding;
+constexpr size_t MaterialBuffer::invalid_slot;
+
+MaterialBuffer::MaterialBuffer()
+{
+	// Each slot has to start at an offset usable by glBindBufferRange().
+	GLint alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	auto const block_size = static_cast<GLsizeiptr>(sizeof(MaterialBlock));
+	auto const slot_alignment = static_cast<GLsizeiptr>(alignment > 0 ? alignment : 256);
+	mSlotStride = ((block_size + slot_alignment - 1) / slot_alignment) * slot_alignment;
+
+	Reallocate(initial_capacity);
+}
+
+MaterialBuffer::~MaterialBuffer()
+{
+	glDeleteBuffers(1, &mBuffer);
+	mBuffer = 0u;
+}
+
+size_t
+MaterialBuffer::Allocate()
+{
+	if (mConstants.size() == mCapacity)
+		Reallocate(mCapacity * 2u);
+
+	mConstants.emplace_back();
+	mIsUploaded.push_back(false);
+	return mConstants.size() - 1u;
+}
+
+bool
+MaterialBuffer::Update(size_t slot, bonobo::material_data const& constants)
+{
+	assert(slot < mConstants.size());
+
+	if (mIsUploaded[slot] && areEqual(mConstants[slot], constants))
+		return false;
+
+	MaterialBlock const block{
+		constants.diffuse, constants.shininess,
+		constants.specular, constants.indexOfRefraction,
+		constants.ambient, constants.opacity,
+		constants.emissive, 0.0f
+	};
+	glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(slot) * mSlotStride, sizeof(MaterialBlock), &block);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+
+	mConstants[slot] = constants;
+	mIsUploaded[slot] = true;
+	++mUploadsNb;
+	return true;
+}
+
+void
+MaterialBuffer::Bind(size_t slot) const
+{
+	assert(slot < mConstants.size());
+	glBindBufferRange(GL_UNIFORM_BUFFER, binding, mBuffer, static_cast<GLintptr>(slot) * mSlotStride, sizeof(MaterialBlock));
+}
+
+size_t
+MaterialBuffer::GetUploadsNb() const
+{
+	return mUploadsNb;
+}
+
+void
+MaterialBuffer::SetUpProgram(GLuint program)
+{
+	auto const block_index = glGetUniformBlockIndex(program, "Material");
+	if (block_index == GL_INVALID_INDEX) {
+		programs_using_material_block.erase(program);
+		return;
+	}
+
+	glUniformBlockBinding(program, block_index, binding);
+	programs_using_material_block.insert(program);
+}
+
+bool
+MaterialBuffer::IsUsedBy(GLuint program)
+{
+	return programs_using_material_block.find(program) != programs_using_material_block.end();
+}
+
+void
+MaterialBuffer::Reallocate(size_t capacity)
+{
+	GLuint buffer = 0u;
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(capacity) * mSlotStride, nullptr, GL_DYNAMIC_DRAW);
+
+	// Keep the slots which were already uploaded.
+	if (mBuffer != 0u) {
+		glBindBuffer(GL_COPY_READ_BUFFER, mBuffer);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(mCapacity) * mSlotStride);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0u);
+		glDeleteBuffers(1, &mBuffer);
+	}
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0u);
+
+	mBuffer = buffer;
+	mCapacity = capacity;
+	utils::opengl::debug::nameObject(GL_BUFFER, mBuffer, "Materials");
+}
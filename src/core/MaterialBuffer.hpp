@@ -0,0 +1,84 @@
+#pragma once
+
+#include "helpers.hpp"
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+//! \brief Uniform buffer shared by all materials, each one stored in its
+//!        own slot.
+//!
+//! A program selects a material by declaring the `Material` uniform block
+//! (see shaders/EDAF80/default.frag) and binding the range of that
+//! material's slot to `MaterialBuffer::binding`; the block itself is bound
+//! to that binding point once, when the program gets linked. A slot is
+//! only uploaded again when its constants actually changed.
+class MaterialBuffer
+{
+public:
+	//! \brief Uniform buffer binding point the `Material` block is bound to.
+	static constexpr GLuint binding = 7u;
+
+	//! \brief Value of a slot which has not been allocated yet.
+	static constexpr size_t invalid_slot = std::numeric_limits<size_t>::max();
+
+	MaterialBuffer();
+	~MaterialBuffer();
+
+	MaterialBuffer(MaterialBuffer const&) = delete;
+	MaterialBuffer& operator=(MaterialBuffer const&) = delete;
+
+	//! \brief Reserve a new slot, growing the buffer if needed.
+	//!
+	//! @return the index of the new slot
+	size_t Allocate();
+
+	//! \brief Upload the constants of a slot, if they differ from the
+	//!        ones previously uploaded.
+	//!
+	//! @return whether the constants had to be uploaded
+	bool Update(size_t slot, bonobo::material_data const& constants);
+
+	//! \brief Bind the range of a slot to `MaterialBuffer::binding`.
+	void Bind(size_t slot) const;
+
+	//! \brief Number of slots uploaded since the creation of the buffer.
+	size_t GetUploadsNb() const;
+
+	//! \brief Bind the `Material` block of a program to
+	//!        `MaterialBuffer::binding`, if it declares one; called by
+	//!        `utils::opengl::shader::link_program()` after each link.
+	//!
+	//! @param [in] program successfully linked OpenGL shader program
+	static void SetUpProgram(GLuint program);
+
+	//! \brief Whether a program declared the `Material` block when it was
+	//!        last linked.
+	static bool IsUsedBy(GLuint program);
+
+private:
+	//! \brief std140 layout of the `Material` uniform block.
+	struct MaterialBlock
+	{
+		glm::vec3 diffuse;
+		float shininess;
+		glm::vec3 specular;
+		float index_of_refraction;
+		glm::vec3 ambient;
+		float opacity;
+		glm::vec3 emissive;
+		float padding;
+	};
+
+	void Reallocate(size_t capacity);
+
+	GLuint mBuffer{ 0u };
+	GLsizeiptr mSlotStride{ 0 };
+	size_t mCapacity{ 0u };
+	std::vector<bonobo::material_data> mConstants;
+	std::vector<bool> mIsUploaded;
+	size_t mUploadsNb{ 0u };
+};
@@ -0,0 +1,433 @@
+#include "OcclusionCuller.hpp"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define OCCLUSION_CULLER_USE_SSE2 1
+#	include <emmintrin.h>
+#else
+#	define OCCLUSION_CULLER_USE_SSE2 0
+#endif
+
+namespace
+{
+	// Vertices closer than this (in clip-space w) are considered to be
+	// behind the near plane.
+	constexpr float min_w = 1e-5f;
+}
+
+constexpr int OcclusionCuller::tile_width;
+constexpr int OcclusionCuller::tile_height;
+constexpr int OcclusionCuller::block_size;
+
+OcclusionCuller::OcclusionCuller(int width, int height, size_t worker_threads_nb)
+{
+	static_assert(tile_width % block_size == 0 && tile_height % block_size == 0, "Tiles should be made of whole blocks.");
+	static_assert(block_size % 4 == 0, "Blocks should be made of whole groups of four pixels.");
+
+	mTilesX = std::max((width + tile_width - 1) / tile_width, 1);
+	mTilesY = std::max((height + tile_height - 1) / tile_height, 1);
+	mWidth = mTilesX * tile_width;
+	mHeight = mTilesY * tile_height;
+	mBlocksX = mWidth / block_size;
+	mBlocksY = mHeight / block_size;
+
+	mDepths.resize(static_cast<size_t>(mWidth) * static_cast<size_t>(mHeight), 1.0f);
+	mBlockMaxDepths.resize(static_cast<size_t>(mBlocksX) * static_cast<size_t>(mBlocksY), 1.0f);
+	mTileBins.resize(static_cast<size_t>(mTilesX) * static_cast<size_t>(mTilesY));
+
+	mWorkers.reserve(worker_threads_nb);
+	for (size_t i = 0; i < worker_threads_nb; ++i)
+		mWorkers.emplace_back(&OcclusionCuller::WorkerLoop, this);
+}
+
+OcclusionCuller::~OcclusionCuller()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mIsStopping = true;
+	}
+	mWorkAvailable.notify_all();
+	for (auto& worker : mWorkers)
+		worker.join();
+}
+
+void
+OcclusionCuller::AddOccluder(std::vector<glm::vec3> const& positions, std::vector<std::uint32_t> const& indices)
+{
+	assert(indices.size() % 3u == 0u);
+
+	auto const first_vertex = static_cast<std::uint32_t>(mOccluderPositions.size());
+	mOccluderPositions.insert(mOccluderPositions.end(), positions.begin(), positions.end());
+	mOccluderIndices.reserve(mOccluderIndices.size() + indices.size());
+	for (auto const index : indices)
+		mOccluderIndices.push_back(first_vertex + index);
+}
+
+void
+OcclusionCuller::ClearOccluders()
+{
+	mOccluderPositions.clear();
+	mOccluderIndices.clear();
+}
+
+void
+OcclusionCuller::Rasterize(glm::mat4 const& world_to_clip)
+{
+	PROFILE_FUNCTION();
+	auto const start_time = std::chrono::high_resolution_clock::now();
+
+	mStats = Stats();
+	mStats.occluder_triangles_nb = mOccluderIndices.size() / 3u;
+	mWorldToClip = world_to_clip;
+
+	std::fill(mDepths.begin(), mDepths.end(), 1.0f);
+	SetUpTriangles(world_to_clip);
+	RasterizeTiles();
+
+	mStats.rasterization_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start_time).count();
+}
+
+bool
+OcclusionCuller::IsVisible(glm::vec3 const& min, glm::vec3 const& max)
+{
+	++mStats.tested_boxes_nb;
+
+	//
+	// Project the corners, and bail out early if the box crosses the near
+	// plane or lies entirely outside of one of the frustum planes.
+	//
+	glm::vec2 screen_min(std::numeric_limits<float>::max());
+	glm::vec2 screen_max(std::numeric_limits<float>::lowest());
+	float depth_min = std::numeric_limits<float>::max();
+	std::array<int, 6> outside_counts{ 0, 0, 0, 0, 0, 0 };
+	bool crosses_near_plane = false;
+	for (int corner = 0; corner < 8; ++corner) {
+		glm::vec4 const position((corner & 1) ? max.x : min.x,
+		                         (corner & 2) ? max.y : min.y,
+		                         (corner & 4) ? max.z : min.z,
+		                         1.0f);
+		auto const clip = mWorldToClip * position;
+		for (int axis = 0; axis < 3; ++axis) {
+			outside_counts[2 * axis + 0] += clip[axis] < -clip.w ? 1 : 0;
+			outside_counts[2 * axis + 1] += clip[axis] > clip.w ? 1 : 0;
+		}
+		if (clip.w <= min_w) {
+			crosses_near_plane = true;
+			continue;
+		}
+
+		auto const ndc = glm::vec3(clip) / clip.w;
+		screen_min = glm::min(screen_min, glm::vec2(ndc));
+		screen_max = glm::max(screen_max, glm::vec2(ndc));
+		depth_min = std::min(depth_min, ndc.z * 0.5f + 0.5f);
+	}
+	for (auto const count : outside_counts) {
+		if (count == 8) {
+			++mStats.culled_boxes_nb;
+			return false;
+		}
+	}
+	if (crosses_near_plane)
+		return true;
+
+	// Occluders cover whole pixels as soon as they cover their centres, so
+	// the pixels touched by the box are dilated by one pixel: the parts of
+	// the box seen past the silhouette of an occluder then get tested.
+	auto const x0 = std::max(static_cast<int>(std::floor((screen_min.x * 0.5f + 0.5f) * static_cast<float>(mWidth))) - 1, 0);
+	auto const y0 = std::max(static_cast<int>(std::floor((screen_min.y * 0.5f + 0.5f) * static_cast<float>(mHeight))) - 1, 0);
+	auto const x1 = std::min(static_cast<int>(std::floor((screen_max.x * 0.5f + 0.5f) * static_cast<float>(mWidth))) + 1, mWidth - 1);
+	auto const y1 = std::min(static_cast<int>(std::floor((screen_max.y * 0.5f + 0.5f) * static_cast<float>(mHeight))) + 1, mHeight - 1);
+	if (x0 > x1 || y0 > y1) {
+		++mStats.culled_boxes_nb;
+		return false;
+	}
+
+	//
+	// The box is visible as soon as one of the pixels it covers is
+	// farther than its closest point; blocks whose farthest depth is in
+	// front of the box can be skipped altogether.
+	//
+	for (int by = y0 / block_size; by <= y1 / block_size; ++by) {
+		for (int bx = x0 / block_size; bx <= x1 / block_size; ++bx) {
+			if (mBlockMaxDepths[static_cast<size_t>(by * mBlocksX + bx)] < depth_min)
+				continue;
+
+			auto const px0 = std::max(x0, bx * block_size);
+			auto const px1 = std::min(x1, bx * block_size + block_size - 1);
+			auto const py0 = std::max(y0, by * block_size);
+			auto const py1 = std::min(y1, by * block_size + block_size - 1);
+			for (int y = py0; y <= py1; ++y) {
+				auto const* row = mDepths.data() + static_cast<size_t>(y) * static_cast<size_t>(mWidth);
+#if OCCLUSION_CULLER_USE_SSE2
+				auto const depth_min_4 = _mm_set1_ps(depth_min);
+				auto const x_range_min = _mm_set1_epi32(px0 - 1);
+				auto const x_range_max = _mm_set1_epi32(px1 + 1);
+				for (int x = px0 & ~3; x <= px1; x += 4) {
+					auto const xs = _mm_add_epi32(_mm_set1_epi32(x), _mm_setr_epi32(0, 1, 2, 3));
+					auto const in_range = _mm_and_si128(_mm_cmpgt_epi32(xs, x_range_min), _mm_cmplt_epi32(xs, x_range_max));
+					auto const is_farther = _mm_castps_si128(_mm_cmpge_ps(_mm_loadu_ps(row + x), depth_min_4));
+					if (_mm_movemask_epi8(_mm_and_si128(in_range, is_farther)) != 0)
+						return true;
+				}
+#else
+				for (int x = px0; x <= px1; ++x)
+					if (row[x] >= depth_min)
+						return true;
+#endif
+			}
+		}
+	}
+
+	++mStats.culled_boxes_nb;
+	return false;
+}
+
+OcclusionCuller::Stats const&
+OcclusionCuller::GetStats() const
+{
+	return mStats;
+}
+
+int
+OcclusionCuller::GetWidth() const
+{
+	return mWidth;
+}
+
+int
+OcclusionCuller::GetHeight() const
+{
+	return mHeight;
+}
+
+float const*
+OcclusionCuller::GetDepthBuffer() const
+{
+	return mDepths.data();
+}
+
+void
+OcclusionCuller::SetUpTriangles(glm::mat4 const& world_to_clip)
+{
+	PROFILE_FUNCTION();
+	mClipPositions.resize(mOccluderPositions.size());
+	for (size_t i = 0; i < mOccluderPositions.size(); ++i)
+		mClipPositions[i] = world_to_clip * glm::vec4(mOccluderPositions[i], 1.0f);
+
+	mTriangles.clear();
+	for (auto& bin : mTileBins)
+		bin.clear();
+
+	auto const half_size = glm::vec2(static_cast<float>(mWidth), static_cast<float>(mHeight)) * 0.5f;
+	for (size_t i = 0; i + 2u < mOccluderIndices.size(); i += 3u) {
+		std::array<glm::vec4, 3> const clip = {
+			mClipPositions[mOccluderIndices[i + 0u]],
+			mClipPositions[mOccluderIndices[i + 1u]],
+			mClipPositions[mOccluderIndices[i + 2u]]
+		};
+
+		// Rather than clipping triangles crossing the near plane, drop
+		// them: missing occluders only make the culling less effective.
+		if (clip[0].w <= min_w || clip[1].w <= min_w || clip[2].w <= min_w)
+			continue;
+		bool is_outside = false;
+		for (int axis = 0; axis < 3 && !is_outside; ++axis) {
+			is_outside = (clip[0][axis] < -clip[0].w && clip[1][axis] < -clip[1].w && clip[2][axis] < -clip[2].w)
+			          || (clip[0][axis] >  clip[0].w && clip[1][axis] >  clip[1].w && clip[2][axis] >  clip[2].w);
+		}
+		if (is_outside)
+			continue;
+
+		std::array<glm::vec3, 3> screen;
+		for (size_t v = 0; v < 3u; ++v) {
+			auto const ndc = glm::vec3(clip[v]) / clip[v].w;
+			screen[v] = glm::vec3((glm::vec2(ndc) + 1.0f) * half_size, ndc.z * 0.5f + 0.5f);
+		}
+
+		// Both windings are rasterized, with counter-clockwise edges.
+		auto area = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y)
+		          - (screen[2].x - screen[0].x) * (screen[1].y - screen[0].y);
+		if (area < 0.0f) {
+			std::swap(screen[1], screen[2]);
+			area = -area;
+		}
+		if (area < 1e-6f)
+			continue;
+
+		Triangle triangle;
+		triangle.min_x = std::max(static_cast<int>(std::floor(std::min({ screen[0].x, screen[1].x, screen[2].x }))), 0);
+		triangle.min_y = std::max(static_cast<int>(std::floor(std::min({ screen[0].y, screen[1].y, screen[2].y }))), 0);
+		triangle.max_x = std::min(static_cast<int>(std::ceil(std::max({ screen[0].x, screen[1].x, screen[2].x }))), mWidth - 1);
+		triangle.max_y = std::min(static_cast<int>(std::ceil(std::max({ screen[0].y, screen[1].y, screen[2].y }))), mHeight - 1);
+		if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y)
+			continue;
+
+		for (size_t e = 0; e < 3u; ++e) {
+			auto const& from = screen[e];
+			auto const& to = screen[(e + 1u) % 3u];
+			triangle.edge_a[e] = from.y - to.y;
+			triangle.edge_b[e] = to.x - from.x;
+			triangle.edge_c[e] = -(triangle.edge_a[e] * from.x + triangle.edge_b[e] * from.y);
+		}
+
+		auto const dx1 = screen[1].x - screen[0].x, dy1 = screen[1].y - screen[0].y, dz1 = screen[1].z - screen[0].z;
+		auto const dx2 = screen[2].x - screen[0].x, dy2 = screen[2].y - screen[0].y, dz2 = screen[2].z - screen[0].z;
+		triangle.depth_dx = (dz1 * dy2 - dz2 * dy1) / area;
+		triangle.depth_dy = (dx1 * dz2 - dx2 * dz1) / area;
+		triangle.depth_c = screen[0].z - triangle.depth_dx * screen[0].x - triangle.depth_dy * screen[0].y;
+
+		auto const triangle_index = static_cast<std::uint32_t>(mTriangles.size());
+		mTriangles.push_back(triangle);
+		for (int ty = triangle.min_y / tile_height; ty <= triangle.max_y / tile_height; ++ty)
+			for (int tx = triangle.min_x / tile_width; tx <= triangle.max_x / tile_width; ++tx)
+				mTileBins[static_cast<size_t>(ty * mTilesX + tx)].push_back(triangle_index);
+	}
+	mStats.rasterized_triangles_nb = mTriangles.size();
+}
+
+void
+OcclusionCuller::RasterizeTiles()
+{
+	PROFILE_FUNCTION();
+	mNextTile.store(0u);
+	if (!mWorkers.empty()) {
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			++mGeneration;
+			mBusyWorkersNb = mWorkers.size();
+		}
+		mWorkAvailable.notify_all();
+	}
+
+	// The calling thread takes its share of the tiles as well.
+	for (auto tile = mNextTile.fetch_add(1u); tile < mTileBins.size(); tile = mNextTile.fetch_add(1u))
+		RasterizeTile(tile);
+
+	if (!mWorkers.empty()) {
+		std::unique_lock<std::mutex> lock(mMutex);
+		mWorkDone.wait(lock, [this](){ return mBusyWorkersNb == 0u; });
+	}
+}
+
+void
+OcclusionCuller::RasterizeTile(size_t tile)
+{
+	auto const tile_x0 = static_cast<int>(tile % static_cast<size_t>(mTilesX)) * tile_width;
+	auto const tile_y0 = static_cast<int>(tile / static_cast<size_t>(mTilesX)) * tile_height;
+	auto const tile_x1 = tile_x0 + tile_width - 1;
+	auto const tile_y1 = tile_y0 + tile_height - 1;
+
+	for (auto const triangle_index : mTileBins[tile]) {
+		auto const& triangle = mTriangles[triangle_index];
+		auto const x0 = std::max(triangle.min_x, tile_x0);
+		auto const x1 = std::min(triangle.max_x, tile_x1);
+		auto const y0 = std::max(triangle.min_y, tile_y0);
+		auto const y1 = std::min(triangle.max_y, tile_y1);
+
+		for (int y = y0; y <= y1; ++y) {
+			auto* row = mDepths.data() + static_cast<size_t>(y) * static_cast<size_t>(mWidth);
+			auto const py = static_cast<float>(y) + 0.5f;
+#if OCCLUSION_CULLER_USE_SSE2
+			// Pixels are processed four at a time, starting from a
+			// multiple of four; as tiles are as well, the pixels before
+			// `x0` are still within the tile, and outside the triangle.
+			auto const start_x = x0 & ~3;
+			auto const px = _mm_add_ps(_mm_set1_ps(static_cast<float>(start_x) + 0.5f), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+			__m128 edges[3];
+			__m128 edge_steps[3];
+			for (size_t e = 0; e < 3u; ++e) {
+				edges[e] = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edge_a[e]), px),
+				                      _mm_set1_ps(triangle.edge_b[e] * py + triangle.edge_c[e]));
+				edge_steps[e] = _mm_set1_ps(4.0f * triangle.edge_a[e]);
+			}
+			auto depth = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.depth_dx), px),
+			                        _mm_set1_ps(triangle.depth_dy * py + triangle.depth_c));
+			auto const depth_step = _mm_set1_ps(4.0f * triangle.depth_dx);
+			auto const zero = _mm_setzero_ps();
+			auto const one = _mm_set1_ps(1.0f);
+
+			for (int x = start_x; x <= x1; x += 4) {
+				auto const is_inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(edges[0], zero), _mm_cmpge_ps(edges[1], zero)),
+				                                  _mm_cmpge_ps(edges[2], zero));
+				if (_mm_movemask_ps(is_inside) != 0) {
+					auto const current = _mm_loadu_ps(row + x);
+					auto const clamped_depth = _mm_min_ps(_mm_max_ps(depth, zero), one);
+					auto const closest = _mm_min_ps(current, clamped_depth);
+					_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(is_inside, closest), _mm_andnot_ps(is_inside, current)));
+				}
+				for (size_t e = 0; e < 3u; ++e)
+					edges[e] = _mm_add_ps(edges[e], edge_steps[e]);
+				depth = _mm_add_ps(depth, depth_step);
+			}
+#else
+			for (int x = x0; x <= x1; ++x) {
+				auto const px = static_cast<float>(x) + 0.5f;
+				bool is_inside = true;
+				for (size_t e = 0; e < 3u; ++e)
+					is_inside = is_inside && triangle.edge_a[e] * px + triangle.edge_b[e] * py + triangle.edge_c[e] >= 0.0f;
+				if (!is_inside)
+					continue;
+				auto const depth = std::min(std::max(triangle.depth_dx * px + triangle.depth_dy * py + triangle.depth_c, 0.0f), 1.0f);
+				row[x] = std::min(row[x], depth);
+			}
+#endif
+		}
+	}
+
+	//
+	// Update the coarser level for the blocks of this tile.
+	//
+	for (int by = tile_y0 / block_size; by <= tile_y1 / block_size; ++by) {
+		for (int bx = tile_x0 / block_size; bx <= tile_x1 / block_size; ++bx) {
+			auto max_depth = 0.0f;
+			for (int y = by * block_size; y < (by + 1) * block_size; ++y) {
+				auto const* row = mDepths.data() + static_cast<size_t>(y) * static_cast<size_t>(mWidth);
+#if OCCLUSION_CULLER_USE_SSE2
+				auto row_max = _mm_loadu_ps(row + bx * block_size);
+				for (int x = 4; x < block_size; x += 4)
+					row_max = _mm_max_ps(row_max, _mm_loadu_ps(row + bx * block_size + x));
+				alignas(16) std::array<float, 4> lanes;
+				_mm_store_ps(lanes.data(), row_max);
+				max_depth = std::max({ max_depth, lanes[0], lanes[1], lanes[2], lanes[3] });
+#else
+				for (int x = bx * block_size; x < (bx + 1) * block_size; ++x)
+					max_depth = std::max(max_depth, row[x]);
+#endif
+			}
+			mBlockMaxDepths[static_cast<size_t>(by * mBlocksX + bx)] = max_depth;
+		}
+	}
+}
+
+void
+OcclusionCuller::WorkerLoop()
+{
+	PROFILE_THREAD("Occlusion culler worker");
+
+	std::uint64_t last_generation = 0u;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWorkAvailable.wait(lock, [this, last_generation](){ return mIsStopping || mGeneration != last_generation; });
+			if (mIsStopping)
+				return;
+			last_generation = mGeneration;
+		}
+
+		PROFILE_SCOPE("RasterizeTiles");
+		for (auto tile = mNextTile.fetch_add(1u); tile < mTileBins.size(); tile = mNextTile.fetch_add(1u))
+			RasterizeTile(tile);
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			--mBusyWorkersNb;
+		}
+		mWorkDone.notify_one();
+	}
+}
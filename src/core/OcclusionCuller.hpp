@@ -0,0 +1,138 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! \brief Software occlusion culling, on the CPU.
+//!
+//! A small set of occluders is rasterized into a low-resolution depth
+//! buffer, against which the bounding boxes of the objects to draw are
+//! then tested; boxes which are entirely hidden, or outside of the view
+//! frustum, can be skipped by the GPU passes.
+//!
+//! The depth buffer is split into tiles, rasterized in parallel by a pool
+//! of worker threads, four pixels at a time with SSE2 when available. The
+//! maximum depth of each block of `block_size`×`block_size` pixels is kept
+//! as a coarser level, so that most boxes can be rejected without looking
+//! at individual pixels.
+//!
+//! Occluders are rasterized by sampling pixel centres, so an occluder
+//! partially covering a pixel hides whatever is behind that whole pixel.
+//! To stay conservative, the boxes are dilated by one pixel before being
+//! tested; gaps between occluders narrower than a pixel are still seen
+//! as closed, so meshes with small holes, such as grates, make poor
+//! occluders.
+class OcclusionCuller
+{
+public:
+	static constexpr int tile_width = 32;
+	static constexpr int tile_height = 32;
+	static constexpr int block_size = 8;
+
+	struct Stats {
+		size_t occluder_triangles_nb{ 0u }; //!< triangles submitted
+		size_t rasterized_triangles_nb{ 0u }; //!< triangles left after near plane and frustum culling
+		size_t tested_boxes_nb{ 0u };
+		size_t culled_boxes_nb{ 0u };
+		float rasterization_ms{ 0.0f };
+	};
+
+	//! \brief Create the depth buffer and start the worker threads.
+	//!
+	//! @param [in] width width of the depth buffer, rounded up to a
+	//!             multiple of `tile_width`
+	//! @param [in] height height of the depth buffer, rounded up to a
+	//!             multiple of `tile_height`
+	//! @param [in] worker_threads_nb threads rasterizing tiles along with
+	//!             the calling thread; 0 rasterizes everything on the
+	//!             calling thread.
+	OcclusionCuller(int width, int height, size_t worker_threads_nb);
+	~OcclusionCuller();
+
+	OcclusionCuller(OcclusionCuller const&) = delete;
+	OcclusionCuller& operator=(OcclusionCuller const&) = delete;
+
+	//! \brief Register an occluder.
+	//!
+	//! @param [in] positions world-space positions of the vertices
+	//! @param [in] indices three indices per triangle
+	void AddOccluder(std::vector<glm::vec3> const& positions, std::vector<std::uint32_t> const& indices);
+	void ClearOccluders();
+
+	//! \brief Clear the depth buffer, and rasterize all occluders into it.
+	//!
+	//! @param [in] world_to_clip transform of the view the visibility is
+	//!             tested for, following OpenGL's clip-space conventions
+	void Rasterize(glm::mat4 const& world_to_clip);
+
+	//! \brief Whether a world-space axis-aligned box might be visible from
+	//!        the view given to the latest call to `Rasterize()`.
+	//!
+	//! The test is conservative: boxes crossing the near plane are always
+	//! considered visible.
+	bool IsVisible(glm::vec3 const& min, glm::vec3 const& max);
+
+	//! \brief Statistics of the latest call to `Rasterize()`, and of the
+	//!        tests done since.
+	Stats const& GetStats() const;
+
+	int GetWidth() const;
+	int GetHeight() const;
+
+	//! \brief Depths in [0, 1], row by row starting from the bottom.
+	float const* GetDepthBuffer() const;
+
+private:
+	struct Triangle {
+		std::array<float, 3> edge_a; //!< edge functions: a * x + b * y + c >= 0 inside
+		std::array<float, 3> edge_b;
+		std::array<float, 3> edge_c;
+		float depth_c;               //!< depth plane: depth_dx * x + depth_dy * y + depth_c
+		float depth_dx;
+		float depth_dy;
+		int min_x, min_y, max_x, max_y; //!< inclusive pixel bounds
+	};
+
+	void SetUpTriangles(glm::mat4 const& world_to_clip);
+	void RasterizeTiles();
+	void RasterizeTile(size_t tile);
+	void WorkerLoop();
+
+	int mWidth{ 0 };
+	int mHeight{ 0 };
+	int mTilesX{ 0 };
+	int mTilesY{ 0 };
+	int mBlocksX{ 0 };
+	int mBlocksY{ 0 };
+	std::vector<float> mDepths;
+	std::vector<float> mBlockMaxDepths;
+
+	std::vector<glm::vec3> mOccluderPositions;
+	std::vector<std::uint32_t> mOccluderIndices;
+
+	glm::mat4 mWorldToClip{ 1.0f };
+	std::vector<glm::vec4> mClipPositions;
+	std::vector<Triangle> mTriangles;
+	std::vector<std::vector<std::uint32_t>> mTileBins;
+
+	Stats mStats;
+
+	// Worker threads wait for a new generation of work, then grab tiles
+	// until none are left.
+	std::vector<std::thread> mWorkers;
+	std::mutex mMutex;
+	std::condition_variable mWorkAvailable;
+	std::condition_variable mWorkDone;
+	std::uint64_t mGeneration{ 0u };
+	size_t mBusyWorkersNb{ 0u };
+	bool mIsStopping{ false };
+	std::atomic<size_t> mNextTile{ 0u };
+};
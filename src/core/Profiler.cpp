@@ -0,0 +1,397 @@
+#include "Profiler.h"
+
+#include "Log.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+	// 32 bytes per event, so 2 MiB per thread.
+	constexpr std::uint64_t events_per_thread_nb = 1u << 16;
+	constexpr size_t frames_kept_nb = 64u;
+
+	// GPU events are only read back a few frames after being issued, so
+	// the window lags behind by as many frames to show them.
+	constexpr std::uint64_t displayed_frame_delay = 4u;
+
+	struct Event {
+		char const* name{ nullptr };
+		std::int64_t begin_time{ 0 }; // in ns
+		std::int64_t end_time{ 0 };   // in ns
+		std::uint32_t depth{ 0u };
+	};
+
+	// Storage of an event in the ring buffer of a thread; readers might
+	// load it while its owner overwrites it, hence the atomics.
+	struct EventSlot {
+		std::atomic<char const*> name{ nullptr };
+		std::atomic<std::int64_t> begin_time{ 0 };
+		std::atomic<std::int64_t> end_time{ 0 };
+		std::atomic<std::uint32_t> depth{ 0u };
+	};
+
+	// Only the owning thread writes to the events; it publishes them by
+	// incrementing `written_nb`. Readers copy the events, then check which
+	// ones might have been overwritten meanwhile and discard them, as in a
+	// sequence lock.
+	struct ThreadBuffer {
+		std::array<EventSlot, events_per_thread_nb> events;
+		std::atomic<std::uint64_t> written_nb{ 0u };
+		std::atomic<char const*> name{ nullptr };
+		std::uint32_t depth{ 0u };
+		std::uint32_t id{ 0u };
+	};
+
+	struct Registry {
+		std::mutex mutex; // guards the lists, not the events
+		std::vector<std::unique_ptr<ThreadBuffer>> threads;
+		ThreadBuffer* gpu_buffer{ nullptr }; // also part of `threads`
+		std::unordered_set<std::string> names; // references to elements are stable
+
+		// Only accessed by the main thread.
+		std::array<std::int64_t, frames_kept_nb> frame_start_times;
+		std::uint64_t frames_nb{ 0u };
+	};
+
+	Registry& getRegistry()
+	{
+		static Registry registry;
+		return registry;
+	}
+
+	thread_local ThreadBuffer* current_thread_buffer = nullptr;
+
+	// The registry's mutex has to be held.
+	ThreadBuffer* createThreadBuffer(Registry& registry)
+	{
+		registry.threads.push_back(std::make_unique<ThreadBuffer>());
+		auto buffer = registry.threads.back().get();
+		buffer->id = static_cast<std::uint32_t>(registry.threads.size());
+		return buffer;
+	}
+
+	ThreadBuffer& getThreadBuffer()
+	{
+		if (current_thread_buffer == nullptr) {
+			auto& registry = getRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			current_thread_buffer = createThreadBuffer(registry);
+		}
+		return *current_thread_buffer;
+	}
+
+	ThreadBuffer& getGpuBuffer()
+	{
+		auto& registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		if (registry.gpu_buffer == nullptr) {
+			registry.gpu_buffer = createThreadBuffer(registry);
+			registry.gpu_buffer->name.store("GPU", std::memory_order_release);
+		}
+		return *registry.gpu_buffer;
+	}
+
+	void pushEvent(ThreadBuffer& buffer, char const* name, std::int64_t begin_time, std::int64_t end_time, std::uint32_t depth) noexcept
+	{
+		auto const index = buffer.written_nb.load(std::memory_order_relaxed);
+		// A reader seeing any of the stores below is then guaranteed to
+		// also see the previous update of `written_nb`, which tells it
+		// that this slot is being overwritten.
+		std::atomic_thread_fence(std::memory_order_release);
+		auto& slot = buffer.events[index % events_per_thread_nb];
+		slot.name.store(name, std::memory_order_relaxed);
+		slot.begin_time.store(begin_time, std::memory_order_relaxed);
+		slot.end_time.store(end_time, std::memory_order_relaxed);
+		slot.depth.store(depth, std::memory_order_relaxed);
+		buffer.written_nb.store(index + 1u, std::memory_order_release);
+	}
+
+	std::vector<ThreadBuffer const*> getThreadBuffers()
+	{
+		auto& registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		std::vector<ThreadBuffer const*> buffers;
+		buffers.reserve(registry.threads.size());
+		for (auto const& thread : registry.threads)
+			buffers.push_back(thread.get());
+		return buffers;
+	}
+
+	std::int64_t now() noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// Copy the events of a thread overlapping [begin_time, end_time), or
+	// all of them when begin_time is negative.
+	std::vector<Event> readEvents(ThreadBuffer const& buffer, std::int64_t begin_time, std::int64_t end_time)
+	{
+		auto const written_nb = buffer.written_nb.load(std::memory_order_acquire);
+		auto const first_index = written_nb > events_per_thread_nb ? written_nb - events_per_thread_nb : 0u;
+
+		// Events are written when their scope ends, hence sorted by end
+		// time: walk back until they end before the requested range.
+		std::vector<Event> events;
+		std::vector<std::uint64_t> indices;
+		for (std::uint64_t index = written_nb; index > first_index; --index) {
+			auto const& slot = buffer.events[(index - 1u) % events_per_thread_nb];
+			Event event;
+			event.name = slot.name.load(std::memory_order_relaxed);
+			event.begin_time = slot.begin_time.load(std::memory_order_relaxed);
+			event.end_time = slot.end_time.load(std::memory_order_relaxed);
+			event.depth = slot.depth.load(std::memory_order_relaxed);
+			if (begin_time >= 0 && event.end_time < begin_time)
+				break;
+			if (begin_time < 0 || event.begin_time < end_time) {
+				events.push_back(event);
+				indices.push_back(index - 1u);
+			}
+		}
+
+		// Orders the copies above before the check below. Besides the
+		// slots overwritten since, the slot of the next event might be
+		// being overwritten right now.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		auto const overwritten_nb = buffer.written_nb.load(std::memory_order_relaxed);
+		auto const valid_first_index = overwritten_nb + 1u > events_per_thread_nb ? overwritten_nb + 1u - events_per_thread_nb : 0u;
+		// The indices are decreasing, so the invalid events are at the end.
+		while (!indices.empty() && indices.back() < valid_first_index) {
+			indices.pop_back();
+			events.pop_back();
+		}
+
+		std::reverse(events.begin(), events.end());
+		return events;
+	}
+
+	void writeJsonString(std::ostream& stream, char const* value)
+	{
+		stream << '"';
+		for (auto c = value; *c != '\0'; ++c) {
+			if (*c == '"' || *c == '\\')
+				stream << '\\' << *c;
+			else if (static_cast<unsigned char>(*c) < 0x20u)
+				stream << ' ';
+			else
+				stream << *c;
+		}
+		stream << '"';
+	}
+
+	ImU32 getColor(char const* name)
+	{
+		auto const hue = static_cast<float>(std::hash<std::string>()(name) % 360u) / 360.0f;
+		float r = 0.0f, g = 0.0f, b = 0.0f;
+		ImGui::ColorConvertHSVtoRGB(hue, 0.5f, 0.75f, r, g, b);
+		return ImGui::ColorConvertFloat4ToU32(ImVec4(r, g, b, 1.0f));
+	}
+
+	// What the window displays; kept while paused.
+	struct DisplayedFrame {
+		std::int64_t begin_time{ 0 };
+		std::int64_t end_time{ 0 };
+		std::vector<char const*> thread_names;
+		std::vector<std::vector<Event>> thread_events;
+	};
+}
+
+Profiler::Scope::Scope(char const* name) noexcept : mName(name)
+{
+	++getThreadBuffer().depth;
+	mBeginTime = now();
+}
+
+Profiler::Scope::~Scope() noexcept
+{
+	auto const end_time = now();
+	auto& buffer = *current_thread_buffer;
+	--buffer.depth;
+	pushEvent(buffer, mName, mBeginTime, end_time, buffer.depth);
+}
+
+std::int64_t Profiler::GetTime() noexcept
+{
+	return now();
+}
+
+void Profiler::AddGpuScope(char const* name, std::int64_t begin_time, std::int64_t end_time, std::uint32_t depth)
+{
+	static ThreadBuffer& gpu_buffer = getGpuBuffer();
+	pushEvent(gpu_buffer, name, begin_time, end_time, depth);
+}
+
+char const* Profiler::InternName(std::string const& name)
+{
+	auto& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	return registry.names.insert(name).first->c_str();
+}
+
+void Profiler::SetThreadName(char const* name)
+{
+	getThreadBuffer().name.store(name, std::memory_order_release);
+}
+
+void Profiler::NewFrame()
+{
+	auto& registry = getRegistry();
+	registry.frame_start_times[registry.frames_nb % frames_kept_nb] = now();
+	++registry.frames_nb;
+}
+
+bool Profiler::WriteChromeTrace(std::string const& filename)
+{
+	std::ofstream file(filename);
+	if (!file.is_open()) {
+		LogError("Failed to open “%s” for writing the trace.", filename.c_str());
+		return false;
+	}
+
+	auto& registry = getRegistry();
+	auto const buffers = getThreadBuffers();
+	ThreadBuffer const* gpu_buffer = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		gpu_buffer = registry.gpu_buffer;
+	}
+	std::vector<std::vector<Event>> thread_events;
+	std::int64_t origin = std::numeric_limits<std::int64_t>::max();
+	for (auto const buffer : buffers) {
+		thread_events.push_back(readEvents(*buffer, -1, 0));
+		if (!thread_events.back().empty())
+			origin = std::min(origin, thread_events.back().front().begin_time);
+	}
+	if (origin == std::numeric_limits<std::int64_t>::max())
+		origin = 0;
+
+	// Times are in µs, as expected by the format.
+	auto const to_us = [origin](std::int64_t time){ return static_cast<double>(time - origin) / 1000.0; };
+	file.precision(3);
+	file << std::fixed;
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool is_first = true;
+	for (size_t i = 0; i < buffers.size(); ++i) {
+		auto const tid = buffers[i]->id;
+		auto const category = buffers[i] == gpu_buffer ? "gpu" : "cpu";
+		auto const name = buffers[i]->name.load(std::memory_order_acquire);
+		if (name != nullptr) {
+			file << (is_first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":";
+			writeJsonString(file, name);
+			file << "}}";
+			is_first = false;
+		}
+		for (auto const& event : thread_events[i]) {
+			file << (is_first ? "" : ",\n") << "{\"name\":";
+			writeJsonString(file, event.name);
+			file << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+			     << ",\"ts\":" << to_us(event.begin_time)
+			     << ",\"dur\":" << static_cast<double>(event.end_time - event.begin_time) / 1000.0 << "}";
+			is_first = false;
+		}
+	}
+	auto const frames_nb = std::min<std::uint64_t>(registry.frames_nb, frames_kept_nb);
+	for (std::uint64_t i = registry.frames_nb - frames_nb; i < registry.frames_nb; ++i) {
+		auto const start_time = registry.frame_start_times[i % frames_kept_nb];
+		if (start_time < origin)
+			continue;
+		file << (is_first ? "" : ",\n") << "{\"name\":\"Frame " << i << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":" << to_us(start_time) << "}";
+		is_first = false;
+	}
+	file << "\n]}\n";
+
+	if (!file) {
+		LogError("Failed to write the trace to “%s”.", filename.c_str());
+		return false;
+	}
+	LogInfo("Trace written to “%s”.", filename.c_str());
+	return true;
+}
+
+void Profiler::RenderWindow()
+{
+	static DisplayedFrame displayed_frame;
+	static bool is_paused = false;
+
+	bool const opened = ImGui::Begin("Frame profiler", nullptr, ImGuiWindowFlags_None);
+	if (!opened) {
+		ImGui::End();
+		return;
+	}
+
+	auto const& registry = getRegistry();
+	if (!is_paused && registry.frames_nb > displayed_frame_delay) {
+		auto const frame = registry.frames_nb - displayed_frame_delay;
+		displayed_frame.begin_time = registry.frame_start_times[(frame - 1u) % frames_kept_nb];
+		displayed_frame.end_time = registry.frame_start_times[frame % frames_kept_nb];
+		displayed_frame.thread_names.clear();
+		displayed_frame.thread_events.clear();
+		for (auto const buffer : getThreadBuffers()) {
+			auto events = readEvents(*buffer, displayed_frame.begin_time, displayed_frame.end_time);
+			if (events.empty())
+				continue;
+			displayed_frame.thread_names.push_back(buffer->name.load(std::memory_order_acquire));
+			displayed_frame.thread_events.push_back(std::move(events));
+		}
+	}
+
+	ImGui::Checkbox("Pause", &is_paused);
+	ImGui::SameLine();
+	if (ImGui::Button("Export trace"))
+		WriteChromeTrace("frame_trace.json");
+	auto const frame_duration = displayed_frame.end_time - displayed_frame.begin_time;
+	ImGui::Text("Frame duration: %.3f ms", static_cast<float>(frame_duration) / 1000000.0f);
+	if (frame_duration <= 0) {
+		ImGui::End();
+		return;
+	}
+
+	auto* const draw_list = ImGui::GetWindowDrawList();
+	auto const row_height = ImGui::GetTextLineHeightWithSpacing();
+	auto const width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+	auto const frame_begin_time = displayed_frame.begin_time;
+	auto const frame_end_time = displayed_frame.end_time;
+	auto const to_x = [frame_begin_time, frame_end_time, frame_duration, width](std::int64_t time){
+		auto const clamped_time = std::min(std::max(time, frame_begin_time), frame_end_time);
+		return width * static_cast<float>(clamped_time - frame_begin_time) / static_cast<float>(frame_duration);
+	};
+	for (size_t i = 0; i < displayed_frame.thread_events.size(); ++i) {
+		auto const name = displayed_frame.thread_names[i];
+		ImGui::Text("%s", name != nullptr ? name : "Unnamed thread");
+
+		auto const& events = displayed_frame.thread_events[i];
+		std::uint32_t max_depth = 0u;
+		for (auto const& event : events)
+			max_depth = std::max(max_depth, event.depth);
+
+		auto const origin = ImGui::GetCursorScreenPos();
+		auto const mouse_position = ImGui::GetIO().MousePos;
+		for (auto const& event : events) {
+			auto const min = ImVec2(origin.x + to_x(event.begin_time), origin.y + static_cast<float>(event.depth) * row_height);
+			auto const max = ImVec2(std::max(origin.x + to_x(event.end_time), min.x + 1.0f), min.y + row_height - 1.0f);
+			draw_list->AddRectFilled(min, max, getColor(event.name));
+			if (max.x - min.x > ImGui::CalcTextSize(event.name).x) {
+				draw_list->PushClipRect(min, max, true);
+				draw_list->AddText(ImVec2(min.x + 2.0f, min.y), IM_COL32(0, 0, 0, 255), event.name);
+				draw_list->PopClipRect();
+			}
+			if (ImGui::IsWindowHovered() && mouse_position.x >= min.x && mouse_position.x < max.x
+			                             && mouse_position.y >= min.y && mouse_position.y < max.y)
+				ImGui::SetTooltip("%s: %.3f ms", event.name, static_cast<float>(event.end_time - event.begin_time) / 1000000.0f);
+		}
+		ImGui::Dummy(ImVec2(width, static_cast<float>(max_depth + 1u) * row_height));
+	}
+
+	ImGui::End();
+}
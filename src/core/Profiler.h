@@ -0,0 +1,104 @@
+/*
+ * Hierarchical CPU instrumentation profiler, with GPU times shown on the
+ * same timeline
+ */
+
+#pragma once
+
+#include "BuildSettings.h"
+
+#include <cstdint>
+#include <string>
+
+/*
+*	Scopes are timed by placing one of the following macros at their start:
+*
+*	- PROFILE_SCOPE("name"): the name has to outlive the profiler, e.g. a
+*	  string literal;
+*	- PROFILE_SCOPE_DYNAMIC(std_string): the name is copied once into a
+*	  table of names, which requires a lock, so prefer the previous one;
+*	- PROFILE_FUNCTION(): named after the enclosing function.
+*
+*	PROFILE_THREAD("name") names the calling thread in the traces, and
+*	PROFILE_NEW_FRAME() marks the start of a frame; it should be called by
+*	the main thread once per frame.
+*
+*	All of them compile to nothing when ENABLE_PROFILING is 0.
+*/
+#define PROFILER_CONCATENATE_IMPL(a, b)		a##b
+#define PROFILER_CONCATENATE(a, b)			PROFILER_CONCATENATE_IMPL(a, b)
+
+#if defined ENABLE_PROFILING && ENABLE_PROFILING != 0
+#	define PROFILE_SCOPE(name)				Profiler::Scope PROFILER_CONCATENATE(profiler_scope_, __LINE__)(name)
+#	define PROFILE_SCOPE_DYNAMIC(name)		Profiler::Scope PROFILER_CONCATENATE(profiler_scope_, __LINE__)(Profiler::InternName(name))
+#	define PROFILE_FUNCTION()				PROFILE_SCOPE(__FUNCTION__)
+#	define PROFILE_THREAD(name)				Profiler::SetThreadName(name)
+#	define PROFILE_NEW_FRAME()				Profiler::NewFrame()
+#else
+#	define PROFILE_SCOPE(name)
+#	define PROFILE_SCOPE_DYNAMIC(name)
+#	define PROFILE_FUNCTION()
+#	define PROFILE_THREAD(name)
+#	define PROFILE_NEW_FRAME()
+#endif
+
+namespace Profiler {
+
+//! \brief Time spent between its construction and its destruction.
+//!
+//! Each thread records its scopes into its own ring buffer, which only it
+//! writes to, so recording a scope never takes a lock; the buffers are
+//! read when displaying or exporting the events. The oldest events get
+//! overwritten once a buffer is full.
+class Scope {
+public:
+	explicit Scope(char const* name) noexcept;
+	~Scope() noexcept;
+
+	Scope(Scope const&) = delete;
+	Scope& operator=(Scope const&) = delete;
+
+private:
+	char const* mName;
+	std::int64_t mBeginTime;
+};
+
+//! \brief Current time of the clock used for all events, in ns.
+std::int64_t GetTime() noexcept;
+
+//! \brief Record a span of GPU work on the GPU row of the timeline.
+//!
+//! Only one thread, the one owning the OpenGL context, should call it, in
+//! increasing order of end times.
+//!
+//! @param [in] name name of the span, which has to outlive the profiler
+//! @param [in] begin_time start of the span, converted to `GetTime()`'s clock
+//! @param [in] end_time end of the span, converted to `GetTime()`'s clock
+//! @param [in] depth nesting level of the span
+void AddGpuScope(char const* name, std::int64_t begin_time, std::int64_t end_time, std::uint32_t depth);
+
+//! \brief Get a copy of a name which lives as long as the profiler, for
+//!        scopes named at runtime.
+char const* InternName(std::string const& name);
+
+//! \brief Name the calling thread in the traces and in the window.
+void SetThreadName(char const* name);
+
+//! \brief Mark the start of a new frame; to be called by the main thread.
+void NewFrame();
+
+//! \brief Write all recorded events to a trace which can be opened by
+//!        chrome://tracing or https://ui.perfetto.dev.
+//!
+//! @param [in] filename file to write the trace to
+//! @return whether the file could be written
+bool WriteChromeTrace(std::string const& filename);
+
+//! \brief Display the scopes of a recent frame, one row of nested scopes
+//!        per thread plus one for the GPU.
+//!
+//! The frame shown lags a few frames behind, as GPU times are only read
+//! back some frames after being measured.
+void RenderWindow();
+
+}
@@ -0,0 +1,181 @@
+#include "StreamingUniformBuffer.hpp"
+
+#include "core/Log.h"
+#include "core/opengl.hpp"
+
+#include <cassert>
+#include <cstring>
+
+constexpr size_t StreamingUniformBuffer::frames_in_flight_nb;
+
+StreamingUniformBuffer::StreamingUniformBuffer(GLsizeiptr frame_size)
+{
+	mFences.fill(nullptr);
+
+	GLint alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	mAlignment = static_cast<GLsizeiptr>(alignment > 0 ? alignment : 256);
+	mFrameSize = ((frame_size + mAlignment - 1) / mAlignment) * mAlignment;
+
+	auto const total_size = mFrameSize * static_cast<GLsizeiptr>(frames_in_flight_nb);
+	glGenBuffers(1, &mBuffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+	if (GLAD_GL_VERSION_4_4) {
+		GLbitfield const flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_UNIFORM_BUFFER, total_size, nullptr, flags);
+		mMappedData = static_cast<std::uint8_t*>(glMapBufferRange(GL_UNIFORM_BUFFER, 0, total_size, flags));
+		if (mMappedData == nullptr) {
+			// Immutable storage can be neither orphaned nor respecified,
+			// so start over with a mutable one for the fallback path.
+			LogWarning("Failed to persistently map the streaming uniform buffer: falling back to unsynchronised maps.");
+			glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+			glDeleteBuffers(1, &mBuffer);
+			glGenBuffers(1, &mBuffer);
+			glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		}
+	}
+	if (mMappedData == nullptr)
+		glBufferData(GL_UNIFORM_BUFFER, total_size, nullptr, GL_STREAM_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+
+	utils::opengl::debug::nameObject(GL_BUFFER, mBuffer, "Streaming uniforms");
+}
+
+StreamingUniformBuffer::~StreamingUniformBuffer()
+{
+	for (auto& fence : mFences) {
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+	if (mMappedData != nullptr) {
+		glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		glUnmapBuffer(GL_UNIFORM_BUFFER);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+		mMappedData = nullptr;
+	}
+	glDeleteBuffers(1, &mBuffer);
+	mBuffer = 0u;
+}
+
+void
+StreamingUniformBuffer::BeginFrame()
+{
+	assert(!mIsInFrame);
+
+	mRegion = (mRegion + 1u) % frames_in_flight_nb;
+	mRegionUsedBytesNb = 0;
+	mIsInFrame = true;
+
+	auto& fence = mFences[mRegion];
+	if (fence == nullptr)
+		return;
+
+	auto const status = glClientWaitSync(fence, 0, 0);
+	if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+		// Nothing to wait for.
+	} else if (mMappedData == nullptr) {
+		// The previous storage stays alive for the commands still using
+		// it, and none of the new one is in use.
+		Orphan();
+		++mStallsAvoidedNb;
+	} else {
+		++mStallsNb;
+		while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000u) == GL_TIMEOUT_EXPIRED)
+			;
+	}
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+
+void
+StreamingUniformBuffer::EndFrame()
+{
+	assert(mIsInFrame);
+
+	mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	mLastFrameUploadedBytesNb = mRegionUsedBytesNb;
+	mIsInFrame = false;
+}
+
+StreamingUniformBuffer::Allocation
+StreamingUniformBuffer::Upload(void const* data, GLsizeiptr size)
+{
+	assert(mIsInFrame);
+
+	Allocation allocation;
+	auto const aligned_size = ((size + mAlignment - 1) / mAlignment) * mAlignment;
+	if (mRegionUsedBytesNb + aligned_size > mFrameSize) {
+		if (!mHasReportedOverflow)
+			LogError("The streaming uniform buffer is too small: only %lld bytes per frame are available.", static_cast<long long>(mFrameSize));
+		mHasReportedOverflow = true;
+		return allocation;
+	}
+
+	allocation.offset = static_cast<GLintptr>(mRegion) * mFrameSize + mRegionUsedBytesNb;
+	allocation.size = size;
+	mRegionUsedBytesNb += aligned_size;
+
+	if (mMappedData != nullptr) {
+		std::memcpy(mMappedData + allocation.offset, data, static_cast<size_t>(size));
+	} else {
+		// The fences guarantee the GPU is done with that range.
+		glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		auto* const destination = glMapBufferRange(GL_UNIFORM_BUFFER, allocation.offset, size,
+		                                           GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+		if (destination != nullptr) {
+			std::memcpy(destination, data, static_cast<size_t>(size));
+			glUnmapBuffer(GL_UNIFORM_BUFFER);
+		}
+		glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+	}
+
+	return allocation;
+}
+
+void
+StreamingUniformBuffer::Bind(GLuint binding, Allocation const& allocation) const
+{
+	if (allocation.size == 0)
+		return;
+
+	glBindBufferRange(GL_UNIFORM_BUFFER, binding, mBuffer, allocation.offset, allocation.size);
+}
+
+bool
+StreamingUniformBuffer::IsPersistentlyMapped() const
+{
+	return mMappedData != nullptr;
+}
+
+GLsizeiptr
+StreamingUniformBuffer::GetLastFrameUploadedBytesNb() const
+{
+	return mLastFrameUploadedBytesNb;
+}
+
+std::uint64_t
+StreamingUniformBuffer::GetStallsNb() const
+{
+	return mStallsNb;
+}
+
+std::uint64_t
+StreamingUniformBuffer::GetStallsAvoidedNb() const
+{
+	return mStallsAvoidedNb;
+}
+
+void
+StreamingUniformBuffer::Orphan()
+{
+	glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, mFrameSize * static_cast<GLsizeiptr>(frames_in_flight_nb), nullptr, GL_STREAM_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0u);
+
+	// The other regions now live in the new storage as well.
+	for (auto& fence : mFences) {
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+//! \brief Ring buffer for uniform data rewritten every frame.
+//!
+//! The buffer is split into one region per frame in flight; a region is
+//! only written to again once the GPU signalled it is done with the frame
+//! which last used it, so uploads never have to synchronise with the GPU
+//! the way glBufferSubData() on a buffer still in use might.
+//!
+//! With OpenGL 4.4 the buffer is persistently mapped. Otherwise, or if that
+//! mapping fails, the storage is mutable and each upload maps its range
+//! without synchronisation; and when the next region is still in use, the
+//! buffer is orphaned instead of waiting for it.
+//!
+//! Usage, once per frame:
+//! 1. `BeginFrame()`;
+//! 2. `Upload()` the data, and `Bind()` the returned allocations;
+//! 3. `EndFrame()`, after all the draw calls using those allocations.
+class StreamingUniformBuffer
+{
+public:
+	static constexpr size_t frames_in_flight_nb = 3u;
+
+	//! \brief Part of the buffer returned by `Upload()`; its size is 0
+	//!        when the upload did not fit in the frame's region.
+	struct Allocation {
+		GLintptr offset{ 0 };
+		GLsizeiptr size{ 0 };
+	};
+
+	//! \brief Create the buffer.
+	//!
+	//! @param [in] frame_size maximum amount of bytes, alignment
+	//!             included, uploaded per frame
+	explicit StreamingUniformBuffer(GLsizeiptr frame_size);
+	~StreamingUniformBuffer();
+
+	StreamingUniformBuffer(StreamingUniformBuffer const&) = delete;
+	StreamingUniformBuffer& operator=(StreamingUniformBuffer const&) = delete;
+
+	//! \brief Move on to the next region, waiting for the GPU if needed.
+	void BeginFrame();
+
+	//! \brief Mark the end of the commands using the current region.
+	void EndFrame();
+
+	//! \brief Copy data into the current region.
+	//!
+	//! @param [in] data data to upload
+	//! @param [in] size size of the data, in bytes
+	//! @return where the data was copied to
+	Allocation Upload(void const* data, GLsizeiptr size);
+
+	//! \brief Bind an allocation to a uniform buffer binding point.
+	void Bind(GLuint binding, Allocation const& allocation) const;
+
+	//! \brief Whether the buffer is persistently mapped.
+	bool IsPersistentlyMapped() const;
+
+	//! \brief Number of bytes uploaded during the last completed frame.
+	GLsizeiptr GetLastFrameUploadedBytesNb() const;
+
+	//! \brief Number of times `BeginFrame()` had to wait for the GPU.
+	std::uint64_t GetStallsNb() const;
+
+	//! \brief Number of times the next region was still in use, and the
+	//!        buffer got orphaned instead of waiting for the GPU; this only
+	//!        happens without persistent mapping.
+	std::uint64_t GetStallsAvoidedNb() const;
+
+private:
+	void Orphan();
+
+	GLuint mBuffer{ 0u };
+	GLsizeiptr mFrameSize{ 0 };
+	GLsizeiptr mAlignment{ 0 };
+	std::uint8_t* mMappedData{ nullptr };
+
+	std::array<GLsync, frames_in_flight_nb> mFences;
+	size_t mRegion{ 0u };
+	GLsizeiptr mRegionUsedBytesNb{ 0 };
+	bool mIsInFrame{ false };
+
+	GLsizeiptr mLastFrameUploadedBytesNb{ 0 };
+	std::uint64_t mStallsNb{ 0u };
+	std::uint64_t mStallsAvoidedNb{ 0u };
+	bool mHasReportedOverflow{ false };
+};
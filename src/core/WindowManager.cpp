@@ -1,5 +1,7 @@
 #include "WindowManager.hpp"
 
+#include "GLTrace.hpp"
+#include "GpuMemory.hpp"
 #include "Log.h"
 #include "opengl.hpp"
 
@@ -8,14 +10,43 @@
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// The null platform, used by the headless mode, appeared in GLFW 3.4.
+#if GLFW_VERSION_MAJOR > 3 || (GLFW_VERSION_MAJOR == 3 && GLFW_VERSION_MINOR >= 4)
+#	define HAS_GLFW_NULL_PLATFORM 1
+#else
+#	define HAS_GLFW_NULL_PLATFORM 0
+#endif
+
 namespace
 {
 	const int default_opengl_major_version = 4;
 	const int default_opengl_minor_version = 1;
 	const int default_glsl_version = default_opengl_major_version * 100 + default_opengl_minor_version * 10;
 
+	// A newer context is requested first, as some code paths (such as
+	// multi-draw indirect) require it; the default version is used as a
+	// fallback when it is not available.
+#ifdef __APPLE__
+	const bool try_preferred_opengl_version = false; // macOS stops at OpenGL 4.1.
+#else
+	const bool try_preferred_opengl_version = true;
+#endif
+	const int preferred_opengl_major_version = 4;
+	const int preferred_opengl_minor_version = 3;
+
+	// Set while trying to get the preferred context version, or the
+	// preferred headless context API, as failing to get them is expected on
+	// some platforms and should not be reported.
+	bool is_probing_opengl_version = false;
+
 	void ErrorCallback(int error, char const* description)
 	{
+		if (is_probing_opengl_version && (error == 65542 || error == 65543 || error == 65545))
+			return;
 		if (error == 65543 || error == 65545)
 			LogError("Couldn't create an OpenGL %d.%d context.\nIf you are using old hardware/drivers which support OpenGL 3.3 but not higher, try using the 'OpenGL_3.3' branch.", default_opengl_major_version, default_opengl_minor_version);
 		else
@@ -67,7 +98,77 @@ namespace
 
 std::mutex WindowManager::mMutex;
 
-WindowManager::WindowManager()
+WindowManager::HeadlessSettings WindowManager::ParseHeadlessSettings(int argc, char const* const argv[])
+{
+	HeadlessSettings settings;
+	for (int i = 1; i < argc; ++i) {
+		char const* const argument = argv[i];
+		if (std::strcmp(argument, "--headless") == 0) {
+			settings.enabled = true;
+		} else if (std::strncmp(argument, "--frames=", 9) == 0) {
+			auto const frames_nb = std::strtol(argument + 9, nullptr, 10);
+			if (frames_nb > 0)
+				settings.frames_nb = static_cast<unsigned int>(frames_nb);
+			else
+				LogWarning("Invalid number of frames “%s”: keeping %u.", argument + 9, settings.frames_nb);
+		} else if (std::strncmp(argument, "--size=", 7) == 0) {
+			int width = 0, height = 0;
+			if (std::sscanf(argument + 7, "%dx%d", &width, &height) == 2 && width > 0 && height > 0) {
+				settings.width = width;
+				settings.height = height;
+			} else {
+				LogWarning("Invalid size “%s”: keeping %dx%d.", argument + 7, settings.width, settings.height);
+			}
+		}
+	}
+
+	return settings;
+}
+
+WindowManager::InputReplaySettings WindowManager::ParseInputReplaySettings(int argc, char const* const argv[])
+{
+	InputReplaySettings settings;
+	for (int i = 1; i < argc; ++i) {
+		char const* const argument = argv[i];
+		if (std::strncmp(argument, "--record-input=", 15) == 0)
+			settings.record_filename = argument + 15;
+		else if (std::strncmp(argument, "--replay-input=", 15) == 0)
+			settings.replay_filename = argument + 15;
+	}
+
+	return settings;
+}
+
+void WindowManager::SetInputReplaySettings(InputReplaySettings const& input_replay_settings)
+{
+	mInputReplaySettings = input_replay_settings;
+}
+
+FrameClock::Settings const& WindowManager::GetFrameClockSettings() const noexcept
+{
+	return mFrameClockSettings;
+}
+
+void WindowManager::SetFrameClockSettings(FrameClock::Settings const& frame_clock_settings)
+{
+	mFrameClockSettings = frame_clock_settings;
+}
+
+void WindowManager::SetFrameStatsSettings(FrameStats::Settings const& frame_stats_settings)
+{
+	mFrameStats = FrameStats(frame_stats_settings);
+}
+
+FrameStats const& WindowManager::GetFrameStats() const noexcept
+{
+	return mFrameStats;
+}
+
+WindowManager::WindowManager() : WindowManager(HeadlessSettings())
+{
+}
+
+WindowManager::WindowManager(HeadlessSettings const& headless_settings) : mHeadlessSettings(headless_settings)
 {
 	bool const is_first_instance = WindowManager::mMutex.try_lock();
 	if (!is_first_instance)
@@ -75,6 +176,16 @@ WindowManager::WindowManager()
 
 	glfwSetErrorCallback(ErrorCallback);
 
+	if (mHeadlessSettings.enabled) {
+#if HAS_GLFW_NULL_PLATFORM
+		glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+		LogInfo("Running headless at %dx%d for %u frames.", mHeadlessSettings.width, mHeadlessSettings.height, mHeadlessSettings.frames_nb);
+#else
+		WindowManager::mMutex.unlock();
+		throw std::runtime_error("[WindowManager] The headless mode requires GLFW 3.4 or later.");
+#endif
+	}
+
 	int const init_res = glfwInit();
 	if (init_res == GLFW_FALSE) {
 		WindowManager::mMutex.unlock();
@@ -88,6 +199,24 @@ WindowManager::~WindowManager()
 	WindowManager::mMutex.unlock();
 }
 
+bool WindowManager::IsHeadless() const noexcept
+{
+	return mHeadlessSettings.enabled;
+}
+
+int WindowManager::GetExitStatus() const noexcept
+{
+	if (!mHeadlessSettings.enabled)
+		return EXIT_SUCCESS;
+
+	if (mRenderedFramesNb < mHeadlessSettings.frames_nb) {
+		LogError("Only %u out of %u frames were rendered.", mRenderedFramesNb, mHeadlessSettings.frames_nb);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
 GLFWwindow* WindowManager::CreateGLFWWindow(std::string const& title, WindowDatum const& data, unsigned int msaa, bool fullscreen, bool resizable, SwapStrategy swap)
 {
 #ifdef __APPLE__
@@ -97,27 +226,75 @@ GLFWwindow* WindowManager::CreateGLFWWindow(std::string const& title, WindowDatu
 #if DEBUG_LEVEL >= 2
 	glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
 #endif
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, default_opengl_major_version);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, default_opengl_minor_version);
-
 	glfwWindowHint(GLFW_RESIZABLE, resizable ? GLFW_TRUE : GLFW_FALSE);
 	glfwWindowHint(GLFW_SAMPLES, static_cast<int>(msaa));
 
-	GLFWmonitor* const monitor = glfwGetPrimaryMonitor();
-	GLFWvidmode const* const video_mode = glfwGetVideoMode(monitor);
-	int width  = fullscreen ? data.fullscreen_width  : data.windowed_width;
-	int height = fullscreen ? data.fullscreen_height : data.windowed_height;
-	if (width == 0)
-		width = video_mode->width;
-	if (height == 0)
-		height = video_mode->height;
-
-	glfwWindowHint(GLFW_RED_BITS, video_mode->redBits);
-	glfwWindowHint(GLFW_GREEN_BITS, video_mode->greenBits);
-	glfwWindowHint(GLFW_BLUE_BITS, video_mode->blueBits);
-	glfwWindowHint(GLFW_REFRESH_RATE, video_mode->refreshRate);
+	int width = 0, height = 0;
+	GLFWmonitor* monitor = nullptr;
+	if (mHeadlessSettings.enabled) {
+		// There is no display to match, nor to wait on.
+		width = mHeadlessSettings.width;
+		height = mHeadlessSettings.height;
+		fullscreen = false;
+		swap = SwapStrategy::disable_vsync;
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	} else {
+		monitor = glfwGetPrimaryMonitor();
+		GLFWvidmode const* const video_mode = glfwGetVideoMode(monitor);
+		width  = fullscreen ? data.fullscreen_width  : data.windowed_width;
+		height = fullscreen ? data.fullscreen_height : data.windowed_height;
+		if (width == 0)
+			width = video_mode->width;
+		if (height == 0)
+			height = video_mode->height;
+
+		glfwWindowHint(GLFW_RED_BITS, video_mode->redBits);
+		glfwWindowHint(GLFW_GREEN_BITS, video_mode->greenBits);
+		glfwWindowHint(GLFW_BLUE_BITS, video_mode->blueBits);
+		glfwWindowHint(GLFW_REFRESH_RATE, video_mode->refreshRate);
+	}
 
-	GLFWwindow* window = glfwCreateWindow(width, height, title.c_str(), fullscreen ? monitor : nullptr, nullptr);
+	auto const create_window = [&](bool is_probing){
+		GLFWwindow* window = nullptr;
+		if (try_preferred_opengl_version) {
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, preferred_opengl_major_version);
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, preferred_opengl_minor_version);
+
+			is_probing_opengl_version = true;
+			window = glfwCreateWindow(width, height, title.c_str(), fullscreen ? monitor : nullptr, nullptr);
+			is_probing_opengl_version = false;
+
+			if (window == nullptr && !is_probing)
+				LogInfo("Couldn't create an OpenGL %d.%d context: falling back to OpenGL %d.%d.", preferred_opengl_major_version, preferred_opengl_minor_version, default_opengl_major_version, default_opengl_minor_version);
+		}
+		if (window == nullptr) {
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, default_opengl_major_version);
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, default_opengl_minor_version);
+
+			is_probing_opengl_version = is_probing;
+			window = glfwCreateWindow(width, height, title.c_str(), fullscreen ? monitor : nullptr, nullptr);
+			is_probing_opengl_version = false;
+		}
+		return window;
+	};
+
+	GLFWwindow* window = nullptr;
+	if (mHeadlessSettings.enabled) {
+#if HAS_GLFW_NULL_PLATFORM
+		// OSMesa provides an offscreen default framebuffer; surfaceless
+		// EGL contexts have none, so only the rendering into framebuffer
+		// objects is meaningful with them.
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+		window = create_window(true);
+		if (window == nullptr) {
+			LogInfo("Couldn't create an OSMesa context: falling back to a surfaceless EGL one.");
+			glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+			window = create_window(false);
+		}
+#endif
+	} else {
+		window = create_window(false);
+	}
 
 	if (window == nullptr)
 		return nullptr;
@@ -128,6 +305,8 @@ GLFWwindow* WindowManager::CreateGLFWWindow(std::string const& title, WindowDatu
 		LogError("[GLAD]: Failed to initialise OpenGL context.");
 		return nullptr;
 	}
+	GLTrace::InstallHooks();
+	GpuMemory::InstallHooks();
 
 	// Setup Dear ImGui context
 	IMGUI_CHECKVERSION();
@@ -202,6 +381,11 @@ GLFWwindow* WindowManager::CreateGLFWWindow(std::string const& title, WindowDatu
 	datum_copy->fullscreen_height = height;
 	glfwSetWindowUserPointer(window, datum_copy.get());
 
+	if (!mInputReplaySettings.replay_filename.empty() && !data.input_handler.StartReplay(mInputReplaySettings.replay_filename))
+		throw std::runtime_error("[WindowManager] Failed to start replaying the inputs.");
+	if (!mInputReplaySettings.record_filename.empty() && !data.input_handler.StartRecording(mInputReplaySettings.record_filename))
+		throw std::runtime_error("[WindowManager] Failed to start recording the inputs.");
+
 	return window;
 }
 
@@ -227,9 +411,39 @@ void WindowManager::NewImGuiFrame()
 
 void WindowManager::RenderImGuiFrame(bool show_gui)
 {
+	GLTrace::RenderOverlay();
+	mFrameStats.RenderWindow();
 	ImGui::Render();
 	if (show_gui)
 		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+	// All assignments render the GUI once per frame, making it a
+	// convenient place to count frames without touching their loops.
+	if (mHeadlessSettings.enabled && ++mRenderedFramesNb >= mHeadlessSettings.frames_nb) {
+		for (auto const& window_datum : mWindowData)
+			glfwSetWindowShouldClose(window_datum.first, GLFW_TRUE);
+	}
+	for (auto const& window_datum : mWindowData)
+		if (window_datum.second->input_handler.IsReplayFinished())
+			glfwSetWindowShouldClose(window_datum.first, GLFW_TRUE);
+}
+
+void WindowManager::SwapBuffers(GLFWwindow* const window)
+{
+	// The first present has no previous one to be measured against.
+	// Calls made after the GUI, e.g. to recycle per-frame resources, are
+	// part of the frame as well.
+	GLTrace::EndFrame();
+
+	auto const swap_start_time = std::chrono::steady_clock::now();
+	glfwSwapBuffers(window);
+	auto const present_time = std::chrono::steady_clock::now();
+	if (mHasPresented) {
+		auto const present_interval = present_time - mLastPresentTime;
+		mFrameStats.AddFrame(present_interval - (present_time - swap_start_time), present_interval);
+	}
+	mLastPresentTime = present_time;
+	mHasPresented = true;
 }
 
 void WindowManager::ToggleFullscreenStatusForWindow(GLFWwindow* const window) noexcept
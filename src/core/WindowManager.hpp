@@ -1,12 +1,16 @@
 #pragma once
 
 #include "FPSCamera.h"
+#include "FrameClock.hpp"
+#include "FrameStats.hpp"
 #include "InputHandler.h"
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
+#include <chrono>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <memory>
 
@@ -18,6 +22,19 @@
 //! All windows, which were not manually destroyed using the
 //! WindowManager::DestroyWindow method, will be automatically destroyed along
 //! with the WindowManager object when it gets deleted.
+//!
+//! In headless mode, no display is needed: GLFW's null platform is used,
+//! along with an OSMesa context (e.g. llvmpipe) rendering into an
+//! offscreen framebuffer of the requested size, or a surfaceless EGL one
+//! when OSMesa is not available. The windows are then flagged for closing
+//! after a fixed number of frames, so that the assignment loops terminate
+//! on their own.
+//!
+//! The inputs of a window can also be recorded to a file, or replayed from
+//! one; a replaying window is flagged for closing once the replay is over.
+//!
+//! Frames presented through `SwapBuffers()` are timed, and their pacing is
+//! displayed along with the GUI.
 class WindowManager
 {
 public:
@@ -34,17 +51,73 @@ public:
 		int           xpos, ypos;
 	};
 
+	struct HeadlessSettings {
+		bool         enabled{ false };
+		int          width{ 1280 }, height{ 720 };
+		unsigned int frames_nb{ 100u }; //!< frames rendered before the windows get closed
+	};
+
+	//! \brief Extract the headless settings from the command line.
+	//!
+	//! The recognised arguments are `--headless`, `--frames=N` and
+	//! `--size=WIDTHxHEIGHT`; other arguments are ignored.
+	static HeadlessSettings ParseHeadlessSettings(int argc, char const* const argv[]);
+
+	struct InputReplaySettings {
+		std::string record_filename; //!< empty when not recording
+		std::string replay_filename; //!< empty when not replaying
+	};
+
+	//! \brief Extract the input recording and replay settings from the
+	//!        command line.
+	//!
+	//! The recognised arguments are `--record-input=FILENAME` and
+	//! `--replay-input=FILENAME`; other arguments are ignored.
+	static InputReplaySettings ParseInputReplaySettings(int argc, char const* const argv[]);
+
+	//! \brief Set whether the inputs of the windows created from now on
+	//!        should be recorded or replayed.
+	void SetInputReplaySettings(InputReplaySettings const& input_replay_settings);
+
+	//! \brief Settings the assignments should create their frame clock
+	//!        with.
+	FrameClock::Settings const& GetFrameClockSettings() const noexcept;
+	void SetFrameClockSettings(FrameClock::Settings const& frame_clock_settings);
+
+	//! \brief Set the budget against which stutters are counted.
+	void SetFrameStatsSettings(FrameStats::Settings const& frame_stats_settings);
+	FrameStats const& GetFrameStats() const noexcept;
+
 	WindowManager();
+	explicit WindowManager(HeadlessSettings const& headless_settings);
 	~WindowManager();
 
+	bool IsHeadless() const noexcept;
+
+	//! \brief Status the application should exit with: in headless
+	//!        mode, it is a failure unless all requested frames were
+	//!        rendered.
+	int GetExitStatus() const noexcept;
+
 	GLFWwindow* CreateGLFWWindow(std::string const& title, WindowDatum const& data, unsigned int msaa = 1u, bool fullscreen = false, bool resizable = false, SwapStrategy swap = SwapStrategy::enable_vsync);
 	void DestroyWindow(GLFWwindow* const window);
 	void NewImGuiFrame();
 	void RenderImGuiFrame(bool show_gui);
+
+	//! \brief Present the frame, recording its CPU time and the interval
+	//!        since the previous present.
+	void SwapBuffers(GLFWwindow* const window);
 	void ToggleFullscreenStatusForWindow(GLFWwindow* const window) noexcept;
 
 private:
 	std::unordered_map<GLFWwindow*, std::unique_ptr<WindowDatum>> mWindowData;
+	HeadlessSettings mHeadlessSettings;
+	InputReplaySettings mInputReplaySettings;
+	FrameClock::Settings mFrameClockSettings;
+	unsigned int mRenderedFramesNb{ 0u };
+	FrameStats mFrameStats;
+	std::chrono::steady_clock::time_point mLastPresentTime;
+	bool mHasPresented{ false };
 
 	static std::mutex mMutex;
 };
@@ -1,8 +1,11 @@
 #include "config.hpp"
 #include "helpers.hpp"
+#include "MaterialBuffer.hpp"
 
+#include "core/GpuMemory.hpp"
 #include "core/Log.h"
 #include "core/opengl.hpp"
+#include "core/Profiler.h"
 #include "core/various.hpp"
 
 #include <assimp/Importer.hpp>
@@ -15,7 +18,9 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <utility>
 
 namespace
 {
@@ -43,6 +48,7 @@ namespace local
 {
 	static GLuint fullscreen_shader;
 	static GLuint display_vao;
+	static std::unique_ptr<MaterialBuffer> material_buffer;
 	static std::array<char const*, 3> const cull_mode_labels{
 		"Disabled",
 		"Back faces",
@@ -58,6 +64,7 @@ namespace local
 void
 bonobo::init()
 {
+	GpuMemory::OwnerScope owner("bonobo");
 	setupBasisData();
 	createDebugTexture();
 
@@ -66,6 +73,8 @@ bonobo::init()
 	local::fullscreen_shader = bonobo::createProgram("common/fullscreen.vert", "common/fullscreen.frag");
 	if (local::fullscreen_shader == 0u)
 		LogError("Failed to load \"fullscreen.vert\" and \"fullscreen.frag\"");
+
+	local::material_buffer = std::make_unique<MaterialBuffer>();
 }
 
 void
@@ -81,6 +90,14 @@ bonobo::deinit()
 
 	glDeleteProgram(local::fullscreen_shader);
 	glDeleteVertexArrays(1, &local::display_vao);
+
+	local::material_buffer.reset();
+}
+
+MaterialBuffer*
+bonobo::getMaterialBuffer()
+{
+	return local::material_buffer.get();
 }
 
 static std::vector<std::uint8_t>
@@ -106,8 +123,10 @@ getTextureData(std::string const& filename, std::uint32_t& width, std::uint32_t&
 }
 
 std::vector<bonobo::mesh_data>
-bonobo::loadObjects(std::string const& filename)
+bonobo::loadObjects(std::string const& filename, bool keep_cpu_geometry)
 {
+	PROFILE_FUNCTION();
+	GpuMemory::OwnerScope owner(filename);
 	auto const scene_start_time = std::chrono::high_resolution_clock::now();
 
 	std::vector<bonobo::mesh_data> objects;
@@ -145,6 +164,7 @@ bonobo::loadObjects(std::string const& filename)
 	for (size_t i = 0; i < assimp_scene->mNumMaterials; ++i) {
 		if (!are_materials_used[i])
 			continue;
+		PROFILE_SCOPE("Load material");
 
 		auto const material_start_time = std::chrono::high_resolution_clock::now();
 		texture_bindings& bindings = materials_bindings[i];
@@ -205,6 +225,7 @@ bonobo::loadObjects(std::string const& filename)
 	auto const meshes_start_time = std::chrono::high_resolution_clock::now();
 	objects.reserve(assimp_scene->mNumMeshes);
 	for (size_t j = 0; j < assimp_scene->mNumMeshes; ++j) {
+		PROFILE_SCOPE("Load mesh");
 		auto const mesh_start_time = std::chrono::high_resolution_clock::now();
 
 		auto const assimp_object_mesh = assimp_scene->mMeshes[j];
@@ -308,6 +329,11 @@ bonobo::loadObjects(std::string const& filename)
 		assert(object.ibo != 0u);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, object.ibo);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<unsigned int>(object.indices_nb) * sizeof(GL_UNSIGNED_INT), reinterpret_cast<GLvoid const*>(object_indices.get()), GL_STATIC_DRAW);
+		if (keep_cpu_geometry) {
+			object.positions.resize(assimp_object_mesh->mNumVertices);
+			std::memcpy(object.positions.data(), assimp_object_mesh->mVertices, static_cast<size_t>(vertices_size));
+			object.indices.assign(object_indices.get(), object_indices.get() + object.indices_nb);
+		}
 		object_indices.reset(nullptr);
 
 		utils::opengl::debug::nameObject(GL_VERTEX_ARRAY, object.vao, object.name + " VAO");
@@ -324,7 +350,7 @@ bonobo::loadObjects(std::string const& filename)
 			object.material = material_constants[material_id];
 		}
 
-		objects.push_back(object);
+		objects.push_back(std::move(object));
 
 		auto const mesh_end_time = std::chrono::high_resolution_clock::now();
 
@@ -389,6 +415,7 @@ bonobo::loadTexture2D(std::string const& filename, bool generate_mipmap)
 	if (data.empty())
 		return 0u;
 
+	GpuMemory::OwnerScope owner(filename);
 	GLuint texture = bonobo::createTexture(width, height, GL_TEXTURE_2D, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid const*>(data.data()));
 	glBindTexture(GL_TEXTURE_2D, texture);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, generate_mipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
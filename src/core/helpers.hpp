@@ -11,6 +11,8 @@
 #include <vector>
 #include <unordered_map>
 
+class MaterialBuffer;
+
 //! \brief Namespace containing a few helpers for the LUGG computer graphics labs.
 namespace bonobo
 {
@@ -49,6 +51,8 @@ namespace bonobo
 		material_data material{};                //!< constant values for the material of this mesh
 		GLenum drawing_mode{GL_TRIANGLES};       //!< OpenGL drawing mode, i.e. GL_TRIANGLES, GL_LINES, etc.
 		std::string name{"un-named mesh"};       //!< Name of the mesh; used for debugging purposes.
+		std::vector<glm::vec3> positions{};      //!< CPU copy of the vertex positions; only filled in on request
+		std::vector<GLuint> indices{};           //!< CPU copy of the indices; only filled in on request
 	};
 
 	enum class cull_mode_t : unsigned int {
@@ -69,12 +73,21 @@ namespace bonobo
 	//! \brief Deallocate objects allocated by the `init()` function.
 	void deinit();
 
+	//! \brief Get the uniform buffer shared by all materials.
+	//!
+	//! @return the buffer allocated by `init()`, or null if `init()` has
+	//!         not been called
+	MaterialBuffer* getMaterialBuffer();
+
 	//! \brief Load objects found in an object/scene file, using assimp.
 	//!
 	//! @param [in] filename of the object/scene file to load.
+	//! @param [in] keep_cpu_geometry whether to also keep the positions
+	//!             and indices in the `mesh_data`, e.g. for CPU-side
+	//!             processing of the meshes
 	//! @return a vector of filled in `mesh_data` structures, one per
 	//!         object found in the input file
-	std::vector<mesh_data> loadObjects(std::string const& filename);
+	std::vector<mesh_data> loadObjects(std::string const& filename, bool keep_cpu_geometry = false);
 
 	//! \brief Creates an OpenGL texture without any content nor parameters.
 	//!
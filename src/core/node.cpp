@@ -1,5 +1,6 @@
 #include "node.hpp"
 #include "helpers.hpp"
+#include "MaterialBuffer.hpp"
 
 #include "core/Log.h"
 #include "core/opengl.hpp"
@@ -42,13 +43,27 @@ Node::render(glm::mat4 const& view_projection, glm::mat4 const& world, GLuint pr
 		glUniform1i(glGetUniformLocation(program, texture_presence_var_name.c_str()), 1);
 	}
 
-	glUniform3fv(glGetUniformLocation(program, "diffuse_colour"), 1, glm::value_ptr(_constants.diffuse));
-	glUniform3fv(glGetUniformLocation(program, "specular_colour"), 1, glm::value_ptr(_constants.specular));
-	glUniform3fv(glGetUniformLocation(program, "ambient_colour"), 1, glm::value_ptr(_constants.ambient));
-	glUniform3fv(glGetUniformLocation(program, "emissive_colour"), 1, glm::value_ptr(_constants.emissive));
-	glUniform1f(glGetUniformLocation(program, "shininess_value"), _constants.shininess);
-	glUniform1f(glGetUniformLocation(program, "index_of_refraction_value"), _constants.indexOfRefraction);
-	glUniform1f(glGetUniformLocation(program, "opacity_value"), _constants.opacity);
+	// Programs declaring the `Material` uniform block get the constants
+	// from the shared material buffer, where they are only uploaded when
+	// they change; the others still get them as individual uniforms.
+	auto* const material_buffer = bonobo::getMaterialBuffer();
+	if (material_buffer != nullptr && MaterialBuffer::IsUsedBy(program)) {
+		if (_material_slot.index == MaterialBuffer::invalid_slot)
+			_material_slot.index = material_buffer->Allocate();
+		if (_material_slot.is_dirty) {
+			material_buffer->Update(_material_slot.index, _constants);
+			_material_slot.is_dirty = false;
+		}
+		material_buffer->Bind(_material_slot.index);
+	} else {
+		glUniform3fv(glGetUniformLocation(program, "diffuse_colour"), 1, glm::value_ptr(_constants.diffuse));
+		glUniform3fv(glGetUniformLocation(program, "specular_colour"), 1, glm::value_ptr(_constants.specular));
+		glUniform3fv(glGetUniformLocation(program, "ambient_colour"), 1, glm::value_ptr(_constants.ambient));
+		glUniform3fv(glGetUniformLocation(program, "emissive_colour"), 1, glm::value_ptr(_constants.emissive));
+		glUniform1f(glGetUniformLocation(program, "shininess_value"), _constants.shininess);
+		glUniform1f(glGetUniformLocation(program, "index_of_refraction_value"), _constants.indexOfRefraction);
+		glUniform1f(glGetUniformLocation(program, "opacity_value"), _constants.opacity);
+	}
 
 	glBindVertexArray(_vao);
 	if (_has_indices)
@@ -86,12 +101,14 @@ Node::set_geometry(bonobo::mesh_data const& shape)
 	}
 
 	_constants = shape.material;
+	_material_slot.is_dirty = true;
 }
 
 void
 Node::set_material_constants(bonobo::material_data const& constants)
 {
 	_constants = constants;
+	_material_slot.is_dirty = true;
 }
 
 void
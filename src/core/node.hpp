@@ -1,6 +1,7 @@
 #pragma once
 
 #include "helpers.hpp"
+#include "MaterialBuffer.hpp"
 #include "TRSTransform.h"
 
 #include <glad/glad.h>
@@ -10,6 +11,7 @@
 #include <functional>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 //! \brief Represents a node of a scene graph
@@ -145,6 +147,21 @@ private:
 	// Material data
 	std::vector<std::tuple<std::string, GLuint, GLenum>> _textures;
 	bonobo::material_data _constants;
+	// Slot in the shared material buffer, allocated on first use by a
+	// program declaring the `Material` uniform block. Copies of a node
+	// get their own slot, as their constants can diverge, while moves
+	// hand it over.
+	struct MaterialSlot {
+		size_t index{ MaterialBuffer::invalid_slot };
+		bool is_dirty{ true }; //!< constants changed since last uploaded
+
+		MaterialSlot() = default;
+		MaterialSlot(MaterialSlot const& /*other*/) {}
+		MaterialSlot& operator=(MaterialSlot const& /*other*/) { is_dirty = true; return *this; }
+		MaterialSlot(MaterialSlot&& other) noexcept : is_dirty(other.is_dirty) { std::swap(index, other.index); }
+		MaterialSlot& operator=(MaterialSlot&& other) noexcept { std::swap(index, other.index); is_dirty = other.is_dirty = true; return *this; }
+	};
+	mutable MaterialSlot _material_slot;
 
 	// Transformation data
 	TRSTransformf _transform;
@@ -1,4 +1,6 @@
+#include "GpuMemory.hpp"
 #include "Log.h"
+#include "MaterialBuffer.hpp"
 #include "opengl.hpp"
 #include "various.hpp"
 
@@ -114,6 +116,8 @@ endDebugGroup()
 void
 nameObject(GLenum type, GLuint id, std::string const& label)
 {
+	GpuMemory::SetName(type, id, label);
+
 	if (!isSupported())
 		return;
 
@@ -244,6 +248,9 @@ link_program(GLuint id)
 		LogError("Program failed to link but no log available.");
 	}
 
+	if (wasLinkingSuccessful)
+		MaterialBuffer::SetUpProgram(id);
+
 	return wasLinkingSuccessful;
 }
 
@@ -114,6 +114,13 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Use GLAD as the OpenGL loader of the OpenGL 3 backend, rather than its own gl3w-based one, so that the
+// backend's calls go through the same function pointers as the rest of the framework (and its hooks).
+// IMGUI_IMPL_OPENGL_LOADER_CUSTOM is only defined when compiling imgui_impl_opengl3.cpp (see src/external/CMakeLists.txt).
+#if defined(IMGUI_IMPL_OPENGL_LOADER_CUSTOM)
+#include <glad/glad.h>
+#endif
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 /*
 namespace ImGui